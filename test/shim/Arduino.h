@@ -0,0 +1,136 @@
+#pragma once
+/*
+ * Minimal Arduino core replacement for the native (host) test environment.
+ * Only what the sources under test use, see wled_host.h and wled_fx_host.h
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#undef unix // predefined by GNU C++ on Linux, a member name in Toki.h and udp.cpp
+
+inline uint16_t word(uint8_t h, uint8_t l) { return (h << 8) | l; }
+
+#define PI      3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI  6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define PROGMEM
+#define IRAM_ATTR
+#define PSTR(s) (s)
+#define F(s)    (s)
+#define memcpy_P  memcpy
+#define memcmp_P  memcmp
+#define strcpy_P  strcpy
+#define strncpy_P strncpy
+#define strcmp_P  strcmp
+#define strncmp_P strncmp
+#define strlen_P  strlen
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_byte_near(addr) pgm_read_byte(addr)
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(addr)) // also reads pointer tables, pointers are 64 bit on the host
+
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#define radians(deg) ((deg)*DEG_TO_RAD)
+#define degrees(rad) ((rad)*RAD_TO_DEG)
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+// no GPIO on the host
+#define LOW    0x0
+#define HIGH   0x1
+#define INPUT  0x01
+#define OUTPUT 0x03
+inline bool digitalPinIsValid(uint8_t pin) { return pin < 40; }
+inline bool digitalPinCanOutput(uint8_t pin) { return pin < 34; }
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline void digitalWrite(uint8_t pin, uint8_t val) {}
+inline void analogWrite(uint8_t pin, int val) {}
+inline double ledcSetup(uint8_t chan, double freq, uint8_t bit_num) { return freq; }
+inline void ledcAttachPin(uint8_t pin, uint8_t chan) {}
+inline void ledcDetachPin(uint8_t pin) {}
+inline void ledcWrite(uint8_t chan, uint32_t duty) {}
+
+// like the ESP32 core
+using std::min;
+using std::max;
+
+// tests may advance the clock instead of sleeping, e.g. to skip the minimum frame time
+inline unsigned long hostClockOffsetUs = 0;
+inline unsigned long micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() + hostClockOffsetUs;
+}
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void yield() { std::this_thread::yield(); }
+
+inline void randomSeed(unsigned long seed) { srand(seed); }
+inline long random(long howbig) { return howbig ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig) { return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall); }
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  if (in_max == in_min) return out_min;
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+inline size_t hostStrlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return len;
+}
+#define strlcpy hostStrlcpy
+
+class String {
+  public:
+    String(const char *s = "") : _s(s ? s : "") {}
+    String(const std::string &s) : _s(s) {}
+    const char *c_str() const { return _s.c_str(); }
+    unsigned length() const { return _s.length(); }
+    char charAt(unsigned i) const { return i < _s.length() ? _s[i] : 0; }
+    char operator[](unsigned i) const { return charAt(i); }
+    int indexOf(char c, unsigned from = 0) const { size_t i = _s.find(c, from); return i == std::string::npos ? -1 : int(i); }
+    String substring(unsigned from, unsigned to = ~0U) const { return from < _s.length() ? String(_s.substr(from, to > from ? to - from : 0)) : String(); }
+    long toInt() const { return atol(_s.c_str()); }
+    void trim() { _s.erase(0, _s.find_first_not_of(" \t\r\n")); _s.erase(_s.find_last_not_of(" \t\r\n") + 1); }
+    String &operator+=(const String &o) { _s += o._s; return *this; }
+    String &operator+=(char c) { _s += c; return *this; }
+    bool operator==(const String &o) const { return _s == o._s; }
+  private:
+    std::string _s;
+};
+#define FPSTR(p) (p)
+
+// debug output goes nowhere
+struct HostSerial {
+  template <typename... A> size_t printf(const char *fmt, A... args) { return 0; }
+  template <typename... A> size_t printf_P(const char *fmt, A... args) { return 0; }
+  template <typename T> size_t print(T v) { return 0; }
+  template <typename T> size_t println(T v) { return 0; }
+  size_t println() { return 0; }
+};
+inline HostSerial Serial;
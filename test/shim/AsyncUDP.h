@@ -0,0 +1,4 @@
+#pragma once
+// only named by ESPAsyncE131.h, the E1.31/DDP receiver is not compiled
+class AsyncUDP {};
+class AsyncUDPPacket {};
@@ -0,0 +1,432 @@
+#pragma once
+/*
+ * FastLED 3.6 replacement for the native (host) test environment: only the part of the API
+ * the effect engine uses (FX.cpp, FX_fcn.cpp, FX_2Dfcn.cpp, colors.cpp).
+ * lib8tion, palette and HSV functions follow the FastLED algorithms, so effects do comparable work per pixel.
+ * Noise uses the same Perlin structure with a different permutation table, its output is not FastLED's.
+ */
+
+#include <Arduino.h>
+
+typedef uint8_t  fract8;
+typedef uint16_t fract16;
+typedef uint16_t accum88;
+
+typedef enum { NOBLEND = 0, LINEARBLEND = 1, LINEARBLEND_NOWRAP = 2 } TBlendType;
+
+// lib8tion
+
+inline uint8_t scale8(uint8_t i, fract8 scale) { return (uint16_t(i) * (1 + uint16_t(scale))) >> 8; }
+inline uint8_t scale8_video(uint8_t i, fract8 scale) { return ((uint16_t(i) * scale) >> 8) + ((i && scale) ? 1 : 0); }
+inline uint16_t scale16(uint16_t i, fract16 scale) { return (uint32_t(i) * (1 + uint32_t(scale))) >> 16; }
+inline uint8_t qadd8(uint8_t i, uint8_t j) { unsigned t = i + j; return t > 255 ? 255 : t; }
+inline uint8_t qsub8(uint8_t i, uint8_t j) { int t = i - j; return t < 0 ? 0 : t; }
+inline uint8_t add8(uint8_t i, uint8_t j) { return i + j; }
+inline uint8_t abs8(int8_t i) { return i < 0 ? -i : i; }
+inline uint8_t map8(uint8_t in, uint8_t rangeStart, uint8_t rangeEnd) { return rangeStart + scale8(in, rangeEnd - rangeStart); }
+
+inline uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+  return b > a ? a + scale8(b - a, frac) : a - scale8(a - b, frac);
+}
+
+inline uint8_t sqrt16(uint16_t x) {
+  if (x <= 1) return x;
+  uint8_t low = 1, hi, mid;
+  hi = x > 7904 ? 255 : (x >> 5) + 8;
+  do {
+    mid = (low + hi) >> 1;
+    if (uint16_t(mid * mid) > x) hi = mid - 1;
+    else {
+      if (mid == 255) return 255;
+      low = mid + 1;
+    }
+  } while (hi >= low);
+  return low - 1;
+}
+
+inline uint8_t ease8InOutQuad(uint8_t i) {
+  uint8_t j = i & 0x80 ? 255 - i : i;
+  uint8_t jj2 = scale8(j, j) << 1;
+  return i & 0x80 ? 255 - jj2 : jj2;
+}
+
+inline uint8_t ease8InOutCubic(fract8 i) {
+  uint8_t ii = scale8(i, i);
+  uint8_t iii = scale8(ii, i);
+  uint16_t r1 = (3 * uint16_t(ii)) - (2 * uint16_t(iii));
+  return r1 & 0x100 ? 255 : r1;
+}
+
+inline uint8_t ease8InOutApprox(fract8 i) {
+  if (i < 64) return i / 2;
+  if (i > 255 - 64) return 255 - (255 - i) / 2;
+  i -= 64;
+  return i + i / 2 + 32;
+}
+
+inline uint8_t triwave8(uint8_t in) { if (in & 0x80) in = 255 - in; return in << 1; }
+inline uint8_t quadwave8(uint8_t in) { return ease8InOutQuad(triwave8(in)); }
+inline uint8_t cubicwave8(uint8_t in) { return ease8InOutCubic(triwave8(in)); }
+
+inline int16_t sin16(uint16_t theta) {
+  static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+  uint16_t offset = (theta & 0x3FFF) >> 3; // 0..2047
+  if (theta & 0x4000) offset = 2047 - offset;
+  uint8_t section = offset / 256; // 0..7
+  uint8_t secoffset8 = uint8_t(offset) / 2;
+  int16_t y = slope[section] * secoffset8 + base[section];
+  return theta & 0x8000 ? -y : y;
+}
+inline int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+
+inline uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+  uint8_t offset = theta;
+  if (theta & 0x40) offset = 255 - offset;
+  offset &= 0x3F; // 0..63
+  uint8_t secoffset = offset & 0x0F; // 0..15
+  if (theta & 0x40) secoffset++;
+  const uint8_t *p = b_m16_interleave + (offset >> 4) * 2;
+  uint8_t mx = (p[1] * secoffset) >> 4;
+  int8_t y = mx + p[0];
+  if (theta & 0x80) y = -y;
+  return y + 128;
+}
+inline uint8_t cos8(uint8_t theta) { return sin8(theta + 64); }
+
+inline uint16_t rand16seed = 1337;
+inline uint16_t random16() { rand16seed = rand16seed * 2053 + 13849; return rand16seed; }
+inline uint16_t random16(uint16_t lim) { return (uint32_t(random16()) * lim) >> 16; }
+inline uint16_t random16(uint16_t min, uint16_t lim) { return random16(lim - min) + min; }
+inline void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+inline uint16_t random16_get_seed() { return rand16seed; }
+inline uint8_t random8() { random16(); return uint8_t(rand16seed & 0xFF) + uint8_t(rand16seed >> 8); }
+inline uint8_t random8(uint8_t lim) { return (uint16_t(random8()) * lim) >> 8; }
+inline uint8_t random8(uint8_t min, uint8_t lim) { return random8(lim - min) + min; }
+
+inline uint16_t beat88(accum88 beats_per_minute_88, uint32_t timebase = 0) {
+  return ((millis() - timebase) * beats_per_minute_88 * 280) >> 16;
+}
+inline uint16_t beat16(accum88 beats_per_minute, uint32_t timebase = 0) {
+  if (beats_per_minute < 256) beats_per_minute <<= 8;
+  return beat88(beats_per_minute, timebase);
+}
+inline uint8_t beat8(accum88 beats_per_minute, uint32_t timebase = 0) { return beat16(beats_per_minute, timebase) >> 8; }
+
+inline uint16_t beatsin88(accum88 beats_per_minute_88, uint16_t lowest = 0, uint16_t highest = 65535, uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beatsin = sin16(beat88(beats_per_minute_88, timebase) + phase_offset) + 32768;
+  return lowest + scale16(beatsin, highest - lowest);
+}
+inline uint16_t beatsin16(accum88 beats_per_minute, uint16_t lowest = 0, uint16_t highest = 65535, uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beatsin = sin16(beat16(beats_per_minute, timebase) + phase_offset) + 32768;
+  return lowest + scale16(beatsin, highest - lowest);
+}
+inline uint8_t beatsin8(accum88 beats_per_minute, uint8_t lowest = 0, uint8_t highest = 255, uint32_t timebase = 0, uint8_t phase_offset = 0) {
+  uint8_t beatsin = sin8(beat8(beats_per_minute, timebase) + phase_offset);
+  return lowest + scale8(beatsin, highest - lowest);
+}
+
+// Perlin noise
+
+inline const uint8_t *noisePermutation() {
+  static uint8_t p[257];
+  static bool init = false;
+  if (!init) {
+    uint16_t seed = 0x5EED;
+    for (int i = 0; i < 256; i++) p[i] = i;
+    for (int i = 255; i > 0; i--) {
+      seed = seed * 2053 + 13849;
+      uint8_t j = seed % (i + 1), t = p[i];
+      p[i] = p[j];
+      p[j] = t;
+    }
+    p[256] = p[0];
+    init = true;
+  }
+  return p;
+}
+
+inline int16_t noiseGrad16(uint8_t hash, int16_t x, int16_t y, int16_t z) {
+  hash &= 0xF;
+  int16_t u = hash < 8 ? x : y;
+  int16_t v = hash < 4 ? y : (hash == 12 || hash == 14 ? x : z);
+  if (hash & 1) u = -u;
+  if (hash & 2) v = -v;
+  return (u + v) >> 1;
+}
+
+inline int16_t noiseLerp15by16(int16_t a, int16_t b, uint16_t frac) { return a + int16_t((int64_t(b) - a) * frac >> 16); }
+inline uint16_t noiseEase16(uint16_t i) { // ease16InOutQuad
+  uint16_t j = i & 0x8000 ? 65535 - i : i;
+  uint16_t jj2 = (uint32_t(j) * (j + 1) >> 16) << 1;
+  return i & 0x8000 ? 65535 - jj2 : jj2;
+}
+
+inline int16_t inoise16_raw(uint32_t x, uint32_t y, uint32_t z) {
+  const uint8_t *P = noisePermutation();
+  uint8_t X = x >> 16, Y = y >> 16, Z = z >> 16;
+  uint8_t A = P[X] + Y, AA = P[A] + Z, AB = P[A + 1] + Z;
+  uint8_t B = P[X + 1] + Y, BA = P[B] + Z, BB = P[B + 1] + Z;
+  uint16_t u = noiseEase16(x), v = noiseEase16(y), w = noiseEase16(z);
+  int16_t xx = (x >> 1) & 0x7FFF, yy = (y >> 1) & 0x7FFF, zz = (z >> 1) & 0x7FFF;
+  const int16_t N = 0x8000;
+  int16_t X1 = noiseLerp15by16(noiseGrad16(P[AA], xx, yy, zz),         noiseGrad16(P[BA], xx - N, yy, zz), u);
+  int16_t X2 = noiseLerp15by16(noiseGrad16(P[AB], xx, yy - N, zz),     noiseGrad16(P[BB], xx - N, yy - N, zz), u);
+  int16_t X3 = noiseLerp15by16(noiseGrad16(P[AA + 1], xx, yy, zz - N), noiseGrad16(P[BA + 1], xx - N, yy, zz - N), u);
+  int16_t X4 = noiseLerp15by16(noiseGrad16(P[AB + 1], xx, yy - N, zz - N), noiseGrad16(P[BB + 1], xx - N, yy - N, zz - N), u);
+  return noiseLerp15by16(noiseLerp15by16(X1, X2, v), noiseLerp15by16(X3, X4, v), w);
+}
+
+inline uint16_t inoise16(uint32_t x, uint32_t y, uint32_t z) {
+  int32_t ans = inoise16_raw(x, y, z) + 19052L;
+  uint32_t pan = ans < 0 ? 0 : uint32_t(ans) * 220L >> 7;
+  return pan > 65535 ? 65535 : pan;
+}
+inline uint16_t inoise16(uint32_t x, uint32_t y) { return inoise16(x, y, 0); }
+inline uint16_t inoise16(uint32_t x) { return inoise16(x, 0, 0); }
+
+inline int8_t inoise8_raw(uint16_t x, uint16_t y, uint16_t z) { return inoise16_raw(uint32_t(x) << 8, uint32_t(y) << 8, uint32_t(z) << 8) >> 8; }
+inline uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z) {
+  int8_t n = inoise8_raw(x, y, z) + 64;
+  return qadd8(n, n);
+}
+inline uint8_t inoise8(uint16_t x, uint16_t y) { return inoise8(x, y, 0); }
+inline uint8_t inoise8(uint16_t x) { return inoise8(x, 0, 0); }
+
+// colors
+
+struct CHSV {
+  union {
+    struct {
+      union { uint8_t hue; uint8_t h; };
+      union { uint8_t saturation; uint8_t sat; uint8_t s; };
+      union { uint8_t value; uint8_t val; uint8_t v; };
+    };
+    uint8_t raw[3];
+  };
+  CHSV() {}
+  CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+  uint8_t &operator[](uint8_t x) { return raw[x]; }
+};
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb);
+
+struct CRGB {
+  union {
+    struct {
+      union { uint8_t r; uint8_t red; };
+      union { uint8_t g; uint8_t green; };
+      union { uint8_t b; uint8_t blue; };
+    };
+    uint8_t raw[3];
+  };
+  CRGB() {}
+  CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+  CRGB(const CHSV &rhs) { hsv2rgb_rainbow(rhs, *this); }
+  uint8_t &operator[](uint8_t x) { return raw[x]; }
+  const uint8_t &operator[](uint8_t x) const { return raw[x]; }
+  CRGB &operator=(const CHSV &rhs) { hsv2rgb_rainbow(rhs, *this); return *this; }
+  CRGB &operator=(uint32_t colorcode) { r = colorcode >> 16; g = colorcode >> 8; b = colorcode; return *this; }
+  CRGB &operator+=(const CRGB &rhs) { r = qadd8(r, rhs.r); g = qadd8(g, rhs.g); b = qadd8(b, rhs.b); return *this; }
+  CRGB &operator|=(const CRGB &rhs) { r = max(r, rhs.r); g = max(g, rhs.g); b = max(b, rhs.b); return *this; }
+  CRGB &nscale8(uint8_t scale) { r = scale8(r, scale); g = scale8(g, scale); b = scale8(b, scale); return *this; }
+  CRGB &nscale8_video(uint8_t scale) { r = scale8_video(r, scale); g = scale8_video(g, scale); b = scale8_video(b, scale); return *this; }
+  CRGB &fadeToBlackBy(uint8_t fadefactor) { return nscale8(255 - fadefactor); }
+  uint8_t getAverageLight() const { return scale8(r, 85) + scale8(g, 85) + scale8(b, 85); }
+  explicit operator bool() const { return r || g || b; }
+  explicit operator uint32_t() const { return uint32_t(0xff000000) | (uint32_t{r} << 16) | (uint32_t{g} << 8) | uint32_t{b}; }
+  typedef enum {
+    Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x008000, Blue = 0x0000FF, Yellow = 0xFFFF00,
+    Orange = 0xFFA500, DarkOrange = 0xFF8C00, Purple = 0x800080, Gray = 0x808080, Grey = 0x808080, DarkBlue = 0x00008B,
+    DarkGreen = 0x006400, DarkRed = 0x8B0000, Cyan = 0x00FFFF, Magenta = 0xFF00FF, Pink = 0xFFC0CB, Amethyst = 0x9966CC,
+    SkyBlue = 0x87CEEB, Aqua = 0x00FFFF, DeepSkyBlue = 0x00BFFF, Navy = 0x000080, LightBlue = 0xADD8E6, Gold = 0xFFD700,
+    Teal = 0x008080, Lime = 0x00FF00, Violet = 0xEE82EE, Brown = 0xA52A2A, Crimson = 0xDC143C, Chartreuse = 0x7FFF00,
+    Amber = 0xFFBF00, FairyLight = 0xFFE42D, LightGrey = 0xD3D3D3, DarkViolet = 0x9400D3, ForestGreen = 0x228B22,
+    LawnGreen = 0x7CFC00, OrangeRed = 0xFF4500, Salmon = 0xFA8072, Tomato = 0xFF6347, Maroon = 0x800000, Olive = 0x808000,
+    SeaGreen = 0x2E8B57, MediumBlue = 0x0000CD, DarkSlateGray = 0x2F4F4F, Indigo = 0x4B0082, HotPink = 0xFF69B4,
+    Coral = 0xFF7F50, LightYellow = 0xFFFFE0, Snow = 0xFFFAFA, Silver = 0xC0C0C0, DarkGray = 0xA9A9A9, DimGray = 0x696969,
+    SlateGray = 0x708090, DarkOliveGreen = 0x556B2F, GreenYellow = 0xADFF2F, Wheat = 0xF5DEB3, MidnightBlue = 0x191970,
+    CadetBlue = 0x5F9EA0, DarkCyan = 0x008B8B, CornflowerBlue = 0x6495ED, Aquamarine = 0x7FFFD4, LightSkyBlue = 0x87CEFA,
+    OliveDrab = 0x6B8E23, MediumAquamarine = 0x66CDAA, LimeGreen = 0x32CD32, YellowGreen = 0x9ACD32, LightGreen = 0x90EE90
+  } HTMLColorCode;
+};
+
+inline bool operator==(const CRGB &a, const CRGB &b) { return a.r == b.r && a.g == b.g && a.b == b.b; }
+inline bool operator!=(const CRGB &a, const CRGB &b) { return !(a == b); }
+inline CRGB operator+(const CRGB &a, const CRGB &b) { return CRGB(qadd8(a.r, b.r), qadd8(a.g, b.g), qadd8(a.b, b.b)); }
+
+// FastLED "rainbow" hue mapping: 8 sections of 32 hues, yellow gets extra width
+inline void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb) {
+  uint8_t hue = hsv.hue, sat = hsv.sat, val = hsv.val;
+  uint8_t offset8 = (hue & 0x1F) << 3;
+  uint8_t third = scale8(offset8, 256 / 3);
+  uint8_t twothirds = scale8(offset8, 256 * 2 / 3);
+  uint8_t r, g, b;
+  switch (hue >> 5) {
+    case 0:  r = 255 - third;     g = third;            b = 0;               break; // R -> O
+    case 1:  r = 171;             g = 85 + third;       b = 0;               break; // O -> Y
+    case 2:  r = 171 - twothirds; g = 170 + third;      b = 0;               break; // Y -> G
+    case 3:  r = 0;               g = 255 - third;      b = third;           break; // G -> A
+    case 4:  r = 0;               g = 171 - twothirds;  b = 85 + twothirds;  break; // A -> B
+    case 5:  r = third;           g = 0;                b = 255 - third;     break; // B -> P
+    case 6:  r = 85 + third;      g = 0;                b = 171 - third;     break; // P -> K
+    default: r = 170 + third;     g = 0;                b = 85 - third;      break; // K -> R
+  }
+  if (sat != 255) {
+    if (sat == 0) r = g = b = 255;
+    else {
+      uint8_t desat = 255 - sat;
+      desat = scale8_video(desat, desat);
+      uint8_t satscale = 255 - desat;
+      r = scale8(r, satscale) + desat;
+      g = scale8(g, satscale) + desat;
+      b = scale8(b, satscale) + desat;
+    }
+  }
+  if (val != 255) {
+    val = scale8_video(val, val);
+    r = scale8(r, val);
+    g = scale8(g, val);
+    b = scale8(b, val);
+  }
+  rgb.r = r; rgb.g = g; rgb.b = b;
+}
+
+inline CRGB HeatColor(uint8_t temperature) {
+  uint8_t t192 = scale8_video(temperature, 191);
+  uint8_t heatramp = (t192 & 0x3F) << 2;
+  if (t192 & 0x80) return CRGB(255, 255, heatramp);
+  if (t192 & 0x40) return CRGB(255, heatramp, 0);
+  return CRGB(heatramp, 0, 0);
+}
+
+// palettes
+
+typedef const uint8_t TProgmemRGBGradientPalette_byte;
+typedef const TProgmemRGBGradientPalette_byte *TProgmemRGBGradientPalette_bytes;
+typedef uint32_t TProgmemRGBPalette16[16];
+typedef union { struct { uint8_t index; uint8_t r; uint8_t g; uint8_t b; }; uint32_t dword; uint8_t bytes[4]; } TRGBGradientPaletteEntryUnion;
+#define DEFINE_GRADIENT_PALETTE(X) extern const TProgmemRGBGradientPalette_byte X[] PROGMEM =
+
+inline void fill_gradient_RGB(CRGB *leds, uint16_t startpos, CRGB startcolor, uint16_t endpos, CRGB endcolor) {
+  if (endpos < startpos) {
+    std::swap(endpos, startpos);
+    std::swap(endcolor, startcolor);
+  }
+  uint16_t dist = endpos - startpos;
+  for (uint16_t i = 0; i <= dist; i++) {
+    uint8_t f = dist ? (i * 255) / dist : 0;
+    leds[startpos + i] = CRGB(lerp8by8(startcolor.r, endcolor.r, f), lerp8by8(startcolor.g, endcolor.g, f), lerp8by8(startcolor.b, endcolor.b, f));
+  }
+}
+
+class CRGBPalette16 {
+  public:
+    CRGB entries[16];
+    CRGBPalette16() {}
+    CRGBPalette16(const CRGB &c00, const CRGB &c01, const CRGB &c02, const CRGB &c03, const CRGB &c04, const CRGB &c05, const CRGB &c06, const CRGB &c07,
+                  const CRGB &c08, const CRGB &c09, const CRGB &c10, const CRGB &c11, const CRGB &c12, const CRGB &c13, const CRGB &c14, const CRGB &c15) {
+      const CRGB *c[16] = { &c00, &c01, &c02, &c03, &c04, &c05, &c06, &c07, &c08, &c09, &c10, &c11, &c12, &c13, &c14, &c15 };
+      for (int i = 0; i < 16; i++) entries[i] = *c[i];
+    }
+    CRGBPalette16(const TProgmemRGBPalette16 &rhs) { *this = rhs; }
+    CRGBPalette16(const CRGB &c1) { for (int i = 0; i < 16; i++) entries[i] = c1; }
+    CRGBPalette16(const CRGB &c1, const CRGB &c2) { fill_gradient_RGB(entries, 0, c1, 15, c2); }
+    CRGBPalette16(const CRGB &c1, const CRGB &c2, const CRGB &c3) {
+      fill_gradient_RGB(entries, 0, c1, 7, c2);
+      fill_gradient_RGB(entries, 8, c2, 15, c3);
+    }
+    CRGBPalette16(const CRGB &c1, const CRGB &c2, const CRGB &c3, const CRGB &c4) {
+      fill_gradient_RGB(entries, 0, c1, 5, c2);
+      fill_gradient_RGB(entries, 5, c2, 10, c3);
+      fill_gradient_RGB(entries, 10, c3, 15, c4);
+    }
+    // blends in RGB instead of HSV
+    CRGBPalette16(const CHSV &c1, const CHSV &c2, const CHSV &c3, const CHSV &c4) : CRGBPalette16(CRGB(c1), CRGB(c2), CRGB(c3), CRGB(c4)) {}
+    CRGBPalette16(TProgmemRGBGradientPalette_bytes progpal) { loadDynamicGradientPalette(progpal); }
+    CRGBPalette16 &operator=(const TProgmemRGBPalette16 &rhs) {
+      for (int i = 0; i < 16; i++) entries[i] = CRGB(rhs[i]);
+      return *this;
+    }
+    CRGBPalette16 &operator=(TProgmemRGBGradientPalette_bytes progpal) { return loadDynamicGradientPalette(progpal); }
+    CRGBPalette16 &loadDynamicGradientPalette(const uint8_t *gpal) {
+      const TRGBGradientPaletteEntryUnion *ent = (const TRGBGradientPaletteEntryUnion *)gpal;
+      CRGB rgbstart(ent->r, ent->g, ent->b);
+      int indexstart = 0, lastSlotUsed = -1;
+      while (indexstart < 255) {
+        ent++;
+        int indexend = ent->index;
+        CRGB rgbend(ent->r, ent->g, ent->b);
+        int istart8 = indexstart / 16, iend8 = indexend / 16;
+        if (istart8 <= lastSlotUsed && lastSlotUsed < 15) {
+          istart8 = lastSlotUsed + 1;
+          if (iend8 < istart8) iend8 = istart8;
+        }
+        lastSlotUsed = iend8;
+        fill_gradient_RGB(entries, istart8, rgbstart, iend8, rgbend);
+        indexstart = indexend;
+        rgbstart = rgbend;
+      }
+      return *this;
+    }
+    bool operator==(const CRGBPalette16 &rhs) const { return !memcmp(entries, rhs.entries, sizeof(entries)); }
+    bool operator!=(const CRGBPalette16 &rhs) const { return !(*this == rhs); }
+    CRGB &operator[](uint8_t x) { return entries[x]; }
+    const CRGB &operator[](uint8_t x) const { return entries[x]; }
+    operator CRGB*() { return entries; }
+};
+
+inline CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 255, TBlendType blendType = LINEARBLEND) {
+  if (blendType == LINEARBLEND_NOWRAP) index = map8(index, 0, 239);
+  uint8_t hi4 = index >> 4, lo4 = index & 0x0F;
+  CRGB c = pal[hi4];
+  if (lo4 && blendType != NOBLEND) {
+    const CRGB &c2 = pal[(hi4 + 1) & 0x0F];
+    uint8_t f2 = lo4 << 4, f1 = 255 - f2;
+    c = CRGB(scale8(c.r, f1) + scale8(c2.r, f2), scale8(c.g, f1) + scale8(c2.g, f2), scale8(c.b, f1) + scale8(c2.b, f2));
+  }
+  if (brightness != 255) c.nscale8_video(brightness);
+  return c;
+}
+
+// moves every channel of current one step towards target, at most maxChanges steps per call
+inline void nblendPaletteTowardPalette(CRGBPalette16 &current, CRGBPalette16 &target, uint8_t maxChanges = 24) {
+  uint8_t *p1 = (uint8_t *)current.entries, *p2 = (uint8_t *)target.entries;
+  uint8_t changes = 0;
+  for (size_t i = 0; i < sizeof(current.entries) && changes < maxChanges; i++) {
+    if (p1[i] < p2[i]) { p1[i]++; changes++; }
+    else if (p1[i] > p2[i]) { p1[i]--; changes++; if (p1[i] > p2[i]) p1[i]--; }
+  }
+}
+
+inline const TProgmemRGBPalette16 CloudColors_p = {
+  CRGB::Blue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue,
+  CRGB::Blue, CRGB::DarkBlue, CRGB::SkyBlue, CRGB::SkyBlue, CRGB::LightBlue, CRGB::White, CRGB::LightBlue, CRGB::SkyBlue
+};
+inline const TProgmemRGBPalette16 LavaColors_p = {
+  CRGB::Black, CRGB::Maroon, CRGB::Black, CRGB::Maroon, CRGB::DarkRed, CRGB::DarkRed, CRGB::Maroon, CRGB::DarkRed,
+  CRGB::DarkRed, CRGB::DarkRed, CRGB::Red, CRGB::Orange, CRGB::White, CRGB::Orange, CRGB::Red, CRGB::DarkRed
+};
+inline const TProgmemRGBPalette16 OceanColors_p = {
+  CRGB::MidnightBlue, CRGB::DarkBlue, CRGB::MidnightBlue, CRGB::Navy, CRGB::DarkBlue, CRGB::MediumBlue, CRGB::SeaGreen, CRGB::Teal,
+  CRGB::CadetBlue, CRGB::Blue, CRGB::DarkCyan, CRGB::CornflowerBlue, CRGB::Aquamarine, CRGB::SeaGreen, CRGB::Aqua, CRGB::LightSkyBlue
+};
+inline const TProgmemRGBPalette16 ForestColors_p = {
+  CRGB::DarkGreen, CRGB::DarkGreen, CRGB::DarkOliveGreen, CRGB::DarkGreen, CRGB::Green, CRGB::ForestGreen, CRGB::OliveDrab, CRGB::Green,
+  CRGB::SeaGreen, CRGB::MediumAquamarine, CRGB::LimeGreen, CRGB::YellowGreen, CRGB::LightGreen, CRGB::LawnGreen, CRGB::MediumAquamarine, CRGB::ForestGreen
+};
+inline const TProgmemRGBPalette16 RainbowColors_p = {
+  0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00, 0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+  0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5, 0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B
+};
+inline const TProgmemRGBPalette16 RainbowStripeColors_p = {
+  0xFF0000, 0x000000, 0xAB5500, 0x000000, 0xABAB00, 0x000000, 0x00FF00, 0x000000,
+  0x00AB55, 0x000000, 0x0000FF, 0x000000, 0x5500AB, 0x000000, 0xAB0055, 0x000000
+};
+inline const TProgmemRGBPalette16 PartyColors_p = {
+  0x5500AB, 0x84007C, 0xB5004B, 0xE5001B, 0xE81700, 0xB84700, 0xAB7700, 0xABAB00,
+  0xAB5500, 0xDD2200, 0xF2000E, 0xC2003E, 0x8F0071, 0x5F00A1, 0x2F00D0, 0x0007F9
+};
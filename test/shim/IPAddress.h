@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+class IPAddress {
+  public:
+    IPAddress() : _addr{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr{a, b, c, d} {}
+    IPAddress(uint32_t a) { memcpy(_addr, &a, 4); } // network byte order, like the ESP cores
+    operator uint32_t() const { uint32_t a; memcpy(&a, _addr, 4); return a; }
+    uint8_t operator[](int i) const { return _addr[i]; }
+    uint8_t &operator[](int i) { return _addr[i]; }
+    bool operator==(const IPAddress &o) const { return !memcmp(_addr, o._addr, 4); }
+    bool operator!=(const IPAddress &o) const { return !(*this == o); }
+  private:
+    uint8_t _addr[4];
+};
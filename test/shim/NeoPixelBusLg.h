@@ -0,0 +1,123 @@
+#pragma once
+/*
+ * Memory-backed stand-in for NeoPixelBus in the native (host) test environment.
+ * All bus types of bus_wrapper.h keep their pixels in RAM and Show() does not transmit.
+ */
+
+#include <Arduino.h>
+
+struct RgbwColor;
+struct RgbColor {
+  uint8_t R, G, B;
+  RgbColor(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0) : R(r), G(g), B(b) {}
+  RgbColor(const RgbwColor &c);
+};
+struct RgbwColor {
+  uint8_t R, G, B, W;
+  RgbwColor(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0, uint8_t w = 0) : R(r), G(g), B(b), W(w) {}
+  RgbwColor(const RgbColor &c) : R(c.R), G(c.G), B(c.B), W(0) {}
+};
+struct Rgb48Color {
+  uint16_t R, G, B;
+  Rgb48Color(uint16_t r = 0, uint16_t g = 0, uint16_t b = 0) : R(r), G(g), B(b) {}
+  Rgb48Color(const RgbColor &c) : R(c.R * 257), G(c.G * 257), B(c.B * 257) {}
+  Rgb48Color(const RgbwColor &c) : R(c.R * 257), G(c.G * 257), B(c.B * 257) {}
+  operator RgbwColor() const { return RgbwColor(R >> 8, G >> 8, B >> 8); }
+};
+struct Rgbw64Color {
+  uint16_t R, G, B, W;
+  Rgbw64Color(uint16_t r = 0, uint16_t g = 0, uint16_t b = 0, uint16_t w = 0) : R(r), G(g), B(b), W(w) {}
+  Rgbw64Color(const RgbwColor &c) : R(c.R * 257), G(c.G * 257), B(c.B * 257), W(c.W * 257) {}
+  operator RgbwColor() const { return RgbwColor(R >> 8, G >> 8, B >> 8, W >> 8); }
+};
+inline RgbColor::RgbColor(const RgbwColor &c) : R(c.R), G(c.G), B(c.B) {}
+
+enum NeoBusChannel { NeoBusChannel_0, NeoBusChannel_1, NeoBusChannel_2, NeoBusChannel_3, NeoBusChannel_4, NeoBusChannel_5, NeoBusChannel_6, NeoBusChannel_7 };
+struct NeoSpiSettings { NeoSpiSettings(uint32_t) {} };
+struct NeoTm1814Settings { NeoTm1814Settings(uint16_t, uint16_t, uint16_t, uint16_t) {} };
+struct NeoGammaNullMethod {};
+
+// color features and output methods only select the bus type
+struct DotStarBgrFeature {};
+struct DotStarEsp32DmaHspi5MhzMethod {};
+struct DotStarEsp32HspiHzMethod {};
+struct DotStarMethod {};
+struct DotStarSpiHzMethod {};
+struct Lpd6803GrbFeature {};
+struct Lpd6803Method {};
+struct Lpd6803SpiHzMethod {};
+struct Lpd8806GrbFeature {};
+struct Lpd8806Method {};
+struct Lpd8806SpiHzMethod {};
+struct NeoBrgFeature {};
+struct NeoEsp32BitBang400KbpsMethod {};
+struct NeoEsp32BitBang800KbpsMethod {};
+struct NeoEsp32I2s0400KbpsMethod {};
+struct NeoEsp32I2s0800KbpsMethod {};
+struct NeoEsp32I2s0Tm1814Method {};
+struct NeoEsp32I2s0Tm1829Method {};
+struct NeoEsp32I2s1400KbpsMethod {};
+struct NeoEsp32I2s1800KbpsMethod {};
+struct NeoEsp32I2s1Tm1814Method {};
+struct NeoEsp32I2s1Tm1829Method {};
+struct NeoEsp32RmtN400KbpsMethod {};
+struct NeoEsp32RmtNTm1814Method {};
+struct NeoEsp32RmtNTm1829Method {};
+struct NeoEsp32RmtNWs2812xMethod {};
+struct NeoEsp8266BitBang400KbpsMethod {};
+struct NeoEsp8266BitBang800KbpsMethod {};
+struct NeoEsp8266BitBangTm1814Method {};
+struct NeoEsp8266BitBangTm1829Method {};
+struct NeoEsp8266Dma400KbpsMethod {};
+struct NeoEsp8266Dma800KbpsMethod {};
+struct NeoEsp8266DmaTm1814Method {};
+struct NeoEsp8266DmaTm1829Method {};
+struct NeoEsp8266Uart0400KbpsMethod {};
+struct NeoEsp8266Uart0Tm1814Method {};
+struct NeoEsp8266Uart0Tm1829Method {};
+struct NeoEsp8266Uart0Ws2813Method {};
+struct NeoEsp8266Uart1400KbpsMethod {};
+struct NeoEsp8266Uart1Tm1814Method {};
+struct NeoEsp8266Uart1Tm1829Method {};
+struct NeoEsp8266Uart1Ws2813Method {};
+struct NeoGrbFeature {};
+struct NeoGrbwFeature {};
+struct NeoRbgFeature {};
+struct NeoRgbUcs8903Feature {};
+struct NeoRgbwUcs8904Feature {};
+struct NeoWrgbTm1814Feature {};
+struct P9813BgrFeature {};
+struct P9813Method {};
+struct P9813SpiHzMethod {};
+struct Ws2801Method {};
+struct Ws2801SpiHzMethod {};
+
+template<typename T_COLOR_FEATURE, typename T_METHOD, typename T_GAMMA = NeoGammaNullMethod> class NeoPixelBusLg {
+  public:
+    NeoPixelBusLg(uint16_t countPixels, uint8_t pinClock, uint8_t pinData) : NeoPixelBusLg(countPixels) {}
+    NeoPixelBusLg(uint16_t countPixels, uint8_t pin, NeoBusChannel channel) : NeoPixelBusLg(countPixels) {}
+    NeoPixelBusLg(uint16_t countPixels, uint8_t pin) : NeoPixelBusLg(countPixels) {}
+    explicit NeoPixelBusLg(uint16_t countPixels) : _count(countPixels), _pixels(new RgbwColor[countPixels]) {}
+    ~NeoPixelBusLg() { delete[] _pixels; }
+    void Begin() {}
+    void Begin(int8_t sck, int8_t miso, int8_t mosi, int8_t ss) {}
+    void Show(bool maintainBufferConsistency = true) {}
+    bool CanShow() const { return true; }
+    void SetLuminance(uint8_t luminance) { _luminance = luminance; }
+    uint8_t GetLuminance() const { return _luminance; }
+    // dimmed on write like NeoPixelBusLg
+    void SetPixelColor(uint16_t i, const RgbwColor &c) {
+      if (i >= _count) return;
+      _pixels[i] = RgbwColor(dim(c.R), dim(c.G), dim(c.B), dim(c.W));
+    }
+    RgbwColor GetPixelColor(uint16_t i) const { return i < _count ? _pixels[i] : RgbwColor(); }
+    void SetMethodSettings(const NeoSpiSettings &) {}
+    void SetPixelSettings(const NeoTm1814Settings &) {}
+    void ClearTo(const RgbwColor &c) { for (uint16_t i = 0; i < _count; i++) _pixels[i] = c; }
+    uint16_t PixelCount() const { return _count; }
+  private:
+    uint8_t dim(uint8_t v) const { return (v * (_luminance + 1)) >> 8; }
+    uint16_t   _count;
+    RgbwColor *_pixels;
+    uint8_t    _luminance = 255;
+};
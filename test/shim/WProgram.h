@@ -0,0 +1,3 @@
+#pragma once
+// pre Arduino 1.0 core header, used by the vendored TimeLib
+#include <Arduino.h>
@@ -0,0 +1,44 @@
+#pragma once
+/*
+ * WiFiUDP over a host socket: every packet goes to 127.0.0.1 at the requested port, whatever the address,
+ * so a test can receive what the firmware sends by binding that port (loopback). Nothing is ever received.
+ */
+
+#include <IPAddress.h>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+class WiFiUDP {
+  public:
+    ~WiFiUDP() { if (_fd >= 0) close(_fd); }
+    uint8_t begin(uint16_t port) { return 1; }
+    uint8_t beginMulticast(IPAddress ip, uint16_t port) { return 1; }
+    void stop() {}
+    int beginPacket(IPAddress ip, uint16_t port) {
+      if (_fd < 0 && (_fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) return 0;
+      _port = port;
+      _packet.clear();
+      return 1;
+    }
+    size_t write(uint8_t b) { _packet.push_back(b); return 1; }
+    size_t write(const uint8_t *buf, size_t len) { _packet.insert(_packet.end(), buf, buf + len); return len; }
+    int endPacket() {
+      sockaddr_in to = {};
+      to.sin_family = AF_INET;
+      to.sin_port = htons(_port);
+      to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      return sendto(_fd, _packet.data(), _packet.size(), 0, (sockaddr *)&to, sizeof(to)) == ssize_t(_packet.size());
+    }
+    int parsePacket() { return 0; }
+    int read(uint8_t *buf, size_t len) { return 0; }
+    void flush() {}
+    IPAddress remoteIP() { return IPAddress(); }
+    uint16_t remotePort() { return 0; }
+  private:
+    int _fd = -1;
+    uint16_t _port = 0;
+    std::vector<uint8_t> _packet;
+};
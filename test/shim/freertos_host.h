@@ -0,0 +1,82 @@
+#pragma once
+/*
+ * FreeRTOS task API used by the ESP32 output tasks (bus_manager.cpp), backed by std::thread for native tests.
+ * Every task is a thread; direct-to-task notifications are a counter with a condition variable.
+ * vTaskDelete() ends a task blocked in ulTaskNotifyTake() by unwinding its thread, tasks never return on their own.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+typedef int           BaseType_t;
+typedef unsigned int  UBaseType_t;
+typedef uint32_t      TickType_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdFALSE             0
+#define pdTRUE              1
+#define pdPASS              1
+#define pdFAIL              0
+#define portMAX_DELAY       0xFFFFFFFFUL
+#define portTICK_PERIOD_MS  1
+#define tskNO_AFFINITY      0x7FFFFFFF
+
+struct HostTask {
+  std::thread             thread;
+  std::mutex              lock;
+  std::condition_variable wake;
+  uint32_t                notifications = 0;
+  bool                    deleted = false;
+};
+typedef HostTask* TaskHandle_t;
+
+struct HostTaskDeleted {}; // thrown inside the task thread to unwind it
+inline thread_local HostTask *hostCurrentTask = nullptr;
+inline std::atomic<BaseType_t> hostCreateResult{pdPASS}; // tests set pdFAIL to simulate out of memory
+
+inline BaseType_t xPortGetCoreID() { return hostCurrentTask ? 1 : 0; } // main loop runs on core 0
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *handle, BaseType_t core) {
+  if (hostCreateResult != pdPASS) return hostCreateResult;
+  HostTask *task = new HostTask;
+  task->thread = std::thread([task, fn, arg] {
+    hostCurrentTask = task;
+    try { fn(arg); } catch (const HostTaskDeleted &) {}
+  });
+  if (handle) *handle = task;
+  return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t task) {
+  if (task == nullptr) return;
+  {
+    std::lock_guard<std::mutex> l(task->lock);
+    task->deleted = true;
+  }
+  task->wake.notify_one();
+  task->thread.join();
+  delete task;
+}
+
+inline void xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> l(task->lock);
+    task->notifications++;
+  }
+  task->wake.notify_one();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  HostTask *task = hostCurrentTask;
+  std::unique_lock<std::mutex> l(task->lock);
+  auto ready = [task] { return task->notifications || task->deleted; };
+  if (ticks == portMAX_DELAY) task->wake.wait(l, ready);
+  else task->wake.wait_for(l, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), ready);
+  if (task->deleted) throw HostTaskDeleted();
+  uint32_t value = task->notifications;
+  if (value) task->notifications = clearOnExit ? 0 : value - 1;
+  return value;
+}
@@ -0,0 +1,94 @@
+#pragma once
+/*
+ * Stand-in for wled.h when the effect engine (FX.cpp, FX_fcn.cpp, FX_2Dfcn.cpp, bus_manager.cpp) is compiled
+ * into a native test. The firmware headers provide all declarations, this file only replaces the platform
+ * headers and defines the wled.h globals these sources use. Unless a test compiles udp.cpp (wled_net_host.h),
+ * it stubs the realtime*() functions and a DDP bus is a memory-only bus.
+ * Include it once, from the test translation unit, before the wled00 sources.
+ */
+
+#define WLED_H
+#ifndef ARDUINO_ARCH_ESP32 // the host builds the ESP32 variant
+  #define ARDUINO_ARCH_ESP32
+  #define ESP32
+#endif
+#define WLED_DISABLE_ALEXA
+#define ASYNC_JSON_H_ // AsyncJson-v6.h needs the web server, only ArduinoJson is used here
+
+#include <Arduino.h>
+#include "freertos_host.h"
+#include <IPAddress.h>
+#include <WiFiUdp.h>
+#include <ESPAsyncWebServer.h>
+#include "src/dependencies/time/TimeLib.h"
+#include "src/dependencies/toki/Toki.h"
+#include "src/dependencies/e131/ESPAsyncE131.h"
+#include "src/dependencies/json/ArduinoJson-v6.h"
+
+typedef int WiFiEvent_t; // only referenced by declarations in fcn_declare.h
+
+#include "const.h"
+#include "fcn_declare.h"
+#include "NodeStruct.h"
+#include "pin_manager.h"
+#include "bus_wrapper.h"
+#include "bus_manager.h"
+#include "FX.h"
+
+#define RGBW32(r,g,b,w) (uint32_t((byte(w) << 24) | (byte(r) << 16) | (byte(g) << 8) | (byte(b))))
+#define R(c) (byte((c) >> 16))
+#define G(c) (byte((c) >> 8))
+#define B(c) (byte(c))
+#define W(c) (byte((c) >> 24))
+
+#define SET_F(x) (const char*)F(x)
+
+#define DEBUG_PRINT(x)
+#define DEBUG_PRINTLN(x)
+#define DEBUG_PRINTF(x...)
+
+// no file system: ledmaps and custom palettes are never found
+struct HostFS {
+  bool exists(const char *) { return false; }
+};
+inline HostFS WLED_FS;
+
+struct HostESP {
+  uint32_t getFreeHeap() { return 1 << 20; }
+};
+inline HostESP ESP;
+
+// wled.h globals
+inline bool useGlobalLedBuffer = true;
+inline bool autoSegments       = false;
+inline bool correctWB          = false;
+inline bool cctFromRgb         = false;
+inline bool gammaCorrectCol    = true;
+inline bool gammaCorrectBri    = false;
+inline bool fadeTransition     = true;
+inline bool stateChanged       = false;
+inline byte lastRandomIndex    = 0;
+inline uint8_t randomPaletteChangeTime = 5;
+inline time_t localTime        = 0;
+inline bool useAMPM            = false;
+inline bool doInitBusses       = false;
+inline int8_t loadLedmap       = -1;
+inline uint16_t ledMaps        = 0;
+inline char *ledmapNames[WLED_MAX_LEDMAPS-1] = {nullptr};
+inline BusManager busses;
+inline WS2812FX strip;
+inline UsermodManager usermods;
+inline StaticJsonDocument<JSON_BUFFER_SIZE> doc;
+inline volatile uint8_t jsonBufferLock = 0;
+inline JsonDocument *fileDoc;
+inline char *obuf;
+inline uint16_t olen = 0;
+inline char serverDescription[33] = "WLED";
+inline char settingsPIN[5] = "";
+inline bool correctPIN = true;
+inline unsigned long lastEditTime = 0;
+inline String escapedMac;
+
+// file.cpp and wled_server.cpp are not compiled
+inline bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest) { return false; }
+inline void createEditHandler(bool enable) {}
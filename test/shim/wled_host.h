@@ -0,0 +1,36 @@
+#pragma once
+/*
+ * Stand-in for wled.h when firmware sources are compiled into a native test.
+ * Defining the include guard keeps the wled00 sources from pulling in the full firmware headers,
+ * so only the globals the kernels under test use are provided here, their declarations come from the firmware headers.
+ * Each test is a single translation unit that includes the sources it tests.
+ */
+
+#define WLED_H
+#define WLED_DISABLE_HUESYNC
+
+#include <Arduino.h>
+
+#define RGBW32(r,g,b,w) (uint32_t((byte(w) << 24) | (byte(r) << 16) | (byte(g) << 8) | (byte(b))))
+#define R(c) (byte((c) >> 16))
+#define G(c) (byte((c) >> 8))
+#define B(c) (byte(c))
+#define W(c) (byte((c) >> 24))
+
+// wled.h globals
+inline bool gammaCorrectCol = true;
+inline byte lastRandomIndex = 0;
+
+// strip.getMainSegment().get_random_wheel_index() used by setRandomColor()
+struct HostSegment {
+  uint8_t get_random_wheel_index(uint8_t pos) { return pos + 42; }
+};
+struct HostStrip {
+  HostSegment main;
+  HostSegment &getMainSegment() { return main; }
+};
+inline HostStrip strip;
+
+// fcn_declare.h declarations of the sources under test
+#include "colors.h"
+#include "wled_math.h"
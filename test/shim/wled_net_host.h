@@ -0,0 +1,75 @@
+#pragma once
+/*
+ * wled.h globals and network interface for compiling udp.cpp into a native test, on top of wled_fx_host.h.
+ * Tests including udp.cpp do not define the realtime*() stubs, packets go out through the WiFiUDP loopback
+ * (WiFiUdp.h). The notifier, realtime receiver and node list are compiled but not exercised.
+ */
+
+#include "wled_fx_host.h"
+
+#define VERSION 0 // build number in node info packets
+
+class NetworkClass {
+  public:
+    IPAddress localIP()    { return IPAddress(192, 168, 4, 2); }
+    IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+    IPAddress gatewayIP()  { return IPAddress(192, 168, 4, 1); }
+    bool isConnected()     { return true; }
+};
+inline NetworkClass Network;
+
+// wled.h globals used by udp.cpp
+inline bool interfacesInited   = true; // realtimeBroadcast() sends nothing before
+inline bool apActive           = false;
+inline byte bri                = 128;
+inline byte briT               = 0;
+inline byte briLast            = 128;
+inline uint16_t udpPort        = 21324;
+inline uint16_t udpPort2       = 65506;
+inline bool udpConnected       = false, udp2Connected = false, udpRgbConnected = false;
+inline WiFiUDP notifierUdp, rgbUdp, notifier2Udp;
+inline uint8_t syncGroups      = 0x01;
+inline uint8_t receiveGroups   = 0x01;
+inline uint8_t udpNumRetries   = 0;
+inline bool notifyDirect       = false;
+inline bool notifyButton       = false;
+inline bool notifyHue          = true;
+inline bool notifyAlexa        = false;
+inline bool receiveNotifications          = true;
+inline bool receiveNotificationBrightness = true;
+inline bool receiveNotificationColor      = true;
+inline bool receiveNotificationEffects    = true;
+inline bool receiveSegmentOptions         = false;
+inline bool receiveSegmentBounds          = false;
+inline bool receiveDirect      = true;
+inline unsigned long notificationSentTime = 0;
+inline byte notificationSentCallMode = CALL_MODE_INIT;
+inline uint8_t notificationCount = 0;
+inline bool nightlightActive   = false;
+inline byte nightlightDelayMins = 60;
+inline uint16_t transitionDelay = 750;
+inline uint16_t transitionDelayTemp = 750;
+inline byte realtimeMode       = REALTIME_MODE_INACTIVE;
+inline byte realtimeOverride   = REALTIME_OVERRIDE_NONE;
+inline IPAddress realtimeIP;
+inline unsigned long realtimeTimeout = 0;
+inline uint16_t realtimeTimeoutMs = 2500;
+inline uint8_t tpmPacketCount  = 0;
+inline uint16_t tpmPayloadFrameSize = 0;
+inline bool useMainSegmentOnly = false;
+inline int arlsOffset          = 0;
+inline bool arlsDisableGammaCorrection = true;
+inline bool arlsForceMaxBri    = false;
+inline bool e131NewData        = false;
+inline int16_t currentPlaylist = -1;
+inline NodesMap Nodes;
+inline bool nodeListEnabled    = true;
+inline Toki toki;
+
+// received notifications and API requests would land here (json.cpp, led.cpp, playlist.cpp, set.cpp)
+inline bool deserializeState(JsonObject root, byte callMode, byte presetId) { return false; }
+inline void stateUpdated(byte callMode) {}
+inline void updateInterfaces(uint8_t callMode) {}
+inline byte scaledBri(byte in) { return in; }
+inline void unloadPlaylist() {}
+inline bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply) { return false; }
@@ -0,0 +1,153 @@
+/*
+ * Pipelined bus output (WLED_ENABLE_PIPELINE) through the real BusManager: the main thread composites frames into
+ * DDP busses and calls show() (prepareFrame(), captureFrame(), handoff), outputLoop() runs on a std::thread task
+ * (freertos_host.h) and sends frameData()/frameBri() through realtimeBroadcast(), which checks every frame here.
+ * Render and send times follow the per LED cost model of test_pipeline and are spent sleeping.
+ */
+
+#define WLED_ENABLE_PIPELINE
+#include <unity.h>
+#include "wled_fx_host.h"
+#include "colors.cpp"
+#include "wled_math.cpp"
+#include "FX_fcn.cpp"
+#include "FX_2Dfcn.cpp"
+#include "FX.cpp"
+#include "bus_manager.cpp"
+#include "cellular.cpp"
+#include "pin_manager.cpp"
+#include "um_manager.cpp"
+#include "util.cpp"
+#include "src/dependencies/time/Time.cpp"
+#include "src/dependencies/time/DateStrings.cpp"
+
+#define RENDER_NS_PER_LED 2000 // effect rendering and compositing
+#define SEND_NS_PER_LED   3750 // 30us per WS2812 pixel, 8 RMT channels
+#define FPS_FRAMES        24
+#define NUM_BUSSES        2
+
+typedef std::chrono::steady_clock Clock;
+
+// the wire: bus b (IP 10.0.0.b+1) must send frame n, sent[b], with every channel of pixel p set to n + 3p + channel
+static std::atomic<unsigned> sent[NUM_BUSSES];
+static std::atomic<unsigned> errors;
+static std::atomic<unsigned> sentFromMain;
+static uint16_t busStart[NUM_BUSSES];
+static unsigned sendNsPerLed;
+static std::thread::id mainThread;
+
+static uint8_t frameBrightness(unsigned n) { return 1 + n % 255; }
+
+size_t realtimePacketSize(uint8_t type) { return 0; }
+void realtimePreparePacket(uint8_t type, NetOutput *out) {}
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW, NetOutput *out) {
+  Clock::time_point end = Clock::now() + std::chrono::nanoseconds(uint64_t(sendNsPerLed) * length);
+  unsigned b = client[3] - 1;
+  if (b >= NUM_BUSSES) { errors++; return 1; }
+  unsigned n = sent[b]++;
+  unsigned bad = bri != frameBrightness(n);
+  for (unsigned i = 0; i < length * 3u; i++) bad += buffer[i] != uint8_t(n + busStart[b] * 3 + i);
+  errors += bad;
+  if (std::this_thread::get_id() == mainThread) sentFromMain++;
+  std::this_thread::sleep_until(end);
+  return 0;
+}
+
+static void setupBusses(uint16_t leds) {
+  busses.removeAll();
+  for (uint8_t b = 0; b < NUM_BUSSES; b++) {
+    uint8_t pins[4] = {10, 0, 0, uint8_t(b + 1)};
+    busStart[b] = b * leds / NUM_BUSSES;
+    BusConfig bc = BusConfig(TYPE_NET_DDP_RGB, pins, busStart[b], (b + 1) * leds / NUM_BUSSES - busStart[b]);
+    TEST_ASSERT_TRUE(busses.add(bc) != -1 && busses.getBus(b)->isOk() && busses.getBus(b)->hasFrame());
+    sent[b] = 0;
+  }
+  errors = 0;
+  sentFromMain = 0;
+}
+
+// renders frame n into the busses, like strip.show() after the effects ran
+static void renderFrame(uint16_t leds, unsigned n, unsigned renderNs) {
+  static uint32_t pixels[8192];
+  Clock::time_point end = Clock::now() + std::chrono::nanoseconds(uint64_t(renderNs) * leds);
+  for (uint16_t p = 0; p < leds; p++) {
+    uint8_t c = n + p * 3;
+    pixels[p] = RGBW32(c, uint8_t(c + 1), uint8_t(c + 2), 0);
+  }
+  busses.setPixelColors(0, pixels, leds);
+  busses.setBrightness(frameBrightness(n));
+  std::this_thread::sleep_until(end);
+}
+
+// frames per second; serial waits until each frame was sent before rendering the next
+static double run(uint16_t leds, unsigned frames, unsigned renderNs, unsigned sendNs, bool serial) {
+  setupBusses(leds);
+  sendNsPerLed = sendNs;
+  Clock::time_point start = Clock::now();
+  for (unsigned n = 0; n < frames; n++) {
+    renderFrame(leds, n, renderNs);
+    busses.show();
+    if (serial) while (!busses.canAllShow()) yield();
+  }
+  while (!busses.canAllShow()) yield(); // last frame
+  double fps = frames / std::chrono::duration<double>(Clock::now() - start).count();
+  for (uint8_t b = 0; b < NUM_BUSSES; b++) TEST_ASSERT_EQUAL_UINT(frames, sent[b].load());
+  TEST_ASSERT_EQUAL_UINT(0, errors.load());
+  return fps;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_frames_complete_and_in_order(void) {
+  // no simulated work, the sides hand over as fast as possible
+  run(300, 20000, 0, 0, false);
+  TEST_ASSERT_EQUAL_UINT(0, sentFromMain.load());
+  // slow output: rendering runs ahead and must wait instead of overwriting the frame being sent
+  run(1000, 20, 0, 20000, false);
+  TEST_ASSERT_EQUAL_UINT(0, sentFromMain.load());
+}
+
+void test_busses_recreated(void) {
+  // removeAll() deletes the idle output task, the next show() creates one for the new busses
+  for (unsigned i = 0; i < 20; i++) run(64 + i, 50, 0, 0, false);
+}
+
+void test_task_creation_fails(void) {
+  // out of memory: show() sends from the main loop
+  hostCreateResult = pdFAIL;
+  run(300, 100, 0, 0, false);
+  TEST_ASSERT_EQUAL_UINT(100 * NUM_BUSSES, sentFromMain.load());
+  hostCreateResult = pdPASS;
+  run(300, 100, 0, 0, false);
+  TEST_ASSERT_EQUAL_UINT(0, sentFromMain.load());
+}
+
+void test_fps_serial_vs_pipelined(void) {
+  static const uint16_t sizes[] = { 1024, 4096, 8192 };
+  for (uint16_t leds : sizes) {
+    double serial    = run(leds, FPS_FRAMES, RENDER_NS_PER_LED, SEND_NS_PER_LED, true);
+    double pipelined = run(leds, FPS_FRAMES, RENDER_NS_PER_LED, SEND_NS_PER_LED, false);
+    char msg[80];
+    snprintf(msg, sizeof(msg), "%u LEDs: serial %.1f fps, pipelined %.1f fps (%.2fx)", leds, serial, pipelined, pipelined / serial);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(pipelined > serial * 1.2); // ideal (render + send) / send = 1.53
+  }
+}
+
+int main(int argc, char **argv) {
+  mainThread = std::this_thread::get_id();
+  std::thread([] { // a frame lost in the handoff blocks show() forever
+    std::this_thread::sleep_for(std::chrono::seconds(120));
+    fprintf(stderr, "timeout: output task stopped taking frames\n");
+    abort();
+  }).detach();
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_complete_and_in_order);
+  RUN_TEST(test_busses_recreated);
+  RUN_TEST(test_task_creation_fails);
+  RUN_TEST(test_fps_serial_vs_pipelined);
+  int failures = UNITY_END();
+  busses.removeAll();
+  return failures;
+}
@@ -0,0 +1,90 @@
+/*
+ * Bit packed cellular automata core (cellular.cpp) against a naive one cell at a time implementation
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "cellular.cpp"
+
+static uint32_t rng = 0xC0FFEE;
+static uint32_t rnd32() { rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return rng; }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void randomCells(uint32_t *cells, uint16_t cols, uint16_t rows) {
+  const uint16_t n = caWords(cols);
+  memset(cells, 0, n * rows * sizeof(uint32_t));
+  for (uint16_t y = 0; y < rows; y++)
+    for (uint16_t x = 0; x < cols; x++) if (rnd32() & 1) caSet(cells + y * n, x);
+}
+
+static bool lifeRef(const uint32_t *cur, uint16_t cols, uint16_t rows, uint16_t x, uint16_t y, uint16_t birth, uint16_t survive) {
+  const uint16_t n = caWords(cols);
+  unsigned count = 0;
+  for (int dy = -1; dy <= 1; dy++)
+    for (int dx = -1; dx <= 1; dx++) {
+      if (!dx && !dy) continue;
+      count += caGet(cur + ((y + dy + rows) % rows) * n, (x + dx + cols) % cols);
+    }
+  return caGet(cur + y * n, x) ? (survive >> count) & 1 : (birth >> count) & 1;
+}
+
+void test_life_matches_reference(void) {
+  static const uint16_t rules[][2] = { {1<<3, (1<<2)|(1<<3)}, {(1<<3)|(1<<6), (1<<2)|(1<<3)}, {0x1FF, 0}, {1<<1, 0x1FF} };
+  for (uint16_t cols = 1; cols <= 70; cols += (cols < 34 ? 1 : 5)) {
+    for (uint16_t rows = 1; rows <= 9; rows += 4) {
+      const uint16_t n = caWords(cols);
+      uint32_t cur[n * rows], next[n * rows];
+      for (auto &r : rules) {
+        randomCells(cur, cols, rows);
+        caStepLife(cur, next, cols, rows, r[0], r[1]);
+        for (uint16_t y = 0; y < rows; y++) {
+          for (uint16_t x = 0; x < cols; x++) TEST_ASSERT_EQUAL_INT(lifeRef(cur, cols, rows, x, y, r[0], r[1]), caGet(next + y * n, x));
+          if (cols & 31) TEST_ASSERT_EQUAL_HEX32(0, next[y * n + n - 1] >> (cols & 31)); // unused bits stay 0
+        }
+      }
+    }
+  }
+}
+
+void test_life_glider_wraps(void) {
+  const uint16_t cols = 40, rows = 12, n = caWords(cols);
+  uint32_t a[n * rows], b[n * rows];
+  memset(a, 0, sizeof(a));
+  static const uint8_t glider[][2] = { {1,0}, {2,1}, {0,2}, {1,2}, {2,2} };
+  for (auto &g : glider) caSet(a + g[1] * n, g[0] + 36); // crosses the word and torus boundaries
+  for (unsigned gen = 0; gen < 4 * 120; gen += 2) {        // moves by (1,1) every 4 generations
+    caStepLife(a, b, cols, rows, 1<<3, (1<<2)|(1<<3));
+    caStepLife(b, a, cols, rows, 1<<3, (1<<2)|(1<<3));
+  }
+  // 120 cells diagonally = 3 times around horizontally, 10 times vertically: back at the start
+  uint32_t start[n * rows];
+  memset(start, 0, sizeof(start));
+  for (auto &g : glider) caSet(start + g[1] * n, g[0] + 36);
+  TEST_ASSERT_EQUAL_MEMORY(start, a, sizeof(a));
+}
+
+void test_elementary_matches_reference(void) {
+  for (uint16_t cols = 1; cols <= 100; cols += 3) {
+    const uint16_t n = caWords(cols);
+    uint32_t cur[n], next[n];
+    for (unsigned rule = 0; rule < 256; rule += 15) {
+      randomCells(cur, cols, 1);
+      caStepElementary(cur, next, cols, rule);
+      for (uint16_t x = 0; x < cols; x++) {
+        unsigned p = (caGet(cur, (x + cols - 1) % cols) << 2) | (caGet(cur, x) << 1) | caGet(cur, (x + 1) % cols);
+        TEST_ASSERT_EQUAL_INT((rule >> p) & 1, caGet(next, x));
+      }
+      if (cols & 31) TEST_ASSERT_EQUAL_HEX32(0, next[n - 1] >> (cols & 31));
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_life_matches_reference);
+  RUN_TEST(test_life_glider_wraps);
+  RUN_TEST(test_elementary_matches_reference);
+  return UNITY_END();
+}
@@ -0,0 +1,272 @@
+/*
+ * Bulk color kernels of colors.cpp (SWAR helpers, scale/fade/blur, scaleChannels, upscaleBuffer)
+ * checked against plain per channel reference implementations, and timed against them.
+ */
+
+#include <unity.h>
+#include <time.h>
+#include "wled_host.h"
+#include "colors.cpp"
+
+#define BENCH_PIXELS 4096
+#define BENCH_RUNS   200
+
+static uint32_t rng = 0x12345678;
+static uint32_t rnd32() { rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return rng; }
+
+static uint8_t chan(uint32_t c, unsigned i) { return c >> (8*i); }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_swar_scale_matches_nscale8(void) {
+  for (unsigned scale = 0; scale < 256; scale++) {
+    for (unsigned v = 0; v < 256; v++) {
+      uint32_t c = RGBW32(v, 255 - v, v ^ 0x5A, (v * 7) & 0xFF);
+      uint32_t res = swarScale(c, scale + 1);
+      for (unsigned i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT8((chan(c, i) * (scale + 1)) >> 8, chan(res, i));
+    }
+  }
+}
+
+void test_swar_qadd_saturates(void) {
+  for (unsigned n = 0; n < 100000; n++) {
+    uint32_t a = rnd32(), b = rnd32();
+    uint32_t res = swarQadd(a, b);
+    for (unsigned i = 0; i < 4; i++) {
+      unsigned s = chan(a, i) + chan(b, i);
+      TEST_ASSERT_EQUAL_UINT8(s > 255 ? 255 : s, chan(res, i));
+    }
+  }
+}
+
+void test_swar_blend_matches_color_blend(void) {
+  for (unsigned blend = 0; blend < 256; blend++) {
+    for (unsigned n = 0; n < 500; n++) {
+      uint32_t a = rnd32(), b = rnd32();
+      uint32_t res = color_blend(a, b, blend);
+      uint32_t exp = blend == 0 ? a : blend == 255 ? b : 0;
+      if (blend > 0 && blend < 255) {
+        for (unsigned i = 0; i < 4; i++) exp |= uint32_t((chan(b, i) * blend + chan(a, i) * (255 - blend)) >> 8) << (8*i);
+      }
+      TEST_ASSERT_EQUAL_HEX32(exp, res);
+    }
+  }
+}
+
+void test_swar_lerp_is_exact_at_ends(void) {
+  for (unsigned n = 0; n < 10000; n++) {
+    uint32_t a = rnd32(), b = rnd32();
+    TEST_ASSERT_EQUAL_HEX32(a, swarLerp(a, b, 0));
+    uint8_t f = rnd32();
+    uint32_t res = swarLerp(a, b, f);
+    for (unsigned i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT8((chan(b, i) * f + chan(a, i) * (256 - f)) >> 8, chan(res, i));
+  }
+}
+
+void test_scale_buffer(void) {
+  uint32_t buf[257], ref[257];
+  for (unsigned scale = 0; scale < 256; scale++) {
+    for (unsigned i = 0; i < 257; i++) buf[i] = ref[i] = (i == 3) ? 0 : rnd32();
+    scaleBuffer(buf, 257, scale);
+    for (unsigned i = 0; i < 257; i++) {
+      for (unsigned k = 0; k < 4; k++) {
+        uint8_t exp = scale == 255 ? chan(ref[i], k) : (chan(ref[i], k) * (scale + 1)) >> 8;
+        TEST_ASSERT_EQUAL_UINT8(exp, chan(buf[i], k));
+      }
+    }
+  }
+}
+
+void test_fade_toward_color(void) {
+  // integer step equals |d|*10/(10*rate+11) + 1 (former float division d/(rate+1.1))
+  for (unsigned rate = 0; rate < 128; rate++) {
+    for (unsigned d = 1; d < 256; d++) {
+      uint32_t c = 0, target = RGBW32(d, 0, 0, 0);
+      fadeTowardColor(&c, 1, target, rate);
+      unsigned step = d * 10 / (10 * rate + 11) + 1;
+      TEST_ASSERT_EQUAL_UINT8(step > d ? d : step, R(c));
+      c = RGBW32(0, 0, d, 0);
+      fadeTowardColor(&c, 1, 0, rate);
+      TEST_ASSERT_EQUAL_UINT8(d - (step > d ? d : step), B(c));
+    }
+  }
+  // converges for every rate
+  for (unsigned rate = 0; rate < 128; rate += 9) {
+    uint32_t c = rnd32(), target = rnd32();
+    for (unsigned n = 0; n < 255 && c != target; n++) fadeTowardColor(&c, 1, target, rate);
+    TEST_ASSERT_EQUAL_HEX32(target, c);
+  }
+}
+
+void test_blur_matches_reference(void) {
+  const unsigned n = 37, stride = 3;
+  uint32_t buf[n * stride], ref[n * stride];
+  for (unsigned amount = 0; amount < 256; amount += 17) {
+    for (unsigned i = 0; i < n * stride; i++) buf[i] = ref[i] = rnd32();
+    blurBuffer(buf, n, stride, amount);
+    // FastLED blur1d() per channel
+    uint8_t keep = 255 - amount, seep = amount >> 1;
+    for (unsigned k = 0; k < 4; k++) {
+      uint8_t carry = 0;
+      uint8_t px[n];
+      for (unsigned i = 0; i < n; i++) px[i] = chan(ref[i * stride], k);
+      for (unsigned i = 0; i < n; i++) {
+        uint8_t cur = px[i];
+        uint8_t part = (cur * (seep + 1)) >> 8;
+        if (i) px[i-1] = px[i-1] + part > 255 ? 255 : px[i-1] + part;
+        unsigned v = ((cur * (keep + 1)) >> 8) + carry;
+        px[i] = v > 255 ? 255 : v;
+        carry = part;
+      }
+      for (unsigned i = 0; i < n; i++) TEST_ASSERT_EQUAL_UINT8(amount ? px[i] : chan(ref[i * stride], k), chan(buf[i * stride], k));
+    }
+    for (unsigned i = 0; i < n * stride; i++) if (i % stride) TEST_ASSERT_EQUAL_HEX32(ref[i], buf[i]); // other columns untouched
+  }
+}
+
+void test_scale_channels(void) {
+  uint8_t src[64 + 3], dst[64 + 3];
+  for (unsigned scale = 0; scale < 256; scale++) {
+    for (unsigned i = 0; i < sizeof(src); i++) src[i] = rnd32();
+    for (unsigned off = 0; off < 4; off++) { // unaligned start and tail
+      size_t len = sizeof(src) - off - (scale & 3);
+      memset(dst, 0xEE, sizeof(dst));
+      scaleChannels(dst + off, src + off, len, scale);
+      for (unsigned i = 0; i < len; i++) TEST_ASSERT_EQUAL_UINT8((src[off + i] * (scale + 1)) >> 8, dst[off + i]);
+      for (unsigned i = off + len; i < sizeof(dst); i++) TEST_ASSERT_EQUAL_UINT8(0xEE, dst[i]);
+    }
+  }
+}
+
+// straightforward bilinear interpolation, same rounding as upscaleBuffer()
+static uint32_t upscaleRef(const uint32_t *src, uint16_t sw, uint16_t sh, uint16_t dw, uint16_t dh, uint16_t x, uint16_t y) {
+  uint32_t px = upscalePos(x, sw, dw), py = upscalePos(y, sh, dh);
+  uint16_t x0 = px >> 8, y0 = py >> 8;
+  uint16_t x1 = x0 + 1 < sw ? x0 + 1 : x0, y1 = y0 + 1 < sh ? y0 + 1 : y0;
+  uint32_t top    = swarLerp(src[y0 * sw + x0], src[y0 * sw + x1], px & 0xFF);
+  uint32_t bottom = swarLerp(src[y1 * sw + x0], src[y1 * sw + x1], px & 0xFF);
+  return swarLerp(top, bottom, py & 0xFF);
+}
+
+void test_upscale_buffer(void) {
+  static const uint16_t sizes[][4] = { {8,8,8,8}, {4,3,16,12}, {1,1,5,7}, {5,2,32,32}, {16,16,48,40}, {3,7,4,9} };
+  for (auto &s : sizes) {
+    uint16_t sw = s[0], sh = s[1], dw = s[2], dh = s[3];
+    static uint32_t src[16 * 16], dst[48 * 40], scratch[48 * 3];
+    TEST_ASSERT_TRUE(upscaleScratchSize(dw) <= sizeof(scratch));
+    for (unsigned i = 0; i < unsigned(sw * sh); i++) src[i] = rnd32();
+    upscaleBuffer(src, sw, sh, dst, dw, dh, scratch);
+    for (uint16_t y = 0; y < dh; y++)
+      for (uint16_t x = 0; x < dw; x++) TEST_ASSERT_EQUAL_HEX32(upscaleRef(src, sw, sh, dw, dh, x, y), dst[y * dw + x]);
+    // corners are copied, same size is identity
+    TEST_ASSERT_EQUAL_HEX32(src[0], dst[0]);
+    TEST_ASSERT_EQUAL_HEX32(src[sw * sh - 1], dst[dw * dh - 1]);
+    if (sw == dw && sh == dh) TEST_ASSERT_EQUAL_MEMORY(src, dst, sw * sh * sizeof(uint32_t));
+  }
+}
+
+// per channel versions of the buffer kernels, as the segment code did them before the kernels existed
+__attribute__((noinline)) static void scaleBufferScalar(uint32_t *buf, size_t n, uint8_t scale) {
+  for (size_t i = 0; i < n; i++) {
+    uint32_t c = buf[i], out = 0;
+    for (unsigned shift = 0; shift < 32; shift += 8) out |= ((((c >> shift) & 0xFF) * (scale + 1)) >> 8) << shift;
+    buf[i] = out;
+  }
+}
+
+// former fade_out(): float division per channel
+__attribute__((noinline)) static void fadeTowardColorScalar(uint32_t *buf, size_t n, uint32_t target, uint8_t rate) {
+  float mappedRate = float(rate) + 1.1;
+  for (size_t i = 0; i < n; i++) {
+    uint32_t c = buf[i], out = 0;
+    for (unsigned shift = 0; shift < 32; shift += 8) {
+      int c1 = (c >> shift) & 0xFF, c2 = (target >> shift) & 0xFF;
+      int delta = (c2 - c1) / mappedRate;
+      delta += (c2 == c1) ? 0 : (c2 > c1) ? 1 : -1;
+      out |= uint32_t(c1 + delta) << shift;
+    }
+    buf[i] = out;
+  }
+}
+
+// FastLED blur1d() on separate channels
+__attribute__((noinline)) static void blurBufferScalar(uint32_t *buf, size_t n, size_t stride, uint8_t blur_amount) {
+  uint8_t keep = 255 - blur_amount, seep = blur_amount >> 1;
+  for (unsigned shift = 0; shift < 32; shift += 8) {
+    uint8_t carry = 0;
+    uint32_t *prev = nullptr, *px = buf;
+    for (size_t i = 0; i < n; i++, px += stride) {
+      uint8_t cur = *px >> shift;
+      uint8_t part = (cur * (seep + 1)) >> 8;
+      if (prev) {
+        unsigned p = ((*prev >> shift) & 0xFF) + part;
+        *prev = (*prev & ~(0xFFu << shift)) | (uint32_t(p > 255 ? 255 : p) << shift);
+      }
+      unsigned v = ((cur * (keep + 1)) >> 8) + carry;
+      *px = (*px & ~(0xFFu << shift)) | (uint32_t(v > 255 ? 255 : v) << shift);
+      carry = part;
+      prev = px;
+    }
+  }
+}
+
+static uint64_t threadNs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// fastest of BENCH_RUNS runs over the same input in ns per pixel, the result must match the reference
+template <typename K, typename R>
+static void benchmark(const char *name, K kernel, R reference) {
+  static uint32_t input[BENCH_PIXELS], buf[BENCH_PIXELS], ref[BENCH_PIXELS];
+  for (unsigned i = 0; i < BENCH_PIXELS; i++) input[i] = i % 7 ? rnd32() : 0; // some black pixels
+  uint64_t best[2] = { UINT64_MAX, UINT64_MAX };
+  for (unsigned run = 0; run < BENCH_RUNS; run++) {
+    for (unsigned v = 0; v < 2; v++) {
+      unsigned variant = (run + v) & 1; // alternate which one runs first
+      uint32_t *b = variant ? ref : buf;
+      memcpy(b, input, sizeof(input));
+      uint64_t start = threadNs();
+      if (variant) reference(b); else kernel(b);
+      uint64_t t = threadNs() - start;
+      if (t < best[variant]) best[variant] = t;
+    }
+    TEST_ASSERT_EQUAL_MEMORY(ref, buf, sizeof(buf));
+  }
+  char msg[96];
+  snprintf(msg, sizeof(msg), "%s: scalar %.2f ns/px, kernel %.2f ns/px (%.2fx)", name,
+    double(best[1]) / BENCH_PIXELS, double(best[0]) / BENCH_PIXELS, double(best[1]) / best[0]);
+  TEST_MESSAGE(msg);
+}
+
+void test_benchmark_buffer_kernels(void) {
+  benchmark("scaleBuffer",
+    [](uint32_t *b) { scaleBuffer(b, BENCH_PIXELS, 200); },
+    [](uint32_t *b) { scaleBufferScalar(b, BENCH_PIXELS, 200); });
+  benchmark("fadeTowardColor",
+    [](uint32_t *b) { fadeTowardColor(b, BENCH_PIXELS, 0x00FF8000, 31); },
+    [](uint32_t *b) { fadeTowardColorScalar(b, BENCH_PIXELS, 0x00FF8000, 31); });
+  benchmark("blurBuffer (1D)",
+    [](uint32_t *b) { blurBuffer(b, BENCH_PIXELS, 1, 128); },
+    [](uint32_t *b) { blurBufferScalar(b, BENCH_PIXELS, 1, 128); });
+  benchmark("blurBuffer (64x64 columns)",
+    [](uint32_t *b) { for (unsigned x = 0; x < 64; x++) blurBuffer(b + x, 64, 64, 128); },
+    [](uint32_t *b) { for (unsigned x = 0; x < 64; x++) blurBufferScalar(b + x, 64, 64, 128); });
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_swar_scale_matches_nscale8);
+  RUN_TEST(test_swar_qadd_saturates);
+  RUN_TEST(test_swar_blend_matches_color_blend);
+  RUN_TEST(test_swar_lerp_is_exact_at_ends);
+  RUN_TEST(test_scale_buffer);
+  RUN_TEST(test_fade_toward_color);
+  RUN_TEST(test_blur_matches_reference);
+  RUN_TEST(test_scale_channels);
+  RUN_TEST(test_upscale_buffer);
+  RUN_TEST(test_benchmark_buffer_kernels);
+  return UNITY_END();
+}
@@ -0,0 +1,171 @@
+/*
+ * WLED delta stream encoder/decoder (delta_stream.cpp): frames survive the round trip,
+ * lost packets are contained until the next keyframe
+ */
+
+#include <unity.h>
+#include "wled_host.h"
+#include "colors.cpp"
+#include "delta_stream.cpp"
+
+#define PACKET_MAX 1472 // UDP_IN_MAXSIZE
+#define PIXELS     2000
+
+static uint32_t rng = 0xDE17A;
+static uint32_t rnd32() { rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return rng; }
+
+static uint8_t rxPixels[PIXELS * 4];
+static void rxSetPixel(uint16_t i, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+  uint8_t *p = rxPixels + i * 4;
+  p[0] = r; p[1] = g; p[2] = b; p[3] = w;
+}
+
+struct Link {
+  DeltaEncoder enc;
+  DeltaDecoder dec;
+  uint8_t  packet[PACKET_MAX];
+  uint8_t  last[PIXELS * 4];
+  uint8_t  sequence = 0;
+  unsigned keyframe = 0;
+  size_t   bytes    = 0; // payload sent
+  unsigned packets  = 0;
+  int      shown    = 0;
+};
+
+// sends one frame, dropping packet number drop (if any); returns number of packets
+static unsigned sendFrame(Link &l, const uint8_t *buf, uint16_t len, bool rgbw, uint8_t bri, int drop = -1) {
+  bool key = l.keyframe == 0;
+  l.keyframe = (key ? WLED_DELTA_KEYFRAME : l.keyframe) - 1;
+  deltaBeginFrame(&l.enc, l.packet, 2, ++l.sequence, key, rgbw);
+  unsigned n = 0;
+  while (size_t plen = deltaEncodePacket(&l.enc, l.packet, PACKET_MAX, buf, l.last, len, bri)) {
+    TEST_ASSERT_TRUE(plen <= PACKET_MAX);
+    l.bytes += plen;
+    l.packets++;
+    if (int(n++) != drop && deltaDecodePacket(&l.dec, l.packet, plen, PIXELS, rxSetPixel) > 0) l.shown++;
+  }
+  return n;
+}
+
+static void checkReceived(const uint8_t *buf, uint16_t len, bool rgbw, uint8_t bri) {
+  const size_t ch = rgbw ? 4 : 3;
+  for (uint16_t i = 0; i < len; i++)
+    for (size_t c = 0; c < 4; c++)
+      TEST_ASSERT_EQUAL_UINT8(c < ch ? (buf[i*ch + c] * (bri + 1)) >> 8 : 0, rxPixels[i*4 + c]);
+}
+
+// changes density percent of the pixels
+static void mutate(uint8_t *buf, uint16_t len, size_t ch, unsigned density) {
+  for (uint16_t i = 0; i < len; i++) if (rnd32() % 100 < density) for (size_t c = 0; c < ch; c++) buf[i*ch + c] = rnd32();
+}
+
+void setUp(void) { memset(rxPixels, 0, sizeof(rxPixels)); }
+void tearDown(void) {}
+
+void test_round_trip(void) {
+  static const bool rgbw[] = { false, true };
+  for (bool w : rgbw) {
+    const size_t ch = w ? 4 : 3;
+    static uint8_t buf[PIXELS * 4];
+    static const unsigned densities[] = { 0, 1, 10, 60, 100 };
+    for (unsigned density : densities) {
+      Link l;
+      memset(rxPixels, 0, sizeof(rxPixels));
+      for (size_t i = 0; i < sizeof(buf); i++) buf[i] = rnd32();
+      for (unsigned f = 0; f < 2 * WLED_DELTA_KEYFRAME + 3; f++) {
+        uint8_t bri = f % 7 ? 255 : 128;
+        sendFrame(l, buf, PIXELS, w, bri);
+        TEST_ASSERT_EQUAL_INT(f + 1, l.shown);
+        checkReceived(buf, PIXELS, w, bri);
+        mutate(buf, PIXELS, ch, density);
+      }
+    }
+  }
+}
+
+void test_long_runs_and_gaps(void) {
+  // runs longer than 255 pixels and gaps longer than a packet
+  static uint8_t buf[PIXELS * 3];
+  Link l;
+  memset(buf, 0, sizeof(buf));
+  sendFrame(l, buf, PIXELS, false, 255);
+  for (uint16_t i = 100; i < 700; i++) buf[i*3] = 1;
+  buf[(PIXELS - 1) * 3 + 2] = 9;
+  sendFrame(l, buf, PIXELS, false, 255);
+  checkReceived(buf, PIXELS, false, 255);
+  // unchanged frame is a single packet without data that still completes the frame
+  unsigned before = l.shown;
+  TEST_ASSERT_EQUAL_INT(1, sendFrame(l, buf, PIXELS, false, 255));
+  TEST_ASSERT_EQUAL_INT(before + 1, l.shown);
+}
+
+void test_lost_packet_waits_for_keyframe(void) {
+  static uint8_t buf[PIXELS * 3];
+  Link l;
+  for (size_t i = 0; i < sizeof(buf); i++) buf[i] = rnd32();
+  sendFrame(l, buf, PIXELS, false, 255);
+  mutate(buf, PIXELS, 3, 100);
+  TEST_ASSERT_TRUE(sendFrame(l, buf, PIXELS, false, 255, 1) > 2); // second packet of a multi packet delta frame lost
+  int shown = l.shown;
+  while (l.keyframe != 0) {                                      // deltas are ignored until the keyframe
+    mutate(buf, PIXELS, 3, 5);
+    sendFrame(l, buf, PIXELS, false, 255);
+
+  }
+  TEST_ASSERT_EQUAL_INT(shown, l.shown);
+  sendFrame(l, buf, PIXELS, false, 255);                         // keyframe resynchronizes
+  TEST_ASSERT_EQUAL_INT(shown + 1, l.shown);
+  checkReceived(buf, PIXELS, false, 255);
+  mutate(buf, PIXELS, 3, 5);
+  sendFrame(l, buf, PIXELS, false, 255);
+  TEST_ASSERT_EQUAL_INT(shown + 2, l.shown);
+  checkReceived(buf, PIXELS, false, 255);
+}
+
+void test_lost_last_packet(void) {
+  // the frame after a frame without its PUSH packet must not be applied as delta
+  static uint8_t buf[PIXELS * 3];
+  Link l;
+  for (size_t i = 0; i < sizeof(buf); i++) buf[i] = rnd32();
+  sendFrame(l, buf, PIXELS, false, 255);
+  mutate(buf, PIXELS, 3, 2);
+  TEST_ASSERT_EQUAL_INT(1, sendFrame(l, buf, PIXELS, false, 255, 0));
+  int shown = l.shown;
+  mutate(buf, PIXELS, 3, 2);
+  sendFrame(l, buf, PIXELS, false, 255);
+  TEST_ASSERT_EQUAL_INT(shown, l.shown);
+}
+
+// bytes on the wire compared to DDP, which sends every channel of every frame
+void test_compression_ratio(void) {
+  static const unsigned densities[] = { 2, 10, 30 };
+  static const float    minRatio[]  = { 10.0f, 4.0f, 1.5f };
+  const unsigned frames = 4 * WLED_DELTA_KEYFRAME; // includes keyframes
+  const size_t   ch = 3, channels = PIXELS * ch;
+  const size_t   ddpBytes = frames * (channels + (channels + 1439) / 1440 * 10);
+  static uint8_t buf[PIXELS * 3];
+  for (unsigned d = 0; d < 3; d++) {
+    Link l;
+    for (size_t i = 0; i < sizeof(buf); i++) buf[i] = rnd32();
+    for (unsigned f = 0; f < frames; f++) {
+      mutate(buf, PIXELS, ch, densities[d]);
+      sendFrame(l, buf, PIXELS, false, 255);
+    }
+    checkReceived(buf, PIXELS, false, 255);
+    float ratio = float(ddpBytes) / l.bytes;
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%u%% pixels changed per frame: %u packets, ratio %.1f vs DDP", densities[d], l.packets, ratio);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(ratio > minRatio[d]);
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_long_runs_and_gaps);
+  RUN_TEST(test_lost_packet_waits_for_keyframe);
+  RUN_TEST(test_lost_last_packet);
+  RUN_TEST(test_compression_ratio);
+  return UNITY_END();
+}
@@ -0,0 +1,257 @@
+/*
+ * Host effect benchmark: the effect engine (FX.cpp, FX_fcn.cpp, FX_2Dfcn.cpp) and bus_manager.cpp compiled for the host,
+ * rendering every effect registered by setupEffectData() through WS2812FX::service() into a memory-only bus,
+ * same cases and JSON layout as the on-device benchmark (fxbench.cpp) so runs can be diffed between commits.
+ * Afterwards BusManager's pixel to bus lookup is timed on 1, 4 and 10 memory-only busses against the linear scan it replaced,
+ * and the segment pixel accessors effects call for every pixel are timed on their own.
+ * Results go to fxbench.json in the working directory, or the file named by FXBENCH_JSON.
+ * Times are host times: compare runs on the same machine, not with the device.
+ */
+
+#include <unity.h>
+#include "wled_fx_host.h"
+#include "colors.cpp"
+#include "wled_math.cpp"
+#include "FX_fcn.cpp"
+#include "FX_2Dfcn.cpp"
+#include "FX.cpp"
+#include "bus_manager.cpp"
+#include "cellular.cpp"
+#include "pin_manager.cpp"
+#include "um_manager.cpp"
+#include "util.cpp"
+#include "src/dependencies/time/Time.cpp"
+#include "src/dependencies/time/DateStrings.cpp"
+
+#define FXBENCH_WARMUP   2
+#define FXBENCH_FRAMES  16
+
+static const struct { uint16_t width; uint16_t height; } fxBenchSizes[] = {
+  {300, 1}, {1500, 1}, {8192, 1},
+  {16, 16}, {32, 32}, {64, 32}, {64, 64}, {128, 64}
+};
+
+static const uint8_t fxBenchBusCounts[] = {1, 4, 10};
+#define FXBENCH_BUS_PIXELS 1500
+#define FXBENCH_BUS_FRAMES  200
+#define FXBENCH_PX_FRAMES   100
+
+// udp.cpp is not compiled: network busses only keep their pixels in memory
+size_t realtimePacketSize(uint8_t type) { return 0; }
+void realtimePreparePacket(uint8_t type, NetOutput *out) {}
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW, NetOutput *out) { return 0; }
+
+static FILE *results;
+static unsigned cases;
+
+// same as fxBenchIs2DOnly() in fxbench.cpp
+static bool is2DOnly(uint8_t fx) {
+  char lineBuffer[128] = "";
+  strncpy(lineBuffer, strip.getModeData(fx), sizeof(lineBuffer)-1);
+  char *flags = lineBuffer;
+  for (uint8_t i = 0; i < 3 && flags; i++) {
+    flags = strchr(flags, ';');
+    if (flags) flags++;
+  }
+  if (flags == nullptr) return false;
+  char *end = strchr(flags, ';');
+  if (end) *end = 0;
+  return strchr(flags, '2') && !strchr(flags, '1');
+}
+
+static bool setupSize(uint16_t width, uint16_t height) {
+  uint8_t pins[4] = {0, 0, 0, 0};
+  busses.removeAll();
+  BusConfig bc = BusConfig(TYPE_NET_DDP_RGB, pins, 0, width * height);
+  if (busses.add(bc) == -1 || !busses.getBus(0)->isOk()) return false;
+  strip.isMatrix = height > 1;
+  strip.panel.clear();
+  if (strip.isMatrix) {
+    WS2812FX::Panel p;
+    p.width  = width;
+    p.height = height;
+    strip.panel.push_back(p);
+  }
+  strip.panels = strip.panel.size();
+  strip.finalizeInit();
+  return strip.getLengthTotal() == width * height;
+}
+
+// CPU time of this thread: other processes on the host do not count
+static uint64_t threadNs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// average ns per frame; the clock is advanced past the minimum frame time instead of waiting for it
+static uint32_t runCase(uint8_t fx) {
+  strip.makeAutoSegments(true); // also refreshes the light capabilities of the segment
+  Segment &seg = strip.getMainSegment();
+  seg.setMode(fx, true);
+  seg.setOption(SEG_OPTION_ON, true);
+
+  uint64_t elapsed = 0;
+  for (uint8_t frame = 0; frame < FXBENCH_WARMUP + FXBENCH_FRAMES; frame++) {
+    hostClockOffsetUs += strip.getMinShowDelay() * 1000UL;
+    strip.trigger();
+    uint64_t start = threadNs();
+    strip.service();
+    if (frame >= FXBENCH_WARMUP) elapsed += threadNs() - start;
+  }
+  return elapsed / FXBENCH_FRAMES;
+}
+
+// BusManager::setPixelColor() before the run table: every pixel tests every bus
+// (not inlined, the engine calls BusManager from another translation unit)
+static void __attribute__((noinline)) linearSetPixelColor(uint16_t pix, uint32_t c) {
+  for (uint8_t i = 0; i < busses.getNumBusses(); i++) {
+    Bus* b = busses.getBus(i);
+    uint16_t bstart = b->getStart();
+    if (pix < bstart || pix >= bstart + b->getLength()) continue;
+    b->setPixelColor(pix - bstart, c);
+  }
+}
+
+static uint32_t linearGetPixelColor(uint16_t pix) {
+  for (uint8_t i = 0; i < busses.getNumBusses(); i++) {
+    Bus* b = busses.getBus(i);
+    uint16_t bstart = b->getStart();
+    if (pix < bstart || pix >= bstart + b->getLength()) continue;
+    return b->getPixelColor(pix - bstart);
+  }
+  return 0;
+}
+
+static unsigned busErrors(const uint32_t *pixels, uint16_t len) {
+  unsigned errors = 0;
+  for (uint16_t i = 0; i < len; i++) errors += linearGetPixelColor(i) != (pixels[i] & 0xFFFFFF);
+  return errors;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_all_effects(void) {
+  TEST_ASSERT_TRUE(strip.getModeCount() > 100); // setupEffectData() registered the effects
+  for (const auto &size : fxBenchSizes) {
+    TEST_ASSERT_TRUE(setupSize(size.width, size.height));
+    uint32_t total = 0;
+    for (uint8_t fx = 0; fx < strip.getModeCount(); fx++) {
+      if (!strncmp("RSVD", strip.getModeData(fx), 4) || (size.height == 1 && is2DOnly(fx))) continue;
+      uint32_t lastShow = strip.getLastShow();
+      uint32_t nsPerFrame = runCase(fx);
+      TEST_ASSERT_TRUE(lastShow != strip.getLastShow()); // frames were rendered and shown
+      char name[48] = "";
+      strncpy(name, strip.getModeData(fx), sizeof(name)-1);
+      char *end = strchr(name, '@');
+      if (end) *end = 0;
+      fprintf(results, "%s{\"fx\":%d,\"n\":\"%s\",\"w\":%d,\"h\":%d,\"nsf\":%u,\"nsp\":%u}", cases++ ? "," : "",
+        fx, name, size.width, size.height, nsPerFrame, nsPerFrame / (size.width * size.height));
+      total += nsPerFrame / 1000;
+    }
+    char msg[64];
+    snprintf(msg, sizeof(msg), "%ux%u: all effects %u us/frame", size.width, size.height, total);
+    TEST_MESSAGE(msg);
+  }
+}
+
+// FXBENCH_BUS_PIXELS split evenly over n busses, written pixel by pixel (linear scan and run table) and as one span
+void test_bus_lookup(void) {
+  static uint32_t pixels[FXBENCH_BUS_PIXELS];
+  uint8_t pins[4] = {0, 0, 0, 0};
+  unsigned busResults = 0;
+  for (uint8_t n : fxBenchBusCounts) {
+    const uint16_t len = FXBENCH_BUS_PIXELS / n;
+    busses.removeAll();
+    for (uint8_t b = 0; b < n; b++) {
+      BusConfig bc = BusConfig(TYPE_NET_DDP_RGB, pins, b * len, len);
+      TEST_ASSERT_TRUE(busses.add(bc) != -1 && busses.getBus(b)->isOk());
+    }
+    // fastest frame of each variant, the host is not idle; the order rotates as the first write of a frame is slower
+    uint64_t best[3] = {UINT64_MAX, UINT64_MAX, UINT64_MAX}; // linear scan, run table, span
+    for (unsigned frame = 0; frame < FXBENCH_BUS_FRAMES; frame++) {
+      for (unsigned k = 0; k < 3; k++) {
+        unsigned variant = (frame + k) % 3;
+        for (uint16_t i = 0; i < n * len; i++) pixels[i] = ((i * 0x010203UL) ^ ((frame * 3 + k) * 0x0F0F0FUL)) & 0xFFFFFF; // changes every pass
+        auto start = std::chrono::steady_clock::now();
+        switch (variant) {
+          case 0: for (uint16_t i = 0; i < n * len; i++) linearSetPixelColor(i, pixels[i]); break;
+          case 1: for (uint16_t i = 0; i < n * len; i++) busses.setPixelColor(i, pixels[i]); break;
+          case 2: busses.setPixelColors(0, pixels, n * len); break;
+        }
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        if (ns < best[variant]) best[variant] = ns;
+        TEST_ASSERT_EQUAL_UINT(0, busErrors(pixels, n * len));
+      }
+    }
+    const uint32_t total = n * len;
+    double nsl = double(best[0]) / total, nsp = double(best[1]) / total, nsb = double(best[2]) / total;
+    fprintf(results, "%s{\"busses\":%d,\"len\":%d,\"nsl\":%.2f,\"nsp\":%.2f,\"nsb\":%.2f}", busResults++ ? "," : "", n, n * len, nsl, nsp, nsb);
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%2u busses: linear scan %.2f ns/px, run table %.2f ns/px (%.2fx), span %.2f ns/px (%.2fx)",
+      n, nsl, nsp, nsl / nsp, nsb, nsl / nsb);
+    TEST_MESSAGE(msg);
+    if (n == 10) TEST_ASSERT_TRUE(nsp < nsl); // a scan over 10 busses must lose against the run table
+  }
+  busses.removeAll();
+}
+
+// ns per pixel of one pass over the main segment, fastest of FXBENCH_PX_FRAMES
+template <typename F> static double pixelPassNs(uint16_t len, F pass) {
+  uint64_t best = UINT64_MAX;
+  for (unsigned frame = 0; frame < FXBENCH_PX_FRAMES; frame++) {
+    uint64_t start = threadNs();
+    pass(frame);
+    best = std::min(best, threadNs() - start);
+  }
+  return double(best) / len;
+}
+
+// Segment accessors on a 1D strip and a matrix: set/get with the render buffer, set without it (writes into the bus
+// with the segment brightness applied) and color_from_palette() with position mapping
+void test_pixel_accessors(void) {
+  static const struct { uint16_t width; uint16_t height; } sizes[] = { {1500, 1}, {64, 64} };
+  static volatile uint32_t sink;
+  unsigned pxResults = 0;
+  for (const auto &size : sizes) {
+    TEST_ASSERT_TRUE(setupSize(size.width, size.height));
+    runCase(FX_MODE_STATIC); // allocates the render buffer
+    Segment &seg = strip.getMainSegment();
+    seg.setPalette(6); // Party
+    const uint16_t len = seg.virtualLength();
+    TEST_ASSERT_EQUAL_UINT(size.width * size.height, len);
+    double set = pixelPassNs(len, [&](unsigned f) { for (uint16_t i = 0; i < len; i++) seg.setPixelColor(i, i * 0x010203UL + f); });
+    double get = pixelPassNs(len, [&](unsigned f) { uint32_t c = 0; for (uint16_t i = 0; i < len; i++) c += seg.getPixelColor(i); sink = c; });
+    double pal = pixelPassNs(len, [&](unsigned f) { uint32_t c = 0; for (uint16_t i = 0; i < len; i++) c += seg.color_from_palette(i + f, true, true, 0); sink = c; });
+    seg.deallocatePixels();
+    double direct = pixelPassNs(len, [&](unsigned f) { for (uint16_t i = 0; i < len; i++) seg.setPixelColor(i, i * 0x010203UL + f); });
+    fprintf(results, "%s{\"w\":%d,\"h\":%d,\"set\":%.2f,\"get\":%.2f,\"pal\":%.2f,\"direct\":%.2f}",
+      pxResults++ ? "," : "", size.width, size.height, set, get, pal, direct);
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%ux%u: setPixelColor %.2f ns/px, getPixelColor %.2f, color_from_palette %.2f, unbuffered set %.2f",
+      size.width, size.height, set, get, pal, direct);
+    TEST_MESSAGE(msg);
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *path = getenv("FXBENCH_JSON");
+  results = fopen(path ? path : "fxbench.json", "w");
+  if (!results) return 1;
+  fadeTransition = false;   // no crossfade between cases
+  strip.setTargetFps(250);  // shortest MIN_SHOW_DELAY
+  fprintf(results, "{\"arch\":\"host\",\"frames\":%d,\"results\":[", FXBENCH_FRAMES);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_all_effects);
+  fprintf(results, "],\"bus\":[");
+  RUN_TEST(test_bus_lookup);
+  fprintf(results, "],\"px\":[");
+  RUN_TEST(test_pixel_accessors);
+  int failures = UNITY_END();
+
+  fprintf(results, "]}\n");
+  fclose(results);
+  return failures;
+}
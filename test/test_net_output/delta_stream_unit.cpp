@@ -0,0 +1,3 @@
+// delta_stream.cpp on its own, its helpers clash with the ones in udp.cpp
+#include "wled_net_host.h"
+#include "delta_stream.cpp"
@@ -0,0 +1,211 @@
+/*
+ * Network bus output of udp.cpp over a loopback socket (WiFiUdp.h sends everything to 127.0.0.1): DDP packets
+ * built by realtimeBroadcast() in the per bus packet buffer must be byte for byte what the former per byte
+ * writer sent, and the packet rate of both is reported for 480, 2048 and 8192 pixel outputs.
+ */
+
+#include <unity.h>
+#include <vector>
+#include "wled_net_host.h"
+#include "colors.cpp"
+#include "wled_math.cpp"
+#include "FX_fcn.cpp"
+#include "FX_2Dfcn.cpp"
+#include "FX.cpp"
+#include "bus_manager.cpp"
+#include "cellular.cpp"
+#include "pin_manager.cpp"
+#include "um_manager.cpp"
+#include "util.cpp"
+#include "udp.cpp"
+#include "src/dependencies/time/Time.cpp"
+#include "src/dependencies/time/DateStrings.cpp"
+
+#define MAX_PIXELS   8192
+#define RATE_BATCHES 15
+
+typedef std::vector<uint8_t> Packet;
+
+static const IPAddress client(10, 0, 0, 2);
+static uint8_t pixels[MAX_PIXELS * 4];
+
+// DDP sender before the packet buffer: a socket per call, one write() per byte, scale8() per channel
+static size_t sequenceNumber = 0;
+static uint8_t legacyDdpBroadcast(IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW) {
+  if (!(apActive || interfacesInited) || !client[0] || !length) return 1;
+
+  WiFiUDP ddpUdp;
+
+  // calculate the number of UDP packets we need to send
+  size_t channelCount = length * (isRGBW? 4:3); // 1 channel for every R,G,B value
+  size_t packetCount = ((channelCount-1) / DDP_CHANNELS_PER_PACKET) +1;
+
+  // there are 3 channels per RGB pixel
+  uint32_t channel = 0; // TODO: allow specifying the start channel
+  // the current position in the buffer
+  size_t bufferOffset = 0;
+
+  for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
+    if (sequenceNumber > 15) sequenceNumber = 0;
+
+    if (!ddpUdp.beginPacket(client, DDP_DEFAULT_PORT)) return 1;
+
+    // the amount of data is AFTER the header in the current packet
+    size_t packetSize = DDP_CHANNELS_PER_PACKET;
+
+    uint8_t flags = DDP_FLAGS1_VER1;
+    if (currentPacket == (packetCount - 1U)) {
+      // last packet, set the push flag
+      flags = DDP_FLAGS1_VER1 | DDP_FLAGS1_PUSH;
+      if (channelCount % DDP_CHANNELS_PER_PACKET) {
+        packetSize = channelCount % DDP_CHANNELS_PER_PACKET;
+      }
+    }
+
+    // write the header
+    /*0*/ddpUdp.write(flags);
+    /*1*/ddpUdp.write(sequenceNumber++ & 0x0F);
+    /*2*/ddpUdp.write(isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24);
+    /*3*/ddpUdp.write(DDP_ID_DISPLAY);
+    // data offset in bytes, 32-bit number, MSB first
+    /*4*/ddpUdp.write(0xFF & (channel >> 24));
+    /*5*/ddpUdp.write(0xFF & (channel >> 16));
+    /*6*/ddpUdp.write(0xFF & (channel >>  8));
+    /*7*/ddpUdp.write(0xFF & (channel      ));
+    // data length in bytes, 16-bit number, MSB first
+    /*8*/ddpUdp.write(0xFF & (packetSize >> 8));
+    /*9*/ddpUdp.write(0xFF & (packetSize     ));
+
+    for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
+      ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
+      ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
+      ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
+      if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
+    }
+
+    if (!ddpUdp.endPacket()) return 1;
+    channel += packetSize;
+  }
+  return 0;
+}
+
+// the other end of the loopback, packets queue in the socket until drained
+class Receiver {
+  public:
+    Receiver(uint16_t port) {
+      _fd = socket(AF_INET, SOCK_DGRAM, 0);
+      int size = 4 << 20;
+      setsockopt(_fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+      sockaddr_in addr = {};
+      addr.sin_family = AF_INET;
+      addr.sin_port = htons(port);
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      _ok = _fd >= 0 && bind(_fd, (sockaddr *)&addr, sizeof(addr)) == 0;
+    }
+    ~Receiver() { if (_fd >= 0) close(_fd); }
+    bool ok() const { return _ok; }
+    std::vector<Packet> drain() {
+      std::vector<Packet> packets;
+      uint8_t buf[2048];
+      ssize_t len;
+      while ((len = recv(_fd, buf, sizeof(buf), MSG_DONTWAIT)) >= 0) packets.emplace_back(buf, buf + len);
+      return packets;
+    }
+  private:
+    int _fd = -1;
+    bool _ok = false;
+};
+
+static uint32_t rng = 0x12345678;
+static uint8_t rnd8() { rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return rng; }
+
+static NetOutput *newOutput() {
+  NetOutput *out = new NetOutput;
+  out->packet = new uint8_t[realtimePacketSize(0)];
+  realtimePreparePacket(0, out);
+  return out;
+}
+
+static void deleteOutput(NetOutput *out) {
+  delete[] out->packet;
+  delete out;
+}
+
+static uint64_t threadNs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_ddp_packets_match_legacy_sender(void) {
+  static const uint16_t lengths[] = { 1, 2, 479, 480, 481, 360, 361, 2048, 8192 };
+  static const uint8_t  bris[]    = { 255, 254, 128, 1, 0 };
+  Receiver rx(DDP_DEFAULT_PORT);
+  TEST_ASSERT_TRUE(rx.ok());
+  NetOutput *out = newOutput();
+  sequenceNumber = 0;
+  unsigned packets = 0;
+  for (uint16_t length : lengths) for (uint8_t bri : bris) for (bool rgbw : { false, true }) {
+    for (size_t i = 0; i < length * 4u; i++) pixels[i] = rnd8();
+    TEST_ASSERT_EQUAL_UINT8(0, legacyDdpBroadcast(client, length, pixels, bri, rgbw));
+    std::vector<Packet> expected = rx.drain();
+    TEST_ASSERT_EQUAL_UINT8(0, realtimeBroadcast(0, client, length, pixels, bri, rgbw, out));
+    std::vector<Packet> actual = rx.drain();
+    TEST_ASSERT_EQUAL_UINT(((length * (rgbw ? 4 : 3)) - 1) / DDP_CHANNELS_PER_PACKET + 1, expected.size());
+    TEST_ASSERT_EQUAL_UINT(expected.size(), actual.size());
+    for (size_t p = 0; p < expected.size(); p++) {
+      TEST_ASSERT_EQUAL_UINT(expected[p].size(), actual[p].size());
+      TEST_ASSERT_EQUAL_MEMORY(expected[p].data(), actual[p].data(), expected[p].size());
+    }
+    packets += actual.size();
+  }
+  // nothing is sent for an empty bus or an unset address
+  TEST_ASSERT_EQUAL_UINT8(1, realtimeBroadcast(0, client, 0, pixels, 255, false, out));
+  TEST_ASSERT_EQUAL_UINT8(1, realtimeBroadcast(0, IPAddress(0, 0, 0, 0), 480, pixels, 255, false, out));
+  TEST_ASSERT_EQUAL_UINT(0, rx.drain().size());
+  deleteOutput(out);
+  char msg[64];
+  snprintf(msg, sizeof(msg), "%u packets identical", packets);
+  TEST_MESSAGE(msg);
+}
+
+// packets per second of the sending side, best of RATE_BATCHES batches (the receiver queue overflows and drops)
+template <typename S>
+static double packetsPerSecond(Receiver &rx, uint16_t length, S send) {
+  const unsigned packetsPerFrame = (length * 3 - 1) / DDP_CHANNELS_PER_PACKET + 1;
+  const unsigned frames = 2000 / packetsPerFrame + 1;
+  double best = 0;
+  for (unsigned b = 0; b < RATE_BATCHES; b++) {
+    uint64_t start = threadNs();
+    for (unsigned f = 0; f < frames; f++) send();
+    double rate = frames * packetsPerFrame * 1e9 / (threadNs() - start);
+    if (rate > best) best = rate;
+    rx.drain();
+  }
+  return best;
+}
+
+void test_ddp_packets_per_second(void) {
+  static const uint16_t lengths[] = { 480, 2048, 8192 };
+  Receiver rx(DDP_DEFAULT_PORT);
+  NetOutput *out = newOutput();
+  for (size_t i = 0; i < sizeof(pixels); i++) pixels[i] = rnd8();
+  for (uint16_t length : lengths) {
+    double legacy = packetsPerSecond(rx, length, [&] { legacyDdpBroadcast(client, length, pixels, 200, false); });
+    double buffered = packetsPerSecond(rx, length, [&] { realtimeBroadcast(0, client, length, pixels, 200, false, out); });
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%u pixels: per byte %.0f packets/s, packet buffer %.0f packets/s (%.2fx)", length, legacy, buffered, buffered / legacy);
+    TEST_MESSAGE(msg);
+  }
+  deleteOutput(out);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_ddp_packets_match_legacy_sender);
+  RUN_TEST(test_ddp_packets_per_second);
+  return UNITY_END();
+}
@@ -0,0 +1,128 @@
+/*
+ * Pipelined bus output handoff (frame_pipeline.h) with std::thread stand-ins for the main loop and the output task:
+ * every frame reaches the output side complete and in order, and overlapping render and send beats serial output.
+ * Render and send times follow a per LED cost model of an ESP32 (effect + compositing, WS2812 on parallel RMT channels)
+ * and are spent sleeping, so the result does not depend on the number of host cores (the ESP32 uses one per side).
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "frame_pipeline.h"
+
+#define RENDER_NS_PER_LED 2000 // effect rendering and compositing
+#define SEND_NS_PER_LED   3750 // 30us per WS2812 pixel, 8 RMT channels
+#define FPS_FRAMES        24
+
+typedef std::chrono::steady_clock Clock;
+
+// bus stand-in: _data is composited by the render side, show() sends the copy taken by captureFrame()
+struct HostBus {
+  std::vector<uint8_t> data, sendData;
+  uint8_t bri = 255, sendBri = 255;
+  explicit HostBus(uint16_t leds) : data(leds * 3), sendData(leds * 3) {}
+  void captureFrame() { memcpy(sendData.data(), data.data(), data.size()); sendBri = bri; }
+};
+
+struct Timing {
+  unsigned renderNs; // per LED
+  unsigned sendNs;
+};
+
+// frame n has channel i set to n + i and brightness n, so torn, lost or repeated frames are detected
+static void renderFrame(HostBus &bus, uint32_t n, const Timing &t) {
+  Clock::time_point end = Clock::now() + std::chrono::nanoseconds(uint64_t(t.renderNs) * bus.data.size() / 3);
+  for (size_t i = 0; i < bus.data.size(); i++) bus.data[i] = n + i;
+  bus.bri = n;
+  std::this_thread::sleep_until(end);
+}
+
+static unsigned sendFrame(const HostBus &bus, uint32_t n, const Timing &t) {
+  Clock::time_point end = Clock::now() + std::chrono::nanoseconds(uint64_t(t.sendNs) * bus.sendData.size() / 3);
+  unsigned errors = bus.sendBri != uint8_t(n);
+  for (size_t i = 0; i < bus.sendData.size(); i++) errors += bus.sendData[i] != uint8_t(n + i);
+  std::this_thread::sleep_until(end);
+  return errors;
+}
+
+// returns frames per second, errors counts pixels that did not match their frame
+static double runSerial(uint16_t leds, unsigned frames, const Timing &t, unsigned &errors) {
+  HostBus bus(leds);
+  errors = 0;
+  Clock::time_point start = Clock::now();
+  for (uint32_t n = 0; n < frames; n++) {
+    renderFrame(bus, n, t);
+    bus.captureFrame();
+    errors += sendFrame(bus, n, t);
+  }
+  return frames / std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// same sequence as BusManager::show() and BusManager::outputLoop()
+static double runPipelined(uint16_t leds, unsigned frames, const Timing &t, unsigned &errors) {
+  HostBus bus(leds);
+  FramePipeline output;
+  unsigned outputErrors = 0;
+  Clock::time_point start = Clock::now();
+  std::thread task([&] {
+    for (uint32_t n = 0; n < frames; n++) {
+      Clock::time_point timeout = Clock::now() + std::chrono::seconds(2);
+      while (!output.pending()) { // ulTaskNotifyTake()
+        if (Clock::now() > timeout) { outputErrors++; return; } // frame was lost in the handoff
+        std::this_thread::yield();
+      }
+      outputErrors += sendFrame(bus, n, t);
+      output.done();
+    }
+  });
+  for (uint32_t n = 0; n < frames; n++) {
+    renderFrame(bus, n, t);
+    while (output.pending()) std::this_thread::yield(); // waitForOutput()
+    bus.captureFrame();
+    output.publish();
+  }
+  task.join();
+  errors = outputErrors;
+  return frames / std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_frames_complete_and_in_order(void) {
+  // no simulated work, the sides hand over as fast as possible
+  unsigned errors;
+  runPipelined(300, 20000, {0, 0}, errors);
+  TEST_ASSERT_EQUAL_UINT(0, errors);
+  // slow output: rendering runs ahead and must wait instead of overwriting the frame being sent
+  runPipelined(1000, 20, {0, 20000}, errors);
+  TEST_ASSERT_EQUAL_UINT(0, errors);
+}
+
+void test_fps_serial_vs_pipelined(void) {
+  static const uint16_t sizes[] = { 1024, 4096, 8192 };
+  const Timing t = { RENDER_NS_PER_LED, SEND_NS_PER_LED };
+  for (uint16_t leds : sizes) {
+    unsigned errors;
+    double serial = runSerial(leds, FPS_FRAMES, t, errors);
+    TEST_ASSERT_EQUAL_UINT(0, errors);
+    double pipelined = runPipelined(leds, FPS_FRAMES, t, errors);
+    TEST_ASSERT_EQUAL_UINT(0, errors);
+    char msg[80];
+    snprintf(msg, sizeof(msg), "%u LEDs: serial %.1f fps, pipelined %.1f fps (%.2fx)", leds, serial, pipelined, pipelined / serial);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(pipelined > serial * 1.2); // ideal (render + send) / send = 1.53
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_complete_and_in_order);
+  RUN_TEST(test_fps_serial_vs_pipelined);
+  return UNITY_END();
+}
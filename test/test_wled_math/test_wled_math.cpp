@@ -0,0 +1,142 @@
+/*
+ * Error bounds and timing of the fixed point math in wled_math.cpp against libm
+ */
+
+#include <unity.h>
+#include <Arduino.h>
+#include <time.h>
+#include "wled_math.cpp"
+
+#define BENCH_VALUES 4096
+#define BENCH_RUNS   200
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_sin16_error_bound(void) {
+  int maxErr = 0;
+  for (uint32_t t = 0; t < 65536; t++) {
+    int exp = lround(sin(t * TWO_PI / 65536.0) * 32767.0);
+    int err = abs(sin16_t(t) - exp);
+    if (err > maxErr) maxErr = err;
+    TEST_ASSERT_INT_WITHIN(5, exp, sin16_t(t));           // <= 1.4e-4
+    TEST_ASSERT_EQUAL_INT(sin16_t(t + 16384), cos16_t(t));
+  }
+  TEST_ASSERT_EQUAL_INT(0, sin16_t(0));
+  TEST_ASSERT_EQUAL_INT(32767, sin16_t(16384));
+  TEST_ASSERT_EQUAL_INT(-32767, sin16_t(49152));
+  char msg[40]; snprintf(msg, sizeof(msg), "sin16_t max error %d", maxErr); TEST_MESSAGE(msg);
+}
+
+void test_atan2_16_error_bound(void) {
+  int maxErr = 0;
+  for (int32_t y = -2000; y <= 2000; y += 7) {
+    for (int32_t x = -2000; x <= 2000; x += 13) {
+      if (!x && !y) continue;
+      int32_t exp = lround(atan2((double)y, (double)x) * 32768.0 / PI);
+      int16_t res = atan2_16(y, x);              // wraps like the angle itself
+      int err = abs(int16_t(res - exp));
+      if (err > maxErr) maxErr = err;
+      TEST_ASSERT_LESS_OR_EQUAL(18, err);        // 0.1 degrees
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(0, atan2_16(0, 0));
+  TEST_ASSERT_EQUAL_INT(16384, atan2_16(100, 0));
+  char msg[40]; snprintf(msg, sizeof(msg), "atan2_16 max error %d", maxErr); TEST_MESSAGE(msg);
+}
+
+void test_sqrt32_is_floor_sqrt(void) {
+  for (uint32_t x = 0; x < 200000; x++) {
+    uint32_t r = sqrt32_t(x);
+    TEST_ASSERT_TRUE(r * r <= x && (r + 1) * (r + 1) > x);
+  }
+  for (uint64_t x = 200000; x <= 0xFFFFFFFFULL; x = x * 5 / 4 + 1) {
+    uint64_t r = sqrt32_t(x);
+    TEST_ASSERT_TRUE(r * r <= x && (r + 1) * (r + 1) > x);
+  }
+  TEST_ASSERT_EQUAL_INT(65535, sqrt32_t(0xFFFFFFFFUL));
+}
+
+void test_hypot16(void) {
+  for (int32_t y = -46340; y <= 46340; y += 577) {
+    for (int32_t x = -46340; x <= 46340; x += 613) {
+      TEST_ASSERT_EQUAL_INT((int)floor(hypot((double)x, (double)y)), hypot16_t(x, y));
+    }
+  }
+}
+
+static uint64_t threadNs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static volatile int32_t sinkI;
+static volatile float   sinkF;
+
+// fastest of BENCH_RUNS calls in ns per value
+template <typename F>
+static double nsPerValue(F loop) {
+  uint64_t best = UINT64_MAX;
+  for (unsigned run = 0; run < BENCH_RUNS; run++) {
+    uint64_t start = threadNs();
+    loop();
+    uint64_t t = threadNs() - start;
+    if (t < best) best = t;
+  }
+  return double(best) / BENCH_VALUES;
+}
+
+static void report(const char *name, double flt, double fixed) {
+  char msg[96];
+  snprintf(msg, sizeof(msg), "%s: float %.2f ns, fixed point %.2f ns (%.2fx)", name, flt, fixed, flt / fixed);
+  TEST_MESSAGE(msg);
+}
+
+// the host has an FPU, so these only compare against hardware float; the targets without one
+// (ESP8266, ESP32-C3) run the float side in software
+void test_benchmark_against_libm(void) {
+  static uint16_t angle[BENCH_VALUES];
+  static float    rad[BENCH_VALUES], fx[BENCH_VALUES], fy[BENCH_VALUES];
+  static int32_t  ix[BENCH_VALUES], iy[BENCH_VALUES];
+  static uint32_t sq[BENCH_VALUES];
+  uint32_t rng = 0x12345678;
+  for (unsigned i = 0; i < BENCH_VALUES; i++) {
+    rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+    angle[i] = rng;
+    rad[i]   = angle[i] * TWO_PI / 65536.0;
+    ix[i]    = int32_t(rng % 2001) - 1000;      // matrix coordinates, scaled like the arc map does
+    iy[i]    = int32_t((rng >> 11) % 2001) - 1000;
+    fx[i]    = ix[i];
+    fy[i]    = iy[i];
+    sq[i]    = rng >> 2;
+  }
+
+  double libm = nsPerValue([&] { float s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += sinf(rad[i]); sinkF = s; });
+  double wled = nsPerValue([&] { float s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += sin_t(rad[i]); sinkF = s; });
+  double fixed = nsPerValue([&] { int32_t s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += sin16_t(angle[i]); sinkI = s; });
+  report("sinf vs sin16_t", libm, fixed);
+  report("sin_t vs sin16_t", wled, fixed);
+
+  libm  = nsPerValue([&] { float s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += atan2f(fy[i], fx[i]); sinkF = s; });
+  fixed = nsPerValue([&] { int32_t s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += atan2_16(iy[i], ix[i]); sinkI = s; });
+  report("atan2f vs atan2_16", libm, fixed);
+
+  libm  = nsPerValue([&] { float s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += sqrtf(float(sq[i])); sinkF = s; });
+  fixed = nsPerValue([&] { int32_t s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += sqrt32_t(sq[i]); sinkI = s; });
+  report("sqrtf vs sqrt32_t", libm, fixed);
+
+  libm  = nsPerValue([&] { float s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += hypotf(fx[i], fy[i]); sinkF = s; });
+  fixed = nsPerValue([&] { int32_t s = 0; for (unsigned i = 0; i < BENCH_VALUES; i++) s += hypot16_t(ix[i], iy[i]); sinkI = s; });
+  report("hypotf vs hypot16_t", libm, fixed);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sin16_error_bound);
+  RUN_TEST(test_atan2_16_error_bound);
+  RUN_TEST(test_sqrt32_is_floor_sqrt);
+  RUN_TEST(test_hypot16);
+  RUN_TEST(test_benchmark_against_libm);
+  return UNITY_END();
+}
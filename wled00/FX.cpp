@@ -27,6 +27,7 @@
 #include "wled.h"
 #include "FX.h"
 #include "fcn_declare.h"
+#include "cellular.h"
 
 #define IBN 5100
 
@@ -2378,7 +2379,8 @@ static const char _data_FX_MODE_RAILWAY[] PROGMEM = "Railway@!,Smoothness;1,2;!"
 //propagation velocity from speed
 //drop rate from intensity
 
-//4 bytes
+//4 bytes, integer only; not a ParticlePool user since a ripple stays at its origin and
+//its wave front follows from state, a pool slot (9 bytes) would only cost memory
 typedef struct Ripple {
   uint8_t state;
   uint8_t color;
@@ -2773,13 +2775,76 @@ uint16_t mode_spots_fade()
 static const char _data_FX_MODE_SPOTS_FADE[] PROGMEM = "Spots Fade@Spread,Width,,,,,Overlay;!,!;!";
 
 
-//each needs 12 bytes
-typedef struct Ball {
-  unsigned long lastBounceTime;
-  float impactVelocity;
-  float height;
-} ball;
+/*
+ * Fixed point particle pool for 1D particle effects (no FPU needed in update & render)
+ * Pool is laid out as structure of arrays in segment data: positions and velocities
+ * use 16.16 fixed point pixel units, each particle also carries a color index.
+ * Negative position marks a free slot.
+ */
+#define PS_ONE 65536 // one pixel in particle units
+
+typedef struct ParticlePool {
+  int32_t  *pos;   // position (16.16 pixels), negative if slot is free
+  int32_t  *vel;   // velocity (16.16 pixels per frame)
+  uint8_t  *col;   // color index
+  uint16_t  count; // pool capacity
+
+  // bytes needed for n particles (kept 4 byte aligned so pools can be stacked, i.e. one per virtual strip)
+  static size_t dataSize(uint16_t n) { return (n * (2*sizeof(int32_t) + sizeof(uint8_t)) + 3) & ~3; }
+
+  void attach(byte *data, uint16_t n) {
+    pos   = reinterpret_cast<int32_t*>(data);
+    vel   = pos + n;
+    col   = reinterpret_cast<uint8_t*>(vel + n);
+    count = n;
+  }
+
+  void clear() {
+    for (size_t i = 0; i < count; i++) { pos[i] = -1; vel[i] = 0; col[i] = 0; }
+  }
+
+  // (re)uses free slot i, returns false if slot is still occupied
+  bool emit(uint16_t i, int32_t p, int32_t v, uint8_t c) {
+    if (i >= count || pos[i] >= 0) return false;
+    pos[i] = p;
+    vel[i] = v;
+    col[i] = c;
+    return true;
+  }
+
+  // moves first n particles and applies constant acceleration, particles falling below 0 are freed
+  // or, with floor set, stopped at 0 keeping their velocity so the effect can bounce them (see landed())
+  void update(uint16_t n, int32_t accel, bool floor = false) {
+    if (n > count) n = count;
+    for (size_t i = 0; i < n; i++) {
+      if (pos[i] < 0) continue;
+      pos[i] += vel[i];
+      vel[i] += accel;
+      if (pos[i] < 0) pos[i] = floor ? 0 : -1;
+    }
+  }
+
+  // particle i rests on or hit the floor
+  bool landed(uint16_t i) const { return pos[i] == 0 && vel[i] <= 0; }
+
+  // draws first n particles anti-aliased over two neighbouring pixels of virtual strip
+  void render(uint16_t n, uint16_t stripNr, uint32_t (*color)(uint8_t)) {
+    if (n > count) n = count;
+    const int len = SEGLEN;
+    for (size_t i = 0; i < n; i++) {
+      if (pos[i] < 0) continue;
+      const int     p = pos[i] >> 16;
+      const uint8_t f = pos[i] >> 8; // fraction of a pixel (8 bit)
+      if (p >= len) continue;
+      const uint32_t c = color(col[i]);
+      SEGMENT.blendPixelColor(indexToVStrip(p, stripNr), c, 255 - f);
+      if (f && p+1 < len) SEGMENT.blendPixelColor(indexToVStrip(p+1, stripNr), c, f);
+    }
+  }
+} particlePool;
 
+
+#define maxNumBalls 16
 /*
 *  Bouncing Balls Effect
 */
@@ -2787,66 +2852,63 @@ uint16_t mode_bouncing_balls(void) {
   if (SEGLEN == 1) return mode_static();
   //allocate segment data
   const uint16_t strips = SEGMENT.nrOfVStrips(); // adapt for 2D
-  const size_t maxNumBalls = 16;
-  uint16_t dataSize = sizeof(ball) * maxNumBalls;
+  const uint16_t dataSize = ParticlePool::dataSize(maxNumBalls);
   if (!SEGENV.allocateData(dataSize * strips)) return mode_static(); //allocation failed
 
-  Ball* balls = reinterpret_cast<Ball*>(SEGENV.data);
-
   if (!SEGMENT.check2) SEGMENT.fill(SEGCOLOR(2) ? BLACK : SEGCOLOR(1));
 
   // virtualStrip idea by @ewowi (Ewoud Wijma)
   // requires virtual strip # to be embedded into upper 16 bits of index in setPixelColor()
   // the following functions will not work on virtual strips: fill(), fade_out(), fadeToBlack(), blur()
   struct virtualStrip {
-    static void runStrip(size_t stripNr, Ball* balls) {
-      // number of balls based on intensity setting to max of 7 (cycles colors)
-      // non-chosen color is a random color
-      uint16_t numBalls = (SEGMENT.intensity * (maxNumBalls - 1)) / 255 + 1; // minimum 1 ball
-      const float gravity = -9.81f; // standard value of gravity
-      const bool hasCol2 = SEGCOLOR(2);
-      const unsigned long time = millis();
-
+    static uint32_t ballColor(uint8_t i) {
+      uint16_t numBalls = (SEGMENT.intensity * (maxNumBalls - 1)) / 255 + 1;
+      if (SEGMENT.palette) return SEGMENT.color_wheel(i*(256/MAX(numBalls, 8)));
+      if (SEGCOLOR(2))     return SEGCOLOR(i % NUM_COLORS);
+      return SEGCOLOR(0);
+    }
+    static void runStrip(uint16_t stripNr, byte* data) {
+      ParticlePool balls;
+      balls.attach(data, maxNumBalls);
       if (SEGENV.call == 0) {
-        for (size_t i = 0; i < maxNumBalls; i++) balls[i].lastBounceTime = time;
+        balls.clear();
+        for (size_t i = 0; i < maxNumBalls; i++) balls.emit(i, 0, 0, i); // resting on the floor, launched below
       }
 
+      // number of balls based on intensity setting to max of 16 (cycles colors)
+      uint16_t numBalls = (SEGMENT.intensity * (maxNumBalls - 1)) / 255 + 1; // minimum 1 ball
+      // standard gravity (9.81 strip lengths/s^2) in pixels per frame^2, time slowed down up to 4 times by speed
+      const int32_t  height = SEGLEN - 1;
+      const uint32_t slow   = (255-SEGMENT.speed)/64 + 1;
+      int32_t gravity = -int32_t((int64_t)642908 * height * FRAMETIME * FRAMETIME / (1000000LL * slow * slow));
+      if (gravity == 0) gravity = -1;
+      const int32_t minVelocity = (int64_t)983 * height * FRAMETIME / (1000 * slow); // 0.015 strip lengths/s
+
+      balls.update(numBalls, gravity, true);
       for (size_t i = 0; i < numBalls; i++) {
-        float timeSinceLastBounce = (time - balls[i].lastBounceTime)/((255-SEGMENT.speed)/64 +1);
-        float timeSec = timeSinceLastBounce/1000.0f;
-        balls[i].height = (0.5f * gravity * timeSec + balls[i].impactVelocity) * timeSec; // avoid use pow(x, 2) - its extremely slow !
-
-        if (balls[i].height <= 0.0f) {
-          balls[i].height = 0.0f;
-          //damping for better effect using multiple balls
-          float dampening = 0.9f - float(i)/float(numBalls * numBalls); // avoid use pow(x, 2) - its extremely slow !
-          balls[i].impactVelocity = dampening * balls[i].impactVelocity;
-          balls[i].lastBounceTime = time;
-
-          if (balls[i].impactVelocity < 0.015f) {
-            float impactVelocityStart = sqrtf(-2.0f * gravity) * random8(5,11)/10.0f; // randomize impact velocity
-            balls[i].impactVelocity = impactVelocityStart;
-          }
-        } else if (balls[i].height > 1.0f) {
-          continue; // do not draw OOB ball
+        if (!balls.landed(i)) continue;
+        //damping for better effect using multiple balls
+        int32_t dampening = 230 - (256 * i) / (numBalls * numBalls); // 0.9 - i/numBalls^2
+        balls.vel[i] = ((int64_t)-balls.vel[i] * dampening) >> 8;
+        if (balls.vel[i] < minVelocity) {
+          // randomize impact velocity, v = sqrt(2*g*h) reaches the end of the strip
+          balls.vel[i] = sqrtf(-2.0f * gravity * height) * 256.0f * random8(5,11) / 10;
         }
+      }
 
-        uint32_t color = SEGCOLOR(0);
-        if (SEGMENT.palette) {
-          color = SEGMENT.color_wheel(i*(256/MAX(numBalls, 8)));
-        } else if (hasCol2) {
-          color = SEGCOLOR(i % NUM_COLORS);
+      if (SEGLEN < 32) { // too short for anti-aliasing
+        for (size_t i = 0; i < numBalls; i++) {
+          int pos = (balls.pos[i] + PS_ONE/2) >> 16;
+          if (pos < SEGLEN) SEGMENT.setPixelColor(indexToVStrip(pos, stripNr), ballColor(i)); // encode virtual strip into index
         }
-
-        int pos = roundf(balls[i].height * (SEGLEN - 1));
-        if (SEGLEN<32) SEGMENT.setPixelColor(indexToVStrip(pos, stripNr), color); // encode virtual strip into index
-        else           SEGMENT.setPixelColor(balls[i].height + (stripNr+1)*10.0f, color);
+      } else {
+        balls.render(numBalls, stripNr, ballColor);
       }
     }
   };
 
   for (int stripNr=0; stripNr<strips; stripNr++)
-    virtualStrip::runStrip(stripNr, &balls[stripNr * maxNumBalls]);
+    virtualStrip::runStrip(stripNr, SEGENV.data + stripNr * dataSize);
 
   return FRAMETIME;
 }
@@ -2941,7 +3003,7 @@ static const char _data_FX_MODE_SOLID_GLITTER[] PROGMEM = "Solid Glitter@,!;Bg,,
 
 
 //each needs 19 bytes
-//Spark type is used for popcorn, 1D fireworks, and drip
+//Spark type is used for 1D fireworks
 typedef struct Spark {
   float pos, posX;
   float vel, velX;
@@ -2949,7 +3011,8 @@ typedef struct Spark {
   uint8_t colIndex;
 } spark;
 
-#define maxNumPopcorn 21 // max 21 on 16 segment ESP8266
+
+#define maxNumPopcorn 40 // 40 particles need less memory than former 21 float based ones
 /*
 *  POPCORN
 *  modified from https://github.com/kitesurfer1404/WS2812FX/blob/master/src/custom/Popcorn.h
@@ -2958,56 +3021,48 @@ uint16_t mode_popcorn(void) {
   if (SEGLEN == 1) return mode_static();
   //allocate segment data
   uint16_t strips = SEGMENT.nrOfVStrips();
-  uint16_t dataSize = sizeof(spark) * maxNumPopcorn;
+  uint16_t dataSize = ParticlePool::dataSize(maxNumPopcorn);
   if (!SEGENV.allocateData(dataSize * strips)) return mode_static(); //allocation failed
 
-  Spark* popcorn = reinterpret_cast<Spark*>(SEGENV.data);
-
   bool hasCol2 = SEGCOLOR(2);
   if (!SEGMENT.check2) SEGMENT.fill(hasCol2 ? BLACK : SEGCOLOR(1));
 
   struct virtualStrip {
-    static void runStrip(uint16_t stripNr, Spark* popcorn) {
-      float gravity = -0.0001 - (SEGMENT.speed/200000.0); // m/s/s
-      gravity *= SEGLEN;
+    static uint32_t kernelColor(uint8_t colIndex) {
+      if (!SEGMENT.palette && colIndex < NUM_COLORS) return SEGCOLOR(colIndex);
+      return SEGMENT.color_wheel(colIndex);
+    }
+    static void runStrip(uint16_t stripNr, byte* data) {
+      ParticlePool popcorn;
+      popcorn.attach(data, maxNumPopcorn);
+      if (SEGENV.call == 0) popcorn.clear();
+
+      // (0.0001 + speed/200000) * SEGLEN pixels per frame^2
+      int32_t gravity = -int32_t((int64_t)SEGLEN * (65536 + 3277 * SEGMENT.speed) / 10000);
+      if (gravity == 0) gravity = -1;
 
       uint8_t numPopcorn = SEGMENT.intensity*maxNumPopcorn/255;
       if (numPopcorn == 0) numPopcorn = 1;
 
-      for(int i = 0; i < numPopcorn; i++) {
-        if (popcorn[i].pos >= 0.0f) { // if kernel is active, update its position
-          popcorn[i].pos += popcorn[i].vel;
-          popcorn[i].vel += gravity;
-        } else { // if kernel is inactive, randomly pop it
-          if (random8() < 2) { // POP!!!
-            popcorn[i].pos = 0.01f;
-
-            uint16_t peakHeight = 128 + random8(128); //0-255
-            peakHeight = (peakHeight * (SEGLEN -1)) >> 8;
-            popcorn[i].vel = sqrtf(-2.0f * gravity * peakHeight);
-
-            if (SEGMENT.palette)
-            {
-              popcorn[i].colIndex = random8();
-            } else {
-              byte col = random8(0, NUM_COLORS);
-              if (!SEGCOLOR(2) || !SEGCOLOR(col)) col = 0;
-              popcorn[i].colIndex = col;
-            }
-          }
-        }
-        if (popcorn[i].pos >= 0.0f) { // draw now active popcorn (either active before or just popped)
-          uint32_t col = SEGMENT.color_wheel(popcorn[i].colIndex);
-          if (!SEGMENT.palette && popcorn[i].colIndex < NUM_COLORS) col = SEGCOLOR(popcorn[i].colIndex);
-          uint16_t ledIndex = popcorn[i].pos;
-          if (ledIndex < SEGLEN) SEGMENT.setPixelColor(indexToVStrip(ledIndex, stripNr), col);
+      popcorn.update(numPopcorn, gravity);
+      for (int i = 0; i < numPopcorn; i++) {
+        if (popcorn.pos[i] >= 0 || random8() >= 2) continue; // if kernel is inactive, randomly pop it
+        uint16_t peakHeight = 128 + random8(128); //0-255
+        peakHeight = (peakHeight * (SEGLEN -1)) >> 8;
+        byte col = random8();
+        if (!SEGMENT.palette) {
+          col = random8(0, NUM_COLORS);
+          if (!SEGCOLOR(2) || !SEGCOLOR(col)) col = 0;
         }
+        // v = sqrt(2*g*h), in 16.16: sqrt(2*g16*h) * 256
+        popcorn.emit(i, PS_ONE/100, int32_t(sqrtf(-2.0f * gravity * peakHeight) * 256.0f), col); // POP!!!
       }
+      popcorn.render(numPopcorn, stripNr, kernelColor);
     }
   };
 
   for (int stripNr=0; stripNr<strips; stripNr++)
-    virtualStrip::runStrip(stripNr, &popcorn[stripNr * maxNumPopcorn]);
+    virtualStrip::runStrip(stripNr, SEGENV.data + stripNr * dataSize);
 
   return FRAMETIME;
 }
@@ -3381,6 +3436,8 @@ static const char _data_FX_MODE_EXPLODING_FIREWORKS[] PROGMEM = "Fireworks 1D@Gr
 /*
  * Drip Effect
  * ported of: https://www.youtube.com/watch?v=sru2fXh4r7k
+ * falling and bouncing drops are pool particles; a drop still forming at the source is a free slot
+ * whose color index holds its size, falling drops have full brightness (255), bouncing ones are dimmed
  */
 uint16_t mode_drip(void)
 {
@@ -3388,77 +3445,62 @@ uint16_t mode_drip(void)
   //allocate segment data
   uint16_t strips = SEGMENT.nrOfVStrips();
   const int maxNumDrops = 4;
-  uint16_t dataSize = sizeof(spark) * maxNumDrops;
+  uint16_t dataSize = ParticlePool::dataSize(maxNumDrops);
   if (!SEGENV.allocateData(dataSize * strips)) return mode_static(); //allocation failed
-  Spark* drops = reinterpret_cast<Spark*>(SEGENV.data);
 
   if (!SEGMENT.check2) SEGMENT.fill(SEGCOLOR(1));
 
   struct virtualStrip {
-    static void runStrip(uint16_t stripNr, Spark* drops) {
+    static void runStrip(uint16_t stripNr, byte* data) {
+      const uint8_t sourcedrop = 12;
+      ParticlePool drops;
+      drops.attach(data, maxNumDrops);
+      if (SEGENV.call == 0) {
+        drops.clear();
+        for (int j=0;j<maxNumDrops;j++) drops.col[j] = sourcedrop; // start forming
+      }
 
       uint8_t numDrops = 1 + (SEGMENT.intensity >> 6); // 255>>6 = 3
 
-      float gravity = -0.0005 - (SEGMENT.speed/50000.0);
-      gravity *= max(1, SEGLEN-1);
-      int sourcedrop = 12;
+      // (0.0005 + speed/50000) * SEGLEN pixels per frame^2
+      int32_t gravity = -int32_t((int64_t)max(1, SEGLEN-1) * (25 + SEGMENT.speed) * PS_ONE / 50000);
+      if (gravity == 0) gravity = -1;
 
       for (int j=0;j<numDrops;j++) {
-        if (drops[j].colIndex == 0) { //init
-          drops[j].pos = SEGLEN-1;    // start at end
-          drops[j].vel = 0;           // speed
-          drops[j].col = sourcedrop;  // brightness
-          drops[j].colIndex = 1;      // drop state (0 init, 1 forming, 2 falling, 5 bouncing)
+        if (!drops.landed(j)) continue;
+        if (drops.col[j] == 255) {                  // falling drop hit bottom
+          drops.vel[j] = -drops.vel[j]/4;           // reverse velocity with damping
+          drops.col[j] = sourcedrop*2;              // bouncing
+        } else {                                    // already hit once, so back to forming
+          drops.pos[j] = -1;
+          drops.col[j] = sourcedrop;
         }
+      }
+      drops.update(numDrops, gravity, true);
 
-        SEGMENT.setPixelColor(indexToVStrip(SEGLEN-1, stripNr), color_blend(BLACK,SEGCOLOR(0), sourcedrop));// water source
-        if (drops[j].colIndex==1) {
-          if (drops[j].col>255) drops[j].col=255;
-          SEGMENT.setPixelColor(indexToVStrip(uint16_t(drops[j].pos), stripNr), color_blend(BLACK,SEGCOLOR(0),drops[j].col));
-
-          drops[j].col += map(SEGMENT.speed, 0, 255, 1, 6); // swelling
-
-          if (random8() < drops[j].col/10) {               // random drop
-            drops[j].colIndex=2;               //fall
-            drops[j].col=255;
-          }
+      SEGMENT.setPixelColor(indexToVStrip(SEGLEN-1, stripNr), color_blend(BLACK,SEGCOLOR(0), sourcedrop));// water source
+      for (int j=0;j<numDrops;j++) {
+        if (drops.pos[j] < 0) {                     // forming
+          SEGMENT.setPixelColor(indexToVStrip(SEGLEN-1, stripNr), color_blend(BLACK,SEGCOLOR(0),drops.col[j]));
+          drops.col[j] = qadd8(drops.col[j], map(SEGMENT.speed, 0, 255, 1, 6)); // swelling
+          if (random8() < drops.col[j]/10) drops.emit(j, (SEGLEN-1) * PS_ONE, 0, 255); // random drop, fall
+          continue;
         }
-        if (drops[j].colIndex > 1) {           // falling
-          if (drops[j].pos > 0) {              // fall until end of segment
-            drops[j].pos += drops[j].vel;
-            if (drops[j].pos < 0) drops[j].pos = 0;
-            drops[j].vel += gravity;           // gravity is negative
-
-            for (int i=1;i<7-drops[j].colIndex;i++) { // some minor math so we don't expand bouncing droplets
-              uint16_t pos = constrain(uint16_t(drops[j].pos) +i, 0, SEGLEN-1); //this is BAD, returns a pos >= SEGLEN occasionally
-              SEGMENT.setPixelColor(indexToVStrip(pos, stripNr), color_blend(BLACK,SEGCOLOR(0),drops[j].col/i)); //spread pixel with fade while falling
-            }
 
-            if (drops[j].colIndex > 2) {       // during bounce, some water is on the floor
-              SEGMENT.setPixelColor(indexToVStrip(0, stripNr), color_blend(SEGCOLOR(0),BLACK,drops[j].col));
-            }
-          } else {                             // we hit bottom
-            if (drops[j].colIndex > 2) {       // already hit once, so back to forming
-              drops[j].colIndex = 0;
-              drops[j].col = sourcedrop;
-
-            } else {
-
-              if (drops[j].colIndex==2) {      // init bounce
-                drops[j].vel = -drops[j].vel/4;// reverse velocity with damping
-                drops[j].pos += drops[j].vel;
-              }
-              drops[j].col = sourcedrop*2;
-              drops[j].colIndex = 5;           // bouncing
-            }
-          }
+        const bool bouncing = drops.col[j] != 255;
+        const int  pos = drops.pos[j] >> 16;
+        for (int i=1;i<(bouncing ? 2 : 5);i++) {    // some minor math so we don't expand bouncing droplets
+          SEGMENT.setPixelColor(indexToVStrip(MIN(pos + i, SEGLEN-1), stripNr), color_blend(BLACK,SEGCOLOR(0),drops.col[j]/i)); //spread pixel with fade while falling
+        }
+        if (bouncing) {                             // during bounce, some water is on the floor
+          SEGMENT.setPixelColor(indexToVStrip(0, stripNr), color_blend(SEGCOLOR(0),BLACK,drops.col[j]));
         }
       }
     }
   };
 
   for (int stripNr=0; stripNr<strips; stripNr++)
-    virtualStrip::runStrip(stripNr, &drops[stripNr*maxNumDrops]);
+    virtualStrip::runStrip(stripNr, SEGENV.data + stripNr * dataSize);
 
   return FRAMETIME;
 }
@@ -4753,11 +4795,12 @@ uint16_t mode_2DDrift() {              // By: Stepko   https://editor.soulmateli
   const uint16_t maxDim = MAX(cols, rows)/2;
   unsigned long t = millis() / (32 - (SEGMENT.speed>>3));
   unsigned long t_20 = t/20; // softhack007: pre-calculating this gives about 10% speedup
-  for (float i = 1; i < maxDim; i += 0.25) {
-    float angle = radians(t * (maxDim - i));
-    uint16_t myX = (cols>>1) + (uint16_t)(sin_t(angle) * i) + (cols%2);
-    uint16_t myY = (rows>>1) + (uint16_t)(cos_t(angle) * i) + (rows%2);
-    SEGMENT.setPixelColorXY(myX, myY, ColorFromPalette(SEGPALETTE, (i * 20) + t_20, 255, LINEARBLEND));
+  const unsigned t_deg = t % 1440; // angles in quarter degrees
+  for (int q = 4; q < 4*maxDim; q++) { // radius i = q/4
+    uint16_t angle = (t_deg * (4*maxDim - q)) % 1440 * 11651 >> 8; // quarter degrees to 65536 per turn
+    uint16_t myX = (cols>>1) + (int16_t)((sin16_t(angle) * q) / (4*32767)) + (cols%2);
+    uint16_t myY = (rows>>1) + (int16_t)((cos16_t(angle) * q) / (4*32767)) + (rows%2);
+    SEGMENT.setPixelColorXY(myX, myY, ColorFromPalette(SEGPALETTE, (q * 5) + t_20, 255, LINEARBLEND));
   }
   SEGMENT.blur(SEGMENT.intensity>>3);
 
@@ -4829,24 +4872,21 @@ static const char _data_FX_MODE_2DFRIZZLES[] PROGMEM = "Frizzles@X frequency,Y f
 ///////////////////////////////////////////
 //   2D Cellular Automata Game of life   //
 ///////////////////////////////////////////
-typedef struct ColorCount {
-  CRGB color;
-  int8_t count;
-} colorCount;
-
 uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https://natureofcode.com/book/chapter-7-cellular-automata/ and https://github.com/DougHaber/nlife-color
   if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
-  const uint16_t dataSize = sizeof(CRGB) * SEGMENT.length();  // using width*height prevents reallocation if mirroring is enabled
+  const uint16_t words = caWords(cols);
+  const size_t planeSize = sizeof(uint32_t) * words * rows;
   const uint16_t crcBufferLen = 2; //(SEGMENT.width() + SEGMENT.height())*71/100; // roughly sqrt(2)/2 for better repetition detection (Ewowi)
 
-  if (!SEGENV.allocateData(dataSize + sizeof(uint16_t)*crcBufferLen)) return mode_static(); //allocation failed
-  CRGB *prevLeds = reinterpret_cast<CRGB*>(SEGENV.data);
-  uint16_t *crcBuffer = reinterpret_cast<uint16_t*>(SEGENV.data + dataSize); 
+  if (!SEGENV.allocateData(2 * planeSize + sizeof(uint16_t)*crcBufferLen)) return mode_static(); //allocation failed
+  uint32_t *cells = reinterpret_cast<uint32_t*>(SEGENV.data);
+  uint32_t *nextCells = cells + words * rows;
+  uint16_t *crcBuffer = reinterpret_cast<uint16_t*>(SEGENV.data + 2 * planeSize);
 
-  CRGB backgroundColor = SEGCOLOR(1);
+  const uint32_t bgc = RGBW32(R(SEGCOLOR(1)), G(SEGCOLOR(1)), B(SEGCOLOR(1)), 0);
 
   if (SEGENV.call == 0 || strip.now - SEGMENT.step > 3000) {
     SEGENV.step = strip.now;
@@ -4854,75 +4894,61 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
     random16_set_seed(millis()>>2); //seed the random generator
 
     //give the leds random state and colors (based on intensity, colors from palette or all posible colors are chosen)
+    memset(cells, 0, planeSize);
     for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
       uint8_t state = random8()%2;
       if (state == 0)
-        SEGMENT.setPixelColorXY(x,y, backgroundColor);
-      else
+        SEGMENT.setPixelColorXY(x,y, bgc);
+      else {
+        caSet(cells + y * words, x);
         SEGMENT.setPixelColorXY(x,y, SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 255));
+      }
     }
-
-    for (int y = 0; y < rows; y++) for (int x = 0; x < cols; x++) prevLeds[XY(x,y)] = CRGB::Black;
     memset(crcBuffer, 0, sizeof(uint16_t)*crcBufferLen);
   } else if (strip.now - SEGENV.step < FRAMETIME_FIXED * (uint32_t)map(SEGMENT.speed,0,255,64,4)) {
     // update only when appropriate time passes (in 42 FPS slots)
     return FRAMETIME;
   }
 
-  //copy previous leds (save previous generation)
-  //NOTE: using lossy getPixelColor() is a benefit as endlessly repeating patterns will eventually fade out causing a reset
-  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) prevLeds[XY(x,y)] = SEGMENT.getPixelColorXY(x,y);
-
-  //calculate new leds
-  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-
-    colorCount colorsCount[9]; // count the different colors in the 3*3 matrix
-    for (int i=0; i<9; i++) colorsCount[i] = {backgroundColor, 0}; // init colorsCount
-
-    // iterate through neighbors and count them and their different colors
-    int neighbors = 0;
-    for (int i = -1; i <= 1; i++) for (int j = -1; j <= 1; j++) { // iterate through 3*3 matrix
-      if (i==0 && j==0) continue; // ignore itself
-      // wrap around segment
-      int16_t xx = x+i, yy = y+j;
-      if (x+i < 0) xx = cols-1; else if (x+i >= cols) xx = 0;
-      if (y+j < 0) yy = rows-1; else if (y+j >= rows) yy = 0;
-
-      uint16_t xy = XY(xx, yy); // previous cell xy to check
-      // count different neighbours and colors
-      if (prevLeds[xy] != backgroundColor) {
-        neighbors++;
-        bool colorFound = false;
-        int k;
-        for (k=0; k<9 && colorsCount[i].count != 0; k++)
-          if (colorsCount[k].color == prevLeds[xy]) {
-            colorsCount[k].count++;
-            colorFound = true;
-          }
-        if (!colorFound) colorsCount[k] = {prevLeds[xy], 1}; //add new color found in the array
+  // Rules of Life (B3/S23) with mutation: cells with 2 neighbours are birth candidates too
+  caStepLife(cells, nextCells, cols, rows, (1<<2) | (1<<3), (1<<2) | (1<<3));
+
+  // births first (they take the dominant color of their live neighbours in previous generation)
+  for (int y = 0; y < rows; y++) for (int i = 0; i < words; i++) {
+    uint32_t born = nextCells[y * words + i] & ~cells[y * words + i];
+    while (born) {
+      const int x = (i << 5) + __builtin_ctz(born);
+      born &= born - 1;
+      uint32_t nbCol[8];
+      int neighbors = 0;
+      for (int j = -1; j <= 1; j++) for (int k = -1; k <= 1; k++) { // iterate through 3*3 matrix
+        if (j==0 && k==0) continue; // ignore itself
+        const int xx = (x + k + cols) % cols, yy = (y + j + rows) % rows; // wrap around segment
+        if (caGet(cells + yy * words, xx)) nbCol[neighbors++] = SEGMENT.getPixelColorXY(xx, yy);
       }
-    } // i,j
-
-    // Rules of Life
-    uint32_t col = uint32_t(prevLeds[XY(x,y)]) & 0x00FFFFFF;  // uint32_t operator returns RGBA, we want RGBW -> cut off "alpha" byte
-    uint32_t bgc = RGBW32(backgroundColor.r, backgroundColor.g, backgroundColor.b, 0);
-    if      ((col != bgc) && (neighbors <  2)) SEGMENT.setPixelColorXY(x,y, bgc); // Loneliness
-    else if ((col != bgc) && (neighbors >  3)) SEGMENT.setPixelColorXY(x,y, bgc); // Overpopulation
-    else if ((col == bgc) && (neighbors == 3)) {                                  // Reproduction
-      // find dominant color and assign it to a cell
-      colorCount dominantColorCount = {backgroundColor, 0};
-      for (int i=0; i<9 && colorsCount[i].count != 0; i++)
-        if (colorsCount[i].count > dominantColorCount.count) dominantColorCount = colorsCount[i];
-      // assign the dominant color w/ a bit of randomness to avoid "gliders"
-      if (dominantColorCount.count > 0 && random8(128)) SEGMENT.setPixelColorXY(x,y, dominantColorCount.color);
-    } else if ((col == bgc) && (neighbors == 2) && !random8(128)) {               // Mutation
-      SEGMENT.setPixelColorXY(x,y, SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 255));
-    }
-    // else do nothing!
-  } //x,y
-
-  // calculate CRC16 of leds
-  uint16_t crc = crc16((const unsigned char*)prevLeds, dataSize);
+      if (neighbors == 3 && random8(128)) {                                         // Reproduction
+        // find dominant color (with 3 neighbours it is either the one that repeats or the first one)
+        uint32_t col = (nbCol[1] == nbCol[2]) ? nbCol[1] : nbCol[0];
+        SEGMENT.setPixelColorXY(x, y, col);
+      } else if (neighbors == 2 && !random8(128)) {                                 // Mutation
+        SEGMENT.setPixelColorXY(x, y, SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 255));
+      } else {
+        caClear(nextCells + y * words, x); // not born after all
+      }
+    }
+  }
+  // then deaths (Loneliness & Overpopulation)
+  for (int y = 0; y < rows; y++) for (int i = 0; i < words; i++) {
+    uint32_t died = cells[y * words + i] & ~nextCells[y * words + i];
+    while (died) {
+      SEGMENT.setPixelColorXY((i << 5) + __builtin_ctz(died), y, bgc);
+      died &= died - 1;
+    }
+  }
+  memcpy(cells, nextCells, planeSize);
+
+  // calculate CRC16 of cell states
+  uint16_t crc = crc16((const unsigned char*)cells, planeSize);
   // check if we had same CRC and reset if needed
   bool repetition = false;
   for (int i=0; i<crcBufferLen && !repetition; i++) repetition = (crc == crcBuffer[i]); // (Ewowi)
@@ -4937,6 +4963,45 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
 static const char _data_FX_MODE_2DGAMEOFLIFE[] PROGMEM = "Game Of Life@!;!,!;!;2";
 
 
+/////////////////////////////////////////
+//   2D Cellular Automata Elementary   //
+/////////////////////////////////////////
+// elementary 1D automaton (rule set by intensity), newest generation is drawn on top row and history scrolls down
+uint16_t mode_2DCAElementary(void) {
+  if (!strip.isMatrix) return mode_static(); // not a 2D set-up
+
+  const uint16_t cols = SEGMENT.virtualWidth();
+  const uint16_t words = caWords(cols);
+  if (!SEGENV.allocateData(2 * sizeof(uint32_t) * words)) return mode_static(); //allocation failed
+  uint32_t *cells = reinterpret_cast<uint32_t*>(SEGENV.data);
+  uint32_t *nextCells = cells + words;
+
+  if (SEGENV.call == 0 || SEGENV.aux0 != cols) {
+    SEGENV.aux0 = cols;
+    SEGENV.aux1 = 0; // generation
+    SEGENV.step = strip.now;
+    SEGMENT.fill(SEGCOLOR(1));
+    memset(cells, 0, sizeof(uint32_t) * words);
+    if (SEGMENT.check1) for (int x = 0; x < cols; x++) { if (random8() & 1) caSet(cells, x); } // random start
+    else                cells[(cols/2) >> 5] |= 1UL << ((cols/2) & 31); // single cell in the middle
+  } else if (strip.now - SEGENV.step < FRAMETIME_FIXED * (uint32_t)map(SEGMENT.speed,0,255,64,4)) {
+    return FRAMETIME;
+  } else {
+    SEGENV.step = strip.now;
+    caStepElementary(cells, nextCells, cols, SEGMENT.intensity);
+    memcpy(cells, nextCells, sizeof(uint32_t) * words);
+    SEGENV.aux1++;
+  }
+
+  SEGMENT.moveY(-1); // scroll history down
+  const uint32_t col = SEGMENT.color_from_palette(SEGENV.aux1, false, PALETTE_SOLID_WRAP, 0);
+  for (int x = 0; x < cols; x++) SEGMENT.setPixelColorXY(x, 0, caGet(cells, x) ? col : SEGCOLOR(1));
+
+  return FRAMETIME;
+} // mode_2DCAElementary()
+static const char _data_FX_MODE_2DCAELEMENTATY[] PROGMEM = "CA Elementary@!,Rule,,,,Random start;!,!;!;2;ix=30";
+
+
 /////////////////////////
 //     2D Hiphotic     //
 /////////////////////////
@@ -4981,9 +5046,6 @@ uint16_t mode_2DJulia(void) {                           // An animated Julia set
   if (!SEGENV.allocateData(sizeof(julia))) return mode_static();
   Julia* julias = reinterpret_cast<Julia*>(SEGENV.data);
 
-  float reAl;
-  float imAg;
-
   if (SEGENV.call == 0) {           // Reset the center if we've just re-started this animation.
     julias->xcen = 0.;
     julias->ycen = 0.;
@@ -5012,48 +5074,42 @@ uint16_t mode_2DJulia(void) {                           // An animated Julia set
   ymin = constrain(ymin, -0.8f, 1.0f);
   ymax = constrain(ymax, -0.8f, 1.0f);
 
-  float dx;                       // Delta x is mapped to the matrix size.
-  float dy;                       // Delta y is mapped to the matrix size.
-
-  int maxIterations = 15;         // How many iterations per pixel before we give up. Make it 8 bits to match our range of colours.
-  float maxCalc = 16.0;           // How big is each calculation allowed to be before we give up.
-
-  maxIterations = SEGMENT.intensity/2;
-
+  // the fractal is iterated in Q16 fixed point; |z|^2 is bailed out at 16, so |a|,|b| stay below 17
+  // and only the squares need 64 bit intermediates
+  const int32_t maxCalc = 16 << 16;   // How big is each calculation allowed to be before we give up.
+  int maxIterations = SEGMENT.intensity/2; // How many iterations per pixel before we give up.
 
   // Resize section on the fly for some animaton.
-  reAl = -0.94299f;               // PixelBlaze example
-  imAg = 0.3162f;
+  int32_t reAl = -61800;              // -0.94299, PixelBlaze example
+  int32_t imAg =  20723;              //  0.3162
+  reAl += sin16_t(((uint64_t)millis() * 2189) >> 6) / 10; // sin(millis()/305)/20
+  imAg += sin16_t(((uint64_t)millis() * 1648) >> 6) / 10; // sin(millis()/405)/20
 
-  reAl += sin_t((float)millis()/305.f)/20.f;
-  imAg += sin_t((float)millis()/405.f)/20.f;
-
-  dx = (xmax - xmin) / (cols);     // Scale the delta x and y values to our matrix size.
-  dy = (ymax - ymin) / (rows);
+  const int32_t dx = (xmax - xmin) * 65536.f / cols; // Scale the delta x and y values to our matrix size.
+  const int32_t dy = (ymax - ymin) * 65536.f / rows;
 
   // Start y
-  float y = ymin;
+  int32_t y = ymin * 65536.f;
   for (int j = 0; j < rows; j++) {
 
     // Start x
-    float x = xmin;
+    int32_t x = xmin * 65536.f;
     for (int i = 0; i < cols; i++) {
 
       // Now we test, as we iterate z = z^2 + c does z tend towards infinity?
-      float a = x;
-      float b = y;
+      int32_t a = x;
+      int32_t b = y;
       int iter = 0;
 
       while (iter < maxIterations) {    // Here we determine whether or not we're out of bounds.
-        float aa = a * a;
-        float bb = b * b;
-        float len = aa + bb;
-        if (len > maxCalc) {            // |z| = sqrt(a^2+b^2) OR z^2 = a^2+b^2 to save on having to perform a square root.
+        int32_t aa = ((int64_t)a * a) >> 16;
+        int32_t bb = ((int64_t)b * b) >> 16;
+        if (aa + bb > maxCalc) {        // |z| = sqrt(a^2+b^2) OR z^2 = a^2+b^2 to save on having to perform a square root.
           break;  // Bail
         }
 
        // This operation corresponds to z -> z^2+c where z=a+ib c=(x,y). Remember to use 'foil'.
-        b = 2*a*b + imAg;
+        b = (((int64_t)a * b) >> 15) + imAg;
         a = aa - bb + reAl;
         iter++;
       } // while
@@ -5458,6 +5514,7 @@ uint16_t mode_2DSunradiation(void) {                   // By: ldirko https://edi
 
   unsigned long t = millis() / 4;
   int index = 0;
+  const int heatDiv = 384 - SEGMENT.intensity;   // col / (3 - intensity/128)
   uint8_t someVal = SEGMENT.speed/4;             // Was 25.
   for (int j = 0; j < (rows + 2); j++) {
     for (int i = 0; i < (cols + 2); i++) {
@@ -5480,7 +5537,7 @@ uint16_t mode_2DSunradiation(void) {                   // By: ldirko https://edi
       int temp = difx * difx + dify * dify;
       int col = 255 - temp / 8; //8 its a size of effect
       if (col < 0) col = 0;
-      SEGMENT.setPixelColorXY(x, y, HeatColor(col / (3.0f-(float)(SEGMENT.intensity)/128.f)));
+      SEGMENT.setPixelColorXY(x, y, HeatColor(col * 128 / heatDiv));
     }
     yindex += (cols + 2);
   }
@@ -5700,8 +5757,10 @@ uint16_t mode_2Dghostrider(void) {
     CRGB color = CRGB::White;
     SEGMENT.wu_pixel(lighter->gPosX * 256 / 10, lighter->gPosY * 256 / 10, color);
 
-    lighter->gPosX += lighter->Vspeed * sin_t(radians(lighter->gAngle));
-    lighter->gPosY += lighter->Vspeed * cos_t(radians(lighter->gAngle));
+    // angles are in degrees, Q15 steps are truncated toward zero like the former float sums
+    auto angle16 = [](uint16_t deg) -> uint16_t { return (deg % 360) * 46603 >> 8; }; // 65536/360 in 8.8
+    lighter->gPosX = (lighter->gPosX * 32767 + lighter->Vspeed * sin16_t(angle16(lighter->gAngle))) / 32767;
+    lighter->gPosY = (lighter->gPosY * 32767 + lighter->Vspeed * cos16_t(angle16(lighter->gAngle))) / 32767;
     lighter->gAngle += lighter->angleSpeed;
     if (lighter->gPosX < 0)               lighter->gPosX = (cols - 1) * 10;
     if (lighter->gPosX > (cols - 1) * 10) lighter->gPosX = 0;
@@ -5723,8 +5782,8 @@ uint16_t mode_2Dghostrider(void) {
         lighter->time[i] = 0;
         lighter->reg[i] = false;
       } else {
-        lighter->lightersPosX[i] += -7 * sin_t(radians(lighter->Angle[i]));
-        lighter->lightersPosY[i] += -7 * cos_t(radians(lighter->Angle[i]));
+        lighter->lightersPosX[i] = (lighter->lightersPosX[i] * 32767 - 7 * sin16_t(angle16(lighter->Angle[i]))) / 32767;
+        lighter->lightersPosY[i] = (lighter->lightersPosY[i] * 32767 - 7 * cos16_t(angle16(lighter->Angle[i]))) / 32767;
       }
       SEGMENT.wu_pixel(lighter->lightersPosX[i] * 256 / 10, lighter->lightersPosY[i] * 256 / 10, ColorFromPalette(SEGPALETTE, (256 - lighter->time[i])));
     }
@@ -5741,89 +5800,90 @@ static const char _data_FX_MODE_2DGHOSTRIDER[] PROGMEM = "Ghost Rider@Fade rate,
 ////////////////////////////
 //// Floating Blobs by stepko (c)2021 [https://editor.soulmatelights.com/gallery/573-blobs], adapted by Blaz Kristan (AKA blazoncek)
 #define MAX_BLOBS 8
+// blob positions and speeds live in two particle pools (x and y axis), radius in 16.16 pixels after them
+// x pool color index is the blob color, y pool color index is set while the blob grows
 uint16_t mode_2Dfloatingblobs(void) {
   if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
 
-  typedef struct Blob {
-    float x[MAX_BLOBS], y[MAX_BLOBS];
-    float sX[MAX_BLOBS], sY[MAX_BLOBS]; // speed
-    float r[MAX_BLOBS];
-    bool grow[MAX_BLOBS];
-    byte color[MAX_BLOBS];
-  } blob_t;
-
   uint8_t Amount = (SEGMENT.intensity>>5) + 1; // NOTE: be sure to update MAX_BLOBS if you change this
 
-  if (!SEGENV.allocateData(sizeof(blob_t))) return mode_static(); //allocation failed
-  blob_t *blob = reinterpret_cast<blob_t*>(SEGENV.data);
+  const uint16_t poolSize = ParticlePool::dataSize(MAX_BLOBS);
+  if (!SEGENV.allocateData(2 * poolSize + MAX_BLOBS * sizeof(int32_t))) return mode_static(); //allocation failed
+  ParticlePool bx, by;
+  bx.attach(SEGENV.data, MAX_BLOBS);
+  by.attach(SEGENV.data + poolSize, MAX_BLOBS);
+  int32_t *r = reinterpret_cast<int32_t*>(SEGENV.data + 2 * poolSize);
+
+  // (cols - 1.01) and 0.01 pixels, the range a blob center may move in
+  const int32_t minPos = PS_ONE / 100;
+  const int32_t maxX = cols * PS_ONE - PS_ONE - minPos, maxY = rows * PS_ONE - PS_ONE - minPos;
+  const uint16_t speedDiv = 256 - SEGMENT.speed;
 
   if (SEGENV.aux0 != cols || SEGENV.aux1 != rows) {
     SEGENV.aux0 = cols; // re-initialise if virtual size changes
     SEGENV.aux1 = rows;
     SEGMENT.fill(BLACK);
     for (size_t i = 0; i < MAX_BLOBS; i++) {
-      blob->r[i]  = random8(1, cols>8 ? (cols/4) : 2);
-      blob->sX[i] = (float) random8(3, cols) / (float)(256 - SEGMENT.speed); // speed x
-      blob->sY[i] = (float) random8(3, rows) / (float)(256 - SEGMENT.speed); // speed y
-      blob->x[i]  = random8(0, cols-1);
-      blob->y[i]  = random8(0, rows-1);
-      blob->color[i] = random8();
-      blob->grow[i]  = (blob->r[i] < 1.f);
-      if (blob->sX[i] == 0) blob->sX[i] = 1;
-      if (blob->sY[i] == 0) blob->sY[i] = 1;
+      r[i]  = random8(1, cols>8 ? (cols/4) : 2) * PS_ONE;
+      bx.vel[i] = random8(3, cols) * PS_ONE / speedDiv; // speed x
+      by.vel[i] = random8(3, rows) * PS_ONE / speedDiv; // speed y
+      bx.pos[i] = random8(0, cols-1) * PS_ONE;
+      by.pos[i] = random8(0, rows-1) * PS_ONE;
+      bx.col[i] = random8();
+      by.col[i] = (r[i] < PS_ONE);
+      if (bx.vel[i] == 0) bx.vel[i] = PS_ONE;
+      if (by.vel[i] == 0) by.vel[i] = PS_ONE;
     }
   }
 
   SEGMENT.fadeToBlackBy(20);
 
+  // moves a blob center along one axis, slowing down near the edges (0.005 pixels are 328 units)
+  auto move = [](int32_t &pos, int32_t vel, int32_t radius, int32_t last) {
+    const int32_t rd = max(radius, int32_t(PS_ONE/4)); // keep the slowdown factor bounded for tiny blobs
+    if (pos + radius >= last)  pos += (int64_t(vel) * ((int64_t(last - pos) << 16) / rd + 328)) >> 16;
+    else if (pos - radius <= 0) pos += (int64_t(vel) * ((int64_t(pos) << 16) / rd + 328)) >> 16;
+    else                        pos += vel;
+  };
+
   // Bounce balls around
   for (size_t i = 0; i < Amount; i++) {
-    if (SEGENV.step < millis()) blob->color[i] = add8(blob->color[i], 4); // slowly change color
-    // change radius if needed
-    if (blob->grow[i]) {
+    if (SEGENV.step < millis()) bx.col[i] = add8(bx.col[i], 4); // slowly change color
+    // change radius if needed, by 1/20 of the faster axis speed
+    const int32_t dr = max(abs(bx.vel[i]), abs(by.vel[i])) / 20;
+    if (by.col[i]) {
       // enlarge radius until it is >= 4
-      blob->r[i] += (fabsf(blob->sX[i]) > fabsf(blob->sY[i]) ? fabsf(blob->sX[i]) : fabsf(blob->sY[i])) * 0.05f;
-      if (blob->r[i] >= MIN(cols/4.f,2.f)) {
-        blob->grow[i] = false;
-      }
+      r[i] += dr;
+      if (r[i] >= MIN(cols * PS_ONE / 4, 2 * PS_ONE)) by.col[i] = false;
     } else {
       // reduce radius until it is < 1
-      blob->r[i] -= (fabsf(blob->sX[i]) > fabsf(blob->sY[i]) ? fabsf(blob->sX[i]) : fabsf(blob->sY[i])) * 0.05f;
-      if (blob->r[i] < 1.f) {
-        blob->grow[i] = true;
-      }
-    }
-    uint32_t c = SEGMENT.color_from_palette(blob->color[i], false, false, 0);
-    if (blob->r[i] > 1.f) SEGMENT.fill_circle(blob->x[i], blob->y[i], roundf(blob->r[i]), c);
-    else                  SEGMENT.setPixelColorXY(blob->x[i], blob->y[i], c);
-    // move x
-    if (blob->x[i] + blob->r[i] >= cols - 1) blob->x[i] += (blob->sX[i] * ((cols - 1 - blob->x[i]) / blob->r[i] + 0.005f));
-    else if (blob->x[i] - blob->r[i] <= 0)   blob->x[i] += (blob->sX[i] * (blob->x[i] / blob->r[i] + 0.005f));
-    else                                     blob->x[i] += blob->sX[i];
-    // move y
-    if (blob->y[i] + blob->r[i] >= rows - 1) blob->y[i] += (blob->sY[i] * ((rows - 1 - blob->y[i]) / blob->r[i] + 0.005f));
-    else if (blob->y[i] - blob->r[i] <= 0)   blob->y[i] += (blob->sY[i] * (blob->y[i] / blob->r[i] + 0.005f));
-    else                                     blob->y[i] += blob->sY[i];
+      r[i] -= dr;
+      if (r[i] < PS_ONE) by.col[i] = true;
+    }
+    uint32_t c = SEGMENT.color_from_palette(bx.col[i], false, false, 0);
+    const uint16_t x = bx.pos[i] >> 16, y = by.pos[i] >> 16;
+    if (r[i] > PS_ONE) SEGMENT.fill_circle(x, y, (r[i] + PS_ONE/2) >> 16, c);
+    else               SEGMENT.setPixelColorXY(x, y, c);
+    move(bx.pos[i], bx.vel[i], r[i], (cols - 1) * PS_ONE);
+    move(by.pos[i], by.vel[i], r[i], (rows - 1) * PS_ONE);
     // bounce x
-    if (blob->x[i] < 0.01f) {
-      blob->sX[i] = (float)random8(3, cols) / (256 - SEGMENT.speed);
-      blob->x[i]  = 0.01f;
-    } else if (blob->x[i] > (float)cols - 1.01f) {
-      blob->sX[i] = (float)random8(3, cols) / (256 - SEGMENT.speed);
-      blob->sX[i] = -blob->sX[i];
-      blob->x[i]  = (float)cols - 1.01f;
+    if (bx.pos[i] < minPos) {
+      bx.vel[i] = random8(3, cols) * PS_ONE / speedDiv;
+      bx.pos[i] = minPos;
+    } else if (bx.pos[i] > maxX) {
+      bx.vel[i] = -(random8(3, cols) * PS_ONE / speedDiv);
+      bx.pos[i] = maxX;
     }
     // bounce y
-    if (blob->y[i] < 0.01f) {
-      blob->sY[i] = (float)random8(3, rows) / (256 - SEGMENT.speed);
-      blob->y[i]  = 0.01f;
-    } else if (blob->y[i] > (float)rows - 1.01f) {
-      blob->sY[i] = (float)random8(3, rows) / (256 - SEGMENT.speed);
-      blob->sY[i] = -blob->sY[i];
-      blob->y[i]  = (float)rows - 1.01f;
+    if (by.pos[i] < minPos) {
+      by.vel[i] = random8(3, rows) * PS_ONE / speedDiv;
+      by.pos[i] = minPos;
+    } else if (by.pos[i] > maxY) {
+      by.vel[i] = -(random8(3, rows) * PS_ONE / speedDiv);
+      by.pos[i] = maxY;
     }
   }
   SEGMENT.blur(SEGMENT.custom1>>2);
@@ -5839,6 +5899,12 @@ static const char _data_FX_MODE_2DBLOBS[] PROGMEM = "Blobs@!,# blobs,Blur;!;!;2;
 ////////////////////////////
 //     2D Scrolling text  //
 ////////////////////////////
+typedef struct TextStrip {
+  uint16_t len;                          // rasterized columns (followed by column data)
+  uint8_t  w, h;                         // font size
+  char     text[WLED_MAX_SEGNAME_LEN+2]; // rasterized text (even size keeps column data aligned)
+} textStrip;
+
 uint16_t mode_2Dscrollingtext(void) {
   if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
@@ -5884,6 +5950,18 @@ uint16_t mode_2Dscrollingtext(void) {
   }
   const int numberOfLetters = strlen(text);
 
+  // text is rasterized into a 1 bit glyph strip only when text or font changes
+  const size_t stripLen = numberOfLetters * letterWidth;
+  if (!SEGENV.allocateData(sizeof(TextStrip) + stripLen * sizeof(uint16_t))) return mode_static(); //allocation failed
+  TextStrip *glyphs = reinterpret_cast<TextStrip*>(SEGENV.data);
+  uint16_t *columns = reinterpret_cast<uint16_t*>(SEGENV.data + sizeof(TextStrip));
+  if (glyphs->w != letterWidth || glyphs->h != letterHeight || strcmp(glyphs->text, text)) {
+    glyphs->w = letterWidth;
+    glyphs->h = letterHeight;
+    strcpy(glyphs->text, text);
+    glyphs->len = SEGMENT.rasterizeText(text, letterWidth, letterHeight, columns, stripLen);
+  }
+
   if (SEGENV.step < millis()) {
     if ((numberOfLetters * letterWidth) > cols) ++SEGENV.aux0 %= (numberOfLetters * letterWidth) + cols;      // offset
     else                                          SEGENV.aux0  = (cols + (numberOfLetters * letterWidth))/2;
@@ -5894,16 +5972,14 @@ uint16_t mode_2Dscrollingtext(void) {
         SEGMENT.blendPixelColorXY(x, y, SEGCOLOR(1), 255 - (SEGMENT.custom1>>1));
     }
   }
-  for (int i = 0; i < numberOfLetters; i++) {
-    if (int(cols) - int(SEGENV.aux0) + letterWidth*(i+1) < 0) continue; // don't draw characters off-screen
-    uint32_t col1 = SEGMENT.color_from_palette(SEGENV.aux1, false, PALETTE_SOLID_WRAP, 0);
-    uint32_t col2 = BLACK;
-    if (SEGMENT.check1 && SEGMENT.palette == 0) {
-      col1 = SEGCOLOR(0);
-      col2 = SEGCOLOR(2);
-    }
-    SEGMENT.drawCharacter(text[i], int(cols) - int(SEGENV.aux0) + letterWidth*i, yoffset, letterWidth, letterHeight, col1, col2);
+  uint32_t col1 = SEGMENT.color_from_palette(SEGENV.aux1, false, PALETTE_SOLID_WRAP, 0);
+  uint32_t col2 = BLACK;
+  if (SEGMENT.check1 && SEGMENT.palette == 0) {
+    col1 = SEGCOLOR(0);
+    col2 = SEGCOLOR(2);
   }
+  // scrolling only moves visible window over glyph strip
+  SEGMENT.drawGlyphStrip(columns, glyphs->len, int(cols) - int(SEGENV.aux0), yoffset, letterHeight, col1, col2);
 
   return FRAMETIME;
 }
@@ -5920,9 +5996,10 @@ uint16_t mode_2Ddriftrose(void) {
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
 
-  const float CX = (cols-cols%2)/2.f - .5f;
-  const float CY = (rows-rows%2)/2.f - .5f;
-  const float L = min(cols, rows) / 2.f;
+  // centre and radius in 1/510 pixel units, as wu_pixel() takes *255 coordinates
+  const int CX = (cols-cols%2)*255 - 255;
+  const int CY = (rows-rows%2)*255 - 255;
+  const int L = min(cols, rows);
 
   if (SEGENV.call == 0) {
     SEGMENT.fill(BLACK);
@@ -5930,8 +6007,9 @@ uint16_t mode_2Ddriftrose(void) {
 
   SEGMENT.fadeToBlackBy(32+(SEGMENT.speed>>3));
   for (size_t i = 1; i < 37; i++) {
-    uint32_t x = (CX + (sin_t(radians(i * 10)) * (beatsin8(i, 0, L*2)-L))) * 255.f;
-    uint32_t y = (CY + (cos_t(radians(i * 10)) * (beatsin8(i, 0, L*2)-L))) * 255.f;
+    int r = 2*beatsin8(i, 0, L) - L;
+    uint32_t x = (CX + (((sin16_t(i * 1820) * r) >> 8) * 255 >> 7)) / 2;
+    uint32_t y = (CY + (((cos16_t(i * 1820) * r) >> 8) * 255 >> 7)) / 2;
     SEGMENT.wu_pixel(x, y, CHSV(i * 10, 255, 255));
   }
   SEGMENT.blur((SEGMENT.intensity>>4)+1);
@@ -6102,12 +6180,14 @@ uint16_t mode_2DSwirl(void) {
 
   // printUmData();
 
-  SEGMENT.addPixelColorXY( i, j, ColorFromPalette(SEGPALETTE, (ms / 11 + volumeSmth*4), volumeRaw * SEGMENT.intensity / 64, LINEARBLEND)); //CHSV( ms / 11, 200, 255);
-  SEGMENT.addPixelColorXY( j, i, ColorFromPalette(SEGPALETTE, (ms / 13 + volumeSmth*4), volumeRaw * SEGMENT.intensity / 64, LINEARBLEND)); //CHSV( ms / 13, 200, 255);
-  SEGMENT.addPixelColorXY(ni,nj, ColorFromPalette(SEGPALETTE, (ms / 17 + volumeSmth*4), volumeRaw * SEGMENT.intensity / 64, LINEARBLEND)); //CHSV( ms / 17, 200, 255);
-  SEGMENT.addPixelColorXY(nj,ni, ColorFromPalette(SEGPALETTE, (ms / 29 + volumeSmth*4), volumeRaw * SEGMENT.intensity / 64, LINEARBLEND)); //CHSV( ms / 29, 200, 255);
-  SEGMENT.addPixelColorXY( i,nj, ColorFromPalette(SEGPALETTE, (ms / 37 + volumeSmth*4), volumeRaw * SEGMENT.intensity / 64, LINEARBLEND)); //CHSV( ms / 37, 200, 255);
-  SEGMENT.addPixelColorXY(ni, j, ColorFromPalette(SEGPALETTE, (ms / 41 + volumeSmth*4), volumeRaw * SEGMENT.intensity / 64, LINEARBLEND)); //CHSV( ms / 41, 200, 255);
+  const uint16_t volIdx = volumeSmth*4; // palette shift, converted once instead of per pixel
+  const uint8_t  volBri = volumeRaw * SEGMENT.intensity / 64;
+  SEGMENT.addPixelColorXY( i, j, ColorFromPalette(SEGPALETTE, (ms / 11 + volIdx), volBri, LINEARBLEND)); //CHSV( ms / 11, 200, 255);
+  SEGMENT.addPixelColorXY( j, i, ColorFromPalette(SEGPALETTE, (ms / 13 + volIdx), volBri, LINEARBLEND)); //CHSV( ms / 13, 200, 255);
+  SEGMENT.addPixelColorXY(ni,nj, ColorFromPalette(SEGPALETTE, (ms / 17 + volIdx), volBri, LINEARBLEND)); //CHSV( ms / 17, 200, 255);
+  SEGMENT.addPixelColorXY(nj,ni, ColorFromPalette(SEGPALETTE, (ms / 29 + volIdx), volBri, LINEARBLEND)); //CHSV( ms / 29, 200, 255);
+  SEGMENT.addPixelColorXY( i,nj, ColorFromPalette(SEGPALETTE, (ms / 37 + volIdx), volBri, LINEARBLEND)); //CHSV( ms / 37, 200, 255);
+  SEGMENT.addPixelColorXY(ni, j, ColorFromPalette(SEGPALETTE, (ms / 41 + volIdx), volBri, LINEARBLEND)); //CHSV( ms / 41, 200, 255);
 
   return FRAMETIME;
 } // mode_2DSwirl()
@@ -7155,7 +7235,6 @@ uint16_t mode_2DFunkyPlank(void) {              // Written by ??? Adapted by Wil
   if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
   const uint16_t cols = SEGMENT.virtualWidth();
-  const uint16_t rows = SEGMENT.virtualHeight();
 
   int NUMB_BANDS = map(SEGMENT.custom1, 0, 255, 1, 16);
   int barWidth = (cols / NUMB_BANDS);
@@ -7193,11 +7272,7 @@ uint16_t mode_2DFunkyPlank(void) {              // Written by ??? Adapted by Wil
     }
 
     // Update the display:
-    for (int i = (rows - 1); i > 0; i--) {
-      for (int j = (cols - 1); j >= 0; j--) {
-        SEGMENT.setPixelColorXY(j, i, SEGMENT.getPixelColorXY(j, i-1));
-      }
-    }
+    SEGMENT.moveY(-1); // scroll down by one row
   }
 
   return FRAMETIME;
@@ -7508,8 +7583,9 @@ uint16_t mode_2Doctopus() {
     const int C_Y = (rows / 2) + ((SEGMENT.custom2 - 128)*rows)/255;
     for (int x = 0; x < cols; x++) {
       for (int y = 0; y < rows; y++) {
-        rMap[XY(x, y)].angle  = 40.7436f * atan2f((y - C_Y), (x - C_X));  // avoid 128*atan2()/PI
-        rMap[XY(x, y)].radius = hypotf((x - C_X), (y - C_Y)) * mapp;      //thanks Sutaburosu
+        const int dx = x - C_X, dy = y - C_Y;
+        rMap[XY(x, y)].angle  = atan2_16(dy, dx) >> 8;                    // 256 per turn
+        rMap[XY(x, y)].radius = hypot16_t(dx * mapp, dy * mapp);         // hypot() * mapp, thanks Sutaburosu
       }
     }
   }
@@ -7773,6 +7849,7 @@ void WS2812FX::setupEffectData() {
   addEffect(FX_MODE_2DCOLOREDBURSTS, &mode_2DColoredBursts, _data_FX_MODE_2DCOLOREDBURSTS);
   addEffect(FX_MODE_2DJULIA, &mode_2DJulia, _data_FX_MODE_2DJULIA);
 
+  addEffect(FX_MODE_2DCAELEMENTATY, &mode_2DCAElementary, _data_FX_MODE_2DCAELEMENTATY);
   addEffect(FX_MODE_2DGAMEOFLIFE, &mode_2Dgameoflife, _data_FX_MODE_2DGAMEOFLIFE);
   addEffect(FX_MODE_2DTARTAN, &mode_2Dtartan, _data_FX_MODE_2DTARTAN);
   addEffect(FX_MODE_2DPOLARLIGHTS, &mode_2DPolarLights, _data_FX_MODE_2DPOLARLIGHTS);
@@ -303,7 +303,7 @@
 #define FX_MODE_2DJULIA                168
 // #define FX_MODE_2DPOOLNOISE            169 //have been removed in WLED SR in the past because of low mem but should be added back
 // #define FX_MODE_2DTWISTER              170 //have been removed in WLED SR in the past because of low mem but should be added back
-// #define FX_MODE_2DCAELEMENTATY         171 //have been removed in WLED SR in the past because of low mem but should be added back
+#define FX_MODE_2DCAELEMENTATY         171
 #define FX_MODE_2DGAMEOFLIFE           172
 #define FX_MODE_2DTARTAN               173
 #define FX_MODE_2DPOLARLIGHTS          174
@@ -370,6 +370,7 @@ typedef struct Segment {
     };
     uint8_t startY;  // start Y coodrinate 2D (top); there should be no more than 255 rows
     uint8_t stopY;   // stop Y coordinate 2D (bottom); there should be no more than 255 rows
+    uint8_t renderScale; // 2D effects render at 1/2^renderScale resolution (0-2), bilinearly upscaled when compositing
     char    *name;
 
     // runtime data
@@ -399,6 +400,45 @@ typedef struct Segment {
     static CRGBPalette16 _randomPalette;
     static CRGBPalette16 _newRandomPalette;
     static unsigned long _lastPaletteChange;
+    static uint8_t       _paletteVersion; // incremented when custom palettes or gamma change (invalidates all cached palettes)
+
+    // resolved palette cache, rebuilt by getPalette() only when palette ID, effect default or colors change
+    CRGBPalette16 _palCache;
+    uint32_t      _palCacheColors[NUM_COLORS]; // colors used when building _palCache (palettes 2-5)
+    uint8_t       _palCacheId;                 // resolved palette ID held in _palCache
+    uint8_t       _palCacheVersion;            // _paletteVersion at the time _palCache was built (0 = invalid)
+
+    // render buffer (RGBW, virtual resolution) written by effects and composited into the strip by renderPixels()
+    uint32_t     *_pixels;
+    uint16_t      _pixW, _pixH;                // dimensions of _pixels (1D segments use _pixH == 1)
+    uint32_t     *_upPixels;                   // full resolution copy of _pixels composited into the strip (only if _scale > 0)
+    uint16_t      _upW, _upH;                  // dimensions of _upPixels (virtual dimensions before render scaling)
+    uint8_t       _scale;                      // effective render scale (renderScale if render buffers could be allocated, else 0)
+
+    // render buffer to bus pixel map compiled by compilePixelMap() (grouping, spacing, reverse, mirror,
+    // transpose, offset and ledmap folded in), one entry per run of bus pixels
+    struct PixelRun {
+      uint16_t phys;                           // first bus pixel
+      uint16_t virt;                           // first render buffer pixel
+      uint16_t len;
+      int8_t   physStep;                       // 1 or -1
+      int8_t   virtStep;                       // 1, -1 or 0 (grouping)
+    }            *_map;
+    uint16_t      _mapRuns;
+    struct MapLayout {
+      uint16_t start, stop, startY, stopY, offset, options;
+      uint8_t  grouping, spacing, version;
+    }             _mapLayout;                  // layout _map was compiled for (_map == nullptr: compile failed)
+    static uint8_t   _layoutVersion;           // incremented when ledmap, matrix or busses change (invalidates all maps)
+    static uint16_t *_mapTemp;                 // render buffer index per segment pixel while compiling map
+
+    // M12_pArc expansion for a _arcW x _arcH render buffer: _arcLen+1 offsets followed by buffer indices
+    uint16_t     *_arc;
+    uint16_t      _arcLen, _arcW, _arcH;
+
+    // render context, evaluated once per frame by beginFrame() instead of on every pixel write
+    uint16_t      _vWidth, _vHeight, _vLength;  // virtualWidth(), virtualHeight(), virtualLength()
+    uint8_t       _frameBri;                   // currentBri(on ? opacity : 0)
 
     // transition data, valid only if transitional==true, holds values during transition (72 bytes)
     struct Transition {
@@ -435,6 +475,19 @@ typedef struct Segment {
       }
     } *_t;
 
+    void emitPixel(uint16_t i, uint32_t col);       // write expanded pixel to strip (or map while compiling)
+    uint16_t mappedWidth(void) const;               // virtualWidth() before render scaling
+    uint16_t mappedHeight(void) const;              // virtualHeight() before render scaling
+    // returns render buffer if it is allocated with given dimensions (so raster operations may work on memory directly)
+    inline uint32_t *renderBuffer(uint16_t w, uint16_t h) const { return (_pixels && _pixW == w && _pixH == h) ? _pixels : nullptr; }
+  #ifndef WLED_DISABLE_2D
+    bool buildArcTable(void);                       // precomputes M12_pArc expansion for current render buffer
+  #endif
+    void expandPixel(int i, uint32_t col);          // write virtual 1D pixel to strip (grouping, reverse, mirror, offset)
+  #ifndef WLED_DISABLE_2D
+    void expandPixelXY(int x, int y, uint32_t col); // write virtual 2D pixel to strip (grouping, reverse, transpose, mirror)
+  #endif
+
   public:
 
     Segment(uint16_t sStart=0, uint16_t sStop=30) :
@@ -459,6 +512,7 @@ typedef struct Segment {
       check3(false),
       startY(0),
       stopY(1),
+      renderScale(0),
       name(nullptr),
       next_time(0),
       step(0),
@@ -468,14 +522,36 @@ typedef struct Segment {
       data(nullptr),
       _capabilities(0),
       _dataLen(0),
+      _palCacheId(0),
+      _palCacheVersion(0),
+      _pixels(nullptr),
+      _pixW(0),
+      _pixH(0),
+      _upPixels(nullptr),
+      _upW(0),
+      _upH(0),
+      _scale(0),
+      _map(nullptr),
+      _mapRuns(0),
+      _arc(nullptr),
+      _arcLen(0),
+      _arcW(0),
+      _arcH(0),
+      _vWidth(0),
+      _vHeight(0),
+      _vLength(0),
+      _frameBri(0),
       _t(nullptr)
     {
       //refreshLightCapabilities();
+      memset(&_mapLayout, 0, sizeof(_mapLayout));
+      beginFrame();
     }
 
     Segment(uint16_t sStartX, uint16_t sStopX, uint16_t sStartY, uint16_t sStopY) : Segment(sStartX, sStopX) {
       startY = sStartY;
       stopY  = sStopY;
+      beginFrame();
     }
 
     Segment(const Segment &orig); // copy constructor
@@ -491,13 +567,14 @@ typedef struct Segment {
       if (name) { delete[] name; name = nullptr; }
       if (_t)   { transitional = false; delete _t; _t = nullptr; }
       deallocateData();
+      deallocatePixels();
     }
 
     Segment& operator= (const Segment &orig); // copy assignment
     Segment& operator= (Segment &&orig) noexcept; // move assignment
 
 #ifdef WLED_DEBUG
-    size_t getSize() const { return sizeof(Segment) + (data?_dataLen:0) + (name?strlen(name):0) + (_t?sizeof(Transition):0); }
+    size_t getSize() const { return sizeof(Segment) + (data?_dataLen:0) + (name?strlen(name):0) + (_t?sizeof(Transition):0) + (_pixels?_pixW*_pixH*sizeof(uint32_t):0) + (_upPixels?_upW*_upH*sizeof(uint32_t)+upscaleScratchSize(_upW):0) + _mapRuns*sizeof(PixelRun) + (_arc?(_arcLen+1+_arc[_arcLen])*sizeof(uint16_t):0); }
 #endif
 
     inline bool     getOption(uint8_t n) const { return ((options >> n) & 0x01); }
@@ -516,6 +593,8 @@ typedef struct Segment {
     static uint16_t getUsedSegmentData(void)    { return _usedSegmentData; }
     static void     addUsedSegmentData(int len) { _usedSegmentData += len; }
     static void     handleRandomPalette();
+    static void     invalidatePaletteCache(void) { if (!++_paletteVersion) _paletteVersion++; } // 0 is reserved for invalid cache
+    static void     invalidatePixelMaps(void)    { if (!++_layoutVersion) _layoutVersion++; }   // 0 is reserved for invalid map
 
     void    setUp(uint16_t i1, uint16_t i2, uint8_t grp=1, uint8_t spc=0, uint16_t ofs=UINT16_MAX, uint16_t i1Y=0, uint16_t i2Y=1, uint8_t segId = 255);
     bool    setColor(uint8_t slot, uint32_t c); //returns true if changed
@@ -540,6 +619,13 @@ typedef struct Segment {
       */
     inline void markForReset(void) { reset = true; }  // setOption(SEG_OPTION_RESET, true)
 
+    // render buffer functions
+    void beginFrame(void);       // evaluates render context (virtual dimensions, opacity & transition brightness)
+    bool allocatePixels(void);   // (re)allocates render buffer if virtual dimensions changed, returns false if out of memory
+    void deallocatePixels(void);
+    bool compilePixelMap(void);  // (re)builds render buffer to bus pixel map if layout changed, returns false if out of memory
+    void renderPixels(void);     // composites render buffer into strip (opacity, grouping, spacing, mirror, reverse, offset, ledmap)
+
     // transition functions
     void     startTransition(uint16_t dur); // transition has to start before actual segment values change
     void     handleTransition(void);
@@ -547,8 +633,10 @@ typedef struct Segment {
     uint8_t  currentBri(uint8_t briNew, bool useCct = false);
     uint8_t  currentMode(uint8_t modeNew);
     uint32_t currentColor(uint8_t slot, uint32_t colorNew);
+    uint8_t  resolvePalette(uint8_t pal) const; // validates palette ID and applies effect specific default palette
     CRGBPalette16 &loadPalette(CRGBPalette16 &tgt, uint8_t pal);
     CRGBPalette16 &currentPalette(CRGBPalette16 &tgt, uint8_t paletteID);
+    const CRGBPalette16 &getPalette(void); // segment palette (cached), does not include transition blending
 
     // 1D strip
     uint16_t virtualLength(void) const;
@@ -604,9 +692,12 @@ typedef struct Segment {
     void fill_circle(uint16_t cx, uint16_t cy, uint8_t radius, CRGB c);
     void drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t c);
     void drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, CRGB c) { drawLine(x0, y0, x1, y1, RGBW32(c.r,c.g,c.b,0)); } // automatic inline
+    void blit(const uint32_t *src, int x, int y, uint16_t w, uint16_t h); // copies w*h pixel array to x,y (clipped)
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color, uint32_t col2 = 0);
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB c) { drawCharacter(chr, x, y, w, h, RGBW32(c.r,c.g,c.b,0)); } // automatic inline
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB c, CRGB c2) { drawCharacter(chr, x, y, w, h, RGBW32(c.r,c.g,c.b,0), RGBW32(c2.r,c2.g,c2.b,0)); } // automatic inline
+    static uint16_t rasterizeText(const char *text, uint8_t w, uint8_t h, uint16_t *columns, size_t maxColumns); // renders text into 1 bit glyph strip (bit i of column = glyph row i), returns number of columns
+    void drawGlyphStrip(const uint16_t *columns, uint16_t len, int x, int y, uint8_t h, uint32_t color, uint32_t col2 = 0); // draws glyph strip with vertical color gradient
     void wu_pixel(uint32_t x, uint32_t y, CRGB c);
     void blur1d(fract8 blur_amount); // blur all rows in 1 dimension
     void blur2d(fract8 blur_amount) { blur(blur_amount); }
@@ -636,8 +727,11 @@ typedef struct Segment {
     void fill_circle(uint16_t cx, uint16_t cy, uint8_t radius, CRGB c) {}
     void drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint32_t c) {}
     void drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, CRGB c) {}
+    void blit(const uint32_t *src, int x, int y, uint16_t w, uint16_t h) {}
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color) {}
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB color) {}
+    static uint16_t rasterizeText(const char *text, uint8_t w, uint8_t h, uint16_t *columns, size_t maxColumns) { return 0; }
+    void drawGlyphStrip(const uint16_t *columns, uint16_t len, int x, int y, uint8_t h, uint32_t color, uint32_t col2 = 0) {}
     void wu_pixel(uint32_t x, uint32_t y, CRGB c) {}
   #endif
 } segment;
@@ -915,10 +1009,8 @@ class WS2812FX {  // 96 bytes
     uint8_t _qGrouping, _qSpacing;
     uint16_t _qOffset;
 
-    uint8_t
-      estimateCurrentAndLimitBri(void);
-
     void
+      estimateCurrentAndLimitBri(void),
       setUpSegmentFromQueuedChanges(void);
 };
 
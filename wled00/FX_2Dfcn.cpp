@@ -22,6 +22,7 @@
 
   Parts of the code adapted from WLED Sound Reactive
 */
+#include <algorithm>
 #include "wled.h"
 #include "FX.h"
 #include "palettes.h"
@@ -35,6 +36,7 @@
 // but ledmap takes care of that. ledmap is constructed upon initialization
 // so matrix should disable regular ledmap processing
 void WS2812FX::setUpMatrix() {
+  Segment::invalidatePixelMaps(); // matrix dimensions and ledmap change
 #ifndef WLED_DISABLE_2D
   // erase old ledmap, just in case.
   if (customMappingTable != nullptr) delete[] customMappingTable;
@@ -189,17 +191,22 @@ uint32_t WS2812FX::getPixelColorXY(uint16_t x, uint16_t y) {
 
 // XY(x,y) - gets pixel index within current segment (often used to reference leds[] array element)
 uint16_t /*IRAM_ATTR*/ Segment::XY(uint16_t x, uint16_t y) {
-  uint16_t width  = virtualWidth();   // segment width in logical pixels (can be 0 if segment is inactive)
-  uint16_t height = virtualHeight();  // segment height in logical pixels (is always >= 1)
+  uint16_t width  = _vWidth;   // segment width in logical pixels (can be 0 if segment is inactive)
+  uint16_t height = _vHeight;  // segment height in logical pixels (is always >= 1)
   return isActive() ? (x%width) + (y%height) * width : 0;
 }
 
 void /*IRAM_ATTR*/ Segment::setPixelColorXY(int x, int y, uint32_t col)
 {
   if (!isActive()) return; // not active
-  if (x >= virtualWidth() || y >= virtualHeight() || x<0 || y<0) return;  // if pixel would fall out of virtual segment just exit
+  if (_pixels) {
+    if (x >= 0 && y >= 0 && x < _pixW && y < _pixH) _pixels[x + y * _pixW] = col;
+    return;
+  }
+  if (x >= _vWidth || y >= _vHeight || x<0 || y<0) return;  // if pixel would fall out of virtual segment just exit
 
-  uint8_t _bri_t = currentBri(on ? opacity : 0);
+  // no render buffer, write directly into strip
+  uint8_t _bri_t = _frameBri;
   if (_bri_t < 255) {
     byte r = scale8(R(col), _bri_t);
     byte g = scale8(G(col), _bri_t);
@@ -207,9 +214,13 @@ void /*IRAM_ATTR*/ Segment::setPixelColorXY(int x, int y, uint32_t col)
     byte w = scale8(W(col), _bri_t);
     col = RGBW32(r, g, b, w);
   }
+  expandPixelXY(x, y, col);
+}
 
-  if (reverse  ) x = virtualWidth()  - x - 1;
-  if (reverse_y) y = virtualHeight() - y - 1;
+void /*IRAM_ATTR*/ Segment::expandPixelXY(int x, int y, uint32_t col)
+{
+  if (reverse  ) x = (_scale ? _upW : _vWidth)  - x - 1; // composited at full resolution if render scaled
+  if (reverse_y) y = (_scale ? _upH : _vHeight) - y - 1;
   if (transpose) { uint16_t t = x; x = y; y = t; } // swap X & Y if segment transposed
 
   x *= groupLength(); // expand to physical pixels
@@ -221,18 +232,18 @@ void /*IRAM_ATTR*/ Segment::setPixelColorXY(int x, int y, uint32_t col)
       uint16_t xX = (x+g), yY = (y+j);
       if (xX >= width() || yY >= height()) continue; // we have reached one dimension's end
 
-      strip.setPixelColorXY(start + xX, startY + yY, col);
+      emitPixel(start + xX + (startY + yY) * Segment::maxWidth, col);
 
       if (mirror) { //set the corresponding horizontally mirrored pixel
-        if (transpose) strip.setPixelColorXY(start + xX, startY + height() - yY - 1, col);
-        else           strip.setPixelColorXY(start + width() - xX - 1, startY + yY, col);
+        if (transpose) emitPixel(start + xX + (startY + height() - yY - 1) * Segment::maxWidth, col);
+        else           emitPixel(start + width() - xX - 1 + (startY + yY) * Segment::maxWidth, col);
       }
       if (mirror_y) { //set the corresponding vertically mirrored pixel
-        if (transpose) strip.setPixelColorXY(start + width() - xX - 1, startY + yY, col);
-        else           strip.setPixelColorXY(start + xX, startY + height() - yY - 1, col);
+        if (transpose) emitPixel(start + width() - xX - 1 + (startY + yY) * Segment::maxWidth, col);
+        else           emitPixel(start + xX + (startY + height() - yY - 1) * Segment::maxWidth, col);
       }
       if (mirror_y && mirror) { //set the corresponding vertically AND horizontally mirrored pixel
-        strip.setPixelColorXY(width() - xX - 1, height() - yY - 1, col);
+        emitPixel(start + width() - xX - 1 + (startY + height() - yY - 1) * Segment::maxWidth, col);
       }
     }
   }
@@ -244,50 +255,49 @@ void Segment::setPixelColorXY(float x, float y, uint32_t col, bool aa)
   if (!isActive()) return; // not active
   if (x<0.0f || x>1.0f || y<0.0f || y>1.0f) return; // not normalized
 
-  const uint16_t cols = virtualWidth();
-  const uint16_t rows = virtualHeight();
+  const uint16_t cols = _vWidth;
+  const uint16_t rows = _vHeight;
 
-  float fX = x * (cols-1);
-  float fY = y * (rows-1);
+  uint32_t pX = x * (cols-1) * 256.0f + 0.5f; // position in 1/256 pixels
+  uint32_t pY = y * (rows-1) * 256.0f + 0.5f;
   if (aa) {
-    uint16_t xL = roundf(fX-0.49f);
-    uint16_t xR = roundf(fX+0.49f);
-    uint16_t yT = roundf(fY-0.49f);
-    uint16_t yB = roundf(fY+0.49f);
-    float    dL = (fX - xL)*(fX - xL);
-    float    dR = (xR - fX)*(xR - fX);
-    float    dT = (fY - yT)*(fY - yT);
-    float    dB = (yB - fY)*(yB - fY);
+    uint16_t fL = pX & 0xFF, fR = 256 - fL;       // distances to the neighbouring pixels
+    uint16_t fT = pY & 0xFF, fB = 256 - fT;
+    uint16_t xL = pX >> 8;
+    uint16_t xR = xL + (fL != 0);
+    uint16_t yT = pY >> 8;
+    uint16_t yB = yT + (fT != 0);
     uint32_t cXLYT = getPixelColorXY(xL, yT);
     uint32_t cXRYT = getPixelColorXY(xR, yT);
     uint32_t cXLYB = getPixelColorXY(xL, yB);
     uint32_t cXRYB = getPixelColorXY(xR, yB);
 
     if (xL!=xR && yT!=yB) {
-      setPixelColorXY(xL, yT, color_blend(col, cXLYT, uint8_t(sqrtf(dL*dT)*255.0f))); // blend TL pixel
-      setPixelColorXY(xR, yT, color_blend(col, cXRYT, uint8_t(sqrtf(dR*dT)*255.0f))); // blend TR pixel
-      setPixelColorXY(xL, yB, color_blend(col, cXLYB, uint8_t(sqrtf(dL*dB)*255.0f))); // blend BL pixel
-      setPixelColorXY(xR, yB, color_blend(col, cXRYB, uint8_t(sqrtf(dR*dB)*255.0f))); // blend BR pixel
+      setPixelColorXY(xL, yT, color_blend(col, cXLYT, (fL * fT * 255) >> 16)); // blend TL pixel
+      setPixelColorXY(xR, yT, color_blend(col, cXRYT, (fR * fT * 255) >> 16)); // blend TR pixel
+      setPixelColorXY(xL, yB, color_blend(col, cXLYB, (fL * fB * 255) >> 16)); // blend BL pixel
+      setPixelColorXY(xR, yB, color_blend(col, cXRYB, (fR * fB * 255) >> 16)); // blend BR pixel
     } else if (xR!=xL && yT==yB) {
-      setPixelColorXY(xR, yT, color_blend(col, cXLYT, uint8_t(dL*255.0f))); // blend L pixel
-      setPixelColorXY(xR, yT, color_blend(col, cXRYT, uint8_t(dR*255.0f))); // blend R pixel
+      setPixelColorXY(xR, yT, color_blend(col, cXLYT, (fL * fL * 255) >> 16)); // blend L pixel
+      setPixelColorXY(xR, yT, color_blend(col, cXRYT, (fR * fR * 255) >> 16)); // blend R pixel
     } else if (xR==xL && yT!=yB) {
-      setPixelColorXY(xR, yT, color_blend(col, cXLYT, uint8_t(dT*255.0f))); // blend T pixel
-      setPixelColorXY(xL, yB, color_blend(col, cXLYB, uint8_t(dB*255.0f))); // blend B pixel
+      setPixelColorXY(xR, yT, color_blend(col, cXLYT, (fT * fT * 255) >> 16)); // blend T pixel
+      setPixelColorXY(xL, yB, color_blend(col, cXLYB, (fB * fB * 255) >> 16)); // blend B pixel
     } else {
       setPixelColorXY(xL, yT, col); // exact match (x & y land on a pixel)
     }
   } else {
-    setPixelColorXY(uint16_t(roundf(fX)), uint16_t(roundf(fY)), col);
+    setPixelColorXY(uint16_t((pX + 128) >> 8), uint16_t((pY + 128) >> 8), col);
   }
 }
 
 // returns RGBW values of pixel
 uint32_t Segment::getPixelColorXY(uint16_t x, uint16_t y) {
   if (!isActive()) return 0; // not active
-  if (x >= virtualWidth() || y >= virtualHeight() || x<0 || y<0) return 0;  // if pixel would fall out of virtual segment just exit
-  if (reverse  ) x = virtualWidth()  - x - 1;
-  if (reverse_y) y = virtualHeight() - y - 1;
+  if (_pixels) return (x < _pixW && y < _pixH) ? _pixels[x + y * _pixW] : 0;
+  if (x >= _vWidth || y >= _vHeight || x<0 || y<0) return 0;  // if pixel would fall out of virtual segment just exit
+  if (reverse  ) x = _vWidth  - x - 1;
+  if (reverse_y) y = _vHeight - y - 1;
   if (transpose) { uint16_t t = x; x = y; y = t; } // swap X & Y if segment transposed
   x *= groupLength(); // expand to physical pixels
   y *= groupLength(); // expand to physical pixels
@@ -303,7 +313,7 @@ void Segment::blendPixelColorXY(uint16_t x, uint16_t y, uint32_t color, uint8_t
 // Adds the specified color with the existing pixel color perserving color balance.
 void Segment::addPixelColorXY(int x, int y, uint32_t color, bool fast) {
   if (!isActive()) return; // not active
-  if (x >= virtualWidth() || y >= virtualHeight() || x<0 || y<0) return;  // if pixel would fall out of virtual segment just exit
+  if (x >= _vWidth || y >= _vHeight || x<0 || y<0) return;  // if pixel would fall out of virtual segment just exit
   uint32_t col = getPixelColorXY(x,y);
   uint8_t r = R(col);
   uint8_t g = G(col);
@@ -334,6 +344,10 @@ void Segment::blurRow(uint16_t row, fract8 blur_amount) {
   const uint_fast16_t rows = virtualHeight();
 
   if (row >= rows) return;
+  if (uint32_t *buf = renderBuffer(cols, rows)) {
+    blurBuffer(buf + row * cols, cols, 1, blur_amount);
+    return;
+  }
   // blur one row
   uint8_t keep = 255 - blur_amount;
   uint8_t seep = blur_amount >> 1;
@@ -362,6 +376,10 @@ void Segment::blurCol(uint16_t col, fract8 blur_amount) {
   const uint_fast16_t rows = virtualHeight();
 
   if (col >= cols) return;
+  if (uint32_t *buf = renderBuffer(cols, rows)) {
+    blurBuffer(buf + col, rows, cols, blur_amount); // columns are strided
+    return;
+  }
   // blur one column
   uint8_t keep = 255 - blur_amount;
   uint8_t seep = blur_amount >> 1;
@@ -391,6 +409,25 @@ void Segment::box_blur(uint16_t i, bool vertical, fract8 blur_amount) {
   const uint16_t dim1 = vertical ? rows : cols;
   const uint16_t dim2 = vertical ? cols : rows;
   if (i >= dim2) return;
+  if (uint32_t *buf = renderBuffer(cols, rows)) {
+    // integer equivalent of the float weights below: (curr*(765-2*blur) + (prev+next)*blur) / 765
+    const size_t step = vertical ? cols : 1;
+    uint32_t *px = buf + (vertical ? i : i * cols);
+    const uint32_t keep = 765 - 2*blur_amount;
+    uint32_t prev = 0;
+    for (uint16_t j = 0; j < dim1; j++, px += step) {
+      uint32_t curr = *px;
+      uint32_t next = j+1 < dim1 ? px[step] : 0;
+      uint32_t out = 0;
+      for (unsigned shift = 0; shift < 32; shift += 8) {
+        uint32_t c = ((curr >> shift) & 0xFF) * keep + (((prev >> shift) & 0xFF) + ((next >> shift) & 0xFF)) * blur_amount;
+        out |= (c / 765) << shift;
+      }
+      *px = out;
+      prev = curr; // neighbour has to be the unblurred value
+    }
+    return;
+  }
   const float seep = blur_amount/255.f;
   const float keep = 3.f - 2.f*seep;
   // 1D box blur
@@ -442,6 +479,15 @@ void Segment::moveX(int8_t delta, bool wrap) {
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   if (!delta || abs(delta) >= cols) return;
+  if (uint32_t *buf = renderBuffer(cols, rows)) {
+    for (int y = 0; y < rows; y++) {
+      uint32_t *row = buf + y * cols;
+      if (wrap)           std::rotate(row, row + (delta > 0 ? delta : cols + delta), row + cols);
+      else if (delta > 0) memmove(row, row + delta, (cols - delta) * sizeof(uint32_t));
+      else                memmove(row - delta, row, (cols + delta) * sizeof(uint32_t));
+    }
+    return;
+  }
   uint32_t newPxCol[cols];
   for (int y = 0; y < rows; y++) {
     if (delta > 0) {
@@ -460,6 +506,15 @@ void Segment::moveY(int8_t delta, bool wrap) {
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   if (!delta || abs(delta) >= rows) return;
+  if (uint32_t *buf = renderBuffer(cols, rows)) {
+    // rows are contiguous so the whole buffer moves at once
+    const size_t len = cols * rows;
+    const size_t shift = abs(delta) * cols;
+    if (wrap)           std::rotate(buf, buf + (delta > 0 ? shift : len - shift), buf + len);
+    else if (delta > 0) memmove(buf, buf + shift, (len - shift) * sizeof(uint32_t));
+    else                memmove(buf + shift, buf, (len - shift) * sizeof(uint32_t));
+    return;
+  }
   uint32_t newPxCol[rows];
   for (int x = 0; x < cols; x++) {
     if (delta > 0) {
@@ -491,8 +546,9 @@ void Segment::move(uint8_t dir, uint8_t delta, bool wrap) {
   }
 }
 
-void Segment::draw_circle(uint16_t cx, uint16_t cy, uint8_t radius, CRGB col) {
+void Segment::draw_circle(uint16_t cx, uint16_t cy, uint8_t radius, CRGB c) {
   if (!isActive()) return; // not active
+  const uint32_t col = RGBW32(c.r, c.g, c.b, 0);
   // Bresenham’s Algorithm
   int d = 3 - (2*radius);
   int y = radius, x = 0;
@@ -518,14 +574,22 @@ void Segment::draw_circle(uint16_t cx, uint16_t cy, uint8_t radius, CRGB col) {
 // by stepko, taken from https://editor.soulmatelights.com/gallery/573-blobs
 void Segment::fill_circle(uint16_t cx, uint16_t cy, uint8_t radius, CRGB col) {
   if (!isActive()) return; // not active
-  const uint16_t cols = virtualWidth();
-  const uint16_t rows = virtualHeight();
-  for (int16_t y = -radius; y <= radius; y++) {
-    for (int16_t x = -radius; x <= radius; x++) {
-      if (x * x + y * y <= radius * radius &&
-          int16_t(cx)+x>=0 && int16_t(cy)+y>=0 &&
-          int16_t(cx)+x<cols && int16_t(cy)+y<rows)
-        setPixelColorXY(cx + x, cy + y, col);
+  const int cols = virtualWidth();
+  const int rows = virtualHeight();
+  const uint32_t c = RGBW32(col.r, col.g, col.b, 0);
+  uint32_t *buf = renderBuffer(cols, rows);
+  const int r2 = radius * radius;
+  int xr = radius; // half width of current span, shrinks as we move away from center row
+  for (int y = 0; y <= radius; y++) {
+    while (xr * xr + y * y > r2) xr--;
+    const int x0 = max(int(cx) - xr, 0);
+    const int x1 = min(int(cx) + xr, cols - 1);
+    if (x0 > x1) continue;
+    for (int s = (y ? -1 : 1); s <= 1; s += 2) { // row below and above center (center row only once)
+      const int row = int(cy) + s * y;
+      if (row < 0 || row >= rows) continue;
+      if (buf) std::fill(buf + row * cols + x0, buf + row * cols + x1 + 1, c);
+      else for (int x = x0; x <= x1; x++) setPixelColorXY(x, row, c);
     }
   }
 }
@@ -534,6 +598,10 @@ void Segment::nscale8(uint8_t scale) {
   if (!isActive()) return; // not active
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
+  if (_pixels && _pixW * _pixH == cols * rows) {
+    scaleBuffer(_pixels, cols * rows, scale);
+    return;
+  }
   for(uint16_t y = 0; y < rows; y++) for (uint16_t x = 0; x < cols; x++) {
     setPixelColorXY(x, y, CRGB(getPixelColorXY(x, y)).nscale8(scale));
   }
@@ -545,6 +613,25 @@ void Segment::drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint3
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   if (x0 >= cols || x1 >= cols || y0 >= rows || y1 >= rows) return;
+  if (uint32_t *buf = renderBuffer(cols, rows)) {
+    if (y0 == y1) { // horizontal span
+      std::fill(buf + y0 * cols + min(x0, x1), buf + y0 * cols + max(x0, x1) + 1, c);
+      return;
+    }
+    const int dx = abs(x1-x0), sx = x0<x1 ? 1 : -1;
+    const int dy = abs(y1-y0), sy = y0<y1 ? 1 : -1;
+    const int stride = sy * cols; // y step in buffer
+    int err = (dx>dy ? dx : -dy)/2, e2;
+    uint32_t *px = buf + x0 + y0 * cols;
+    for (;;) {
+      *px = c;
+      if (x0==x1 && y0==y1) break;
+      e2 = err;
+      if (e2 >-dx) { err -= dy; x0 += sx; px += sx; }
+      if (e2 < dy) { err += dx; y0 += sy; px += stride; }
+    }
+    return;
+  }
   const int16_t dx = abs(x1-x0), sx = x0<x1 ? 1 : -1;
   const int16_t dy = abs(y1-y0), sy = y0<y1 ? 1 : -1;
   int16_t err = (dx>dy ? dx : -dy)/2, e2;
@@ -557,45 +644,107 @@ void Segment::drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint3
   }
 }
 
+// copies w*h array of pixels (row by row) to segment at x,y, pixels outside of segment are skipped
+void Segment::blit(const uint32_t *src, int x, int y, uint16_t w, uint16_t h) {
+  if (!isActive() || !src) return; // not active
+  const int cols = virtualWidth();
+  const int rows = virtualHeight();
+  const int x0 = max(x, 0), x1 = min(x + int(w), cols);
+  const int y0 = max(y, 0), y1 = min(y + int(h), rows);
+  if (x0 >= x1 || y0 >= y1) return;
+  uint32_t *buf = renderBuffer(cols, rows);
+  for (int row = y0; row < y1; row++) {
+    const uint32_t *s = src + (row - y) * w + (x0 - x);
+    if (buf) memcpy(buf + row * cols + x0, s, (x1 - x0) * sizeof(uint32_t));
+    else for (int col = x0; col < x1; col++) setPixelColorXY(col, row, *s++);
+  }
+}
+
 #include "src/font/console_font_4x6.h"
 #include "src/font/console_font_5x8.h"
 #include "src/font/console_font_5x12.h"
 #include "src/font/console_font_6x8.h"
 #include "src/font/console_font_7x9.h"
 
-// draws a raster font character on canvas
+// returns row i of glyph (font table format: MSB is leftmost pixel), -1 if font is not supported
 // only supports: 4x6=24, 5x8=40, 5x12=60, 6x8=48 and 7x9=63 fonts ATM
+static int16_t glyphRow(unsigned char chr, uint8_t w, uint8_t h, uint8_t i) {
+  switch (w*h) {
+    case 24: return pgm_read_byte_near(&console_font_4x6[(chr * h) + i]);  // 4x6 font
+    case 40: return pgm_read_byte_near(&console_font_5x8[(chr * h) + i]);  // 5x8 font
+    case 48: return pgm_read_byte_near(&console_font_6x8[(chr * h) + i]);  // 6x8 font
+    case 63: return pgm_read_byte_near(&console_font_7x9[(chr * h) + i]);  // 7x9 font
+    case 60: return pgm_read_byte_near(&console_font_5x12[(chr * h) + i]); // 5x12 font
+    default: return -1;
+  }
+}
+
+// fills colors[h] with vertical gradient between color and col2 (same as used by drawCharacter())
+static void glyphGradient(uint32_t *colors, uint8_t h, uint32_t color, uint32_t col2) {
+  CRGB col = CRGB(color);
+  CRGBPalette16 grad = CRGBPalette16(col, col2 ? CRGB(col2) : col);
+  for (int i = 0; i < h; i++) {
+    CRGB c = ColorFromPalette(grad, (i+1)*255/h, 255, NOBLEND);
+    colors[i] = RGBW32(c.r, c.g, c.b, 0);
+  }
+}
+
+// draws a raster font character on canvas
 void Segment::drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color, uint32_t col2) {
   if (!isActive()) return; // not active
   if (chr < 32 || chr > 126) return; // only ASCII 32-126 supported
   chr -= 32; // align with font table entries
-  const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
-  const int font = w*h;
+  if (glyphRow(chr, w, h, 0) < 0) return; // unsupported font
 
-  CRGB col = CRGB(color);
-  CRGBPalette16 grad = CRGBPalette16(col, col2 ? CRGB(col2) : col);
+  uint32_t colors[h];
+  glyphGradient(colors, h, color, col2);
 
-  //if (w<5 || w>6 || h!=8) return;
   for (int i = 0; i<h; i++) { // character height
     int16_t y0 = y + i;
     if (y0 < 0) continue; // drawing off-screen
     if (y0 >= rows) break; // drawing off-screen
-    uint8_t bits = 0;
-    switch (font) {
-      case 24: bits = pgm_read_byte_near(&console_font_4x6[(chr * h) + i]); break;  // 5x8 font
-      case 40: bits = pgm_read_byte_near(&console_font_5x8[(chr * h) + i]); break;  // 5x8 font
-      case 48: bits = pgm_read_byte_near(&console_font_6x8[(chr * h) + i]); break;  // 6x8 font
-      case 63: bits = pgm_read_byte_near(&console_font_7x9[(chr * h) + i]); break;  // 7x9 font
-      case 60: bits = pgm_read_byte_near(&console_font_5x12[(chr * h) + i]); break; // 5x12 font
-      default: return;
-    }
-    col = ColorFromPalette(grad, (i+1)*255/h, 255, NOBLEND);
+    uint8_t bits = glyphRow(chr, w, h, i);
     for (int j = 0; j<w; j++) { // character width
       int16_t x0 = x + (w-1) - j;
-      if ((x0 >= 0 || x0 < cols) && ((bits>>(j+(8-w))) & 0x01)) { // bit set & drawing on-screen
-        setPixelColorXY(x0, y0, col);
-      }
+      if ((bits>>(j+(8-w))) & 0x01) setPixelColorXY(x0, y0, colors[i]); // bit set (off-screen pixels are clipped)
+    }
+  }
+}
+
+// renders text into columns (one word per pixel column, bit i set if glyph row i is lit)
+uint16_t Segment::rasterizeText(const char *text, uint8_t w, uint8_t h, uint16_t *columns, size_t maxColumns) {
+  if (!text || h > 16 || glyphRow(0, w, h, 0) < 0) return 0; // unsupported font
+  size_t len = 0;
+  for (; *text && len + w <= maxColumns; text++) {
+    unsigned char chr = *text;
+    memset(columns + len, 0, w * sizeof(uint16_t));
+    if (chr >= 32 && chr <= 126) for (int i = 0; i < h; i++) {
+      uint8_t bits = glyphRow(chr - 32, w, h, i) & (0xFF << (8-w)); // leftmost pixel is bit 7
+      for (int c = 0; bits; c++, bits <<= 1) if (bits & 0x80) columns[len + c] |= 1 << i;
+    }
+    len += w;
+  }
+  return len;
+}
+
+// draws visible part of glyph strip (see rasterizeText()) at x,y
+void Segment::drawGlyphStrip(const uint16_t *columns, uint16_t len, int x, int y, uint8_t h, uint32_t color, uint32_t col2) {
+  if (!isActive() || !columns || h > 16) return; // not active
+  const int cols = virtualWidth();
+  const int rows = virtualHeight();
+  uint32_t colors[h];
+  glyphGradient(colors, h, color, col2); // row color LUT
+  const int c0 = max(0, -x), c1 = min(int(len), cols - x);
+  const int i0 = max(0, -y), i1 = min(int(h), rows - y);
+  uint32_t *buf = renderBuffer(cols, rows);
+  for (int c = c0; c < c1; c++) {
+    const uint16_t bits = columns[c];
+    if (!bits) continue;
+    for (int i = i0; i < i1; i++) {
+      if (!(bits & (1 << i))) continue;
+      if (buf) buf[(x + c) + (y + i) * cols] = colors[i];
+      else     setPixelColorXY(x + c, y + i, colors[i]);
     }
   }
 }
@@ -80,6 +80,9 @@ uint16_t Segment::maxHeight = 1;
 CRGBPalette16 Segment::_randomPalette = CRGBPalette16(DEFAULT_COLOR);
 CRGBPalette16 Segment::_newRandomPalette = CRGBPalette16(DEFAULT_COLOR);
 unsigned long Segment::_lastPaletteChange = 0; // perhaps it should be per segment
+uint8_t Segment::_paletteVersion = 1; // 0 is reserved for invalid palette cache
+uint8_t Segment::_layoutVersion = 1; // 0 is reserved for invalid pixel map
+uint16_t *Segment::_mapTemp = nullptr;
 
 // copy constructor
 Segment::Segment(const Segment &orig) {
@@ -89,9 +92,20 @@ Segment::Segment(const Segment &orig) {
   name = nullptr;
   data = nullptr;
   _dataLen = 0;
+  _pixels = nullptr;
+  _pixW = _pixH = 0;
+  _upPixels = nullptr;
+  _upW = _upH = 0;
+  _scale = 0;
+  _map = nullptr;
+  _mapRuns = 0;
+  _mapLayout.version = 0;
+  _arc = nullptr;
+  _arcLen = _arcW = _arcH = 0;
   _t = nullptr;
   if (orig.name) { name = new char[strlen(orig.name)+1]; if (name) strcpy(name, orig.name); }
   if (orig.data) { if (allocateData(orig._dataLen)) memcpy(data, orig.data, orig._dataLen); }
+  if (orig._pixels && allocatePixels() && _pixW == orig._pixW && _pixH == orig._pixH) memcpy(_pixels, orig._pixels, _pixW*_pixH*sizeof(uint32_t));
   //if (orig._t)   { _t = new Transition(orig._t->_dur, orig._t->_briT, orig._t->_cctT, orig._t->_colorT); }
 }
 
@@ -103,6 +117,15 @@ Segment::Segment(Segment &&orig) noexcept {
   orig.name = nullptr;
   orig.data = nullptr;
   orig._dataLen = 0;
+  orig._pixels = nullptr;
+  orig._pixW = orig._pixH = 0;
+  orig._upPixels = nullptr;
+  orig._upW = orig._upH = 0;
+  orig._scale = 0;
+  orig._map = nullptr;
+  orig._mapRuns = 0;
+  orig._arc = nullptr;
+  orig._arcLen = orig._arcW = orig._arcH = 0;
   orig._t   = nullptr;
 }
 
@@ -115,6 +138,7 @@ Segment& Segment::operator= (const Segment &orig) {
     if (name) delete[] name;
     if (_t)   delete _t;
     deallocateData();
+    deallocatePixels();
     // copy source
     memcpy((void*)this, (void*)&orig, sizeof(Segment));
     transitional = false;
@@ -122,10 +146,21 @@ Segment& Segment::operator= (const Segment &orig) {
     name = nullptr;
     data = nullptr;
     _dataLen = 0;
+    _pixels = nullptr;
+    _pixW = _pixH = 0;
+    _upPixels = nullptr;
+    _upW = _upH = 0;
+    _scale = 0;
+    _map = nullptr;
+    _mapRuns = 0;
+    _mapLayout.version = 0;
+    _arc = nullptr;
+    _arcLen = _arcW = _arcH = 0;
     _t = nullptr;
     // copy source data
     if (orig.name) { name = new char[strlen(orig.name)+1]; if (name) strcpy(name, orig.name); }
     if (orig.data) { if (allocateData(orig._dataLen)) memcpy(data, orig.data, orig._dataLen); }
+    if (orig._pixels && allocatePixels() && _pixW == orig._pixW && _pixH == orig._pixH) memcpy(_pixels, orig._pixels, _pixW*_pixH*sizeof(uint32_t));
     //if (orig._t)   { _t = new Transition(orig._t->_dur, orig._t->_briT, orig._t->_cctT, orig._t->_colorT); }
   }
   return *this;
@@ -138,12 +173,22 @@ Segment& Segment::operator= (Segment &&orig) noexcept {
     transitional = false; // just temporary
     if (name) { delete[] name; name = nullptr; } // free old name
     deallocateData(); // free old runtime data
+    deallocatePixels(); // free old render buffer
     if (_t) { delete _t; _t = nullptr; }
     memcpy((void*)this, (void*)&orig, sizeof(Segment));
     orig.transitional = false; // old segment cannot be in transition
     orig.name = nullptr;
     orig.data = nullptr;
     orig._dataLen = 0;
+    orig._pixels = nullptr;
+    orig._pixW = orig._pixH = 0;
+    orig._upPixels = nullptr;
+    orig._upW = orig._upH = 0;
+    orig._scale = 0;
+    orig._map = nullptr;
+    orig._mapRuns = 0;
+    orig._arc = nullptr;
+    orig._arcLen = orig._arcW = orig._arcH = 0;
     orig._t   = nullptr;
   }
   return *this;
@@ -170,6 +215,238 @@ void Segment::deallocateData() {
   _dataLen = 0;
 }
 
+// evaluates per-frame invariants so pixel setters do not recompute them for every pixel
+// called by WS2812FX::service() before the effect runs and whenever segment geometry changes
+void Segment::beginFrame() {
+  _vWidth   = virtualWidth();
+  _vHeight  = virtualHeight();
+  _vLength  = virtualLength();
+  _frameBri = currentBri(on ? opacity : 0);
+}
+
+// render buffer holds one RGBW value per virtual pixel; segments within the matrix (including
+// 1D segments laid over it) use virtualWidth() x virtualHeight(), others virtualLength() x 1
+// with renderScale set, 2D segments get a reduced render buffer plus a full resolution one to upscale into
+bool Segment::allocatePixels() {
+  uint16_t w = 0, h = 0, upW = 0, upH = 0;
+  uint8_t  scale = 0;
+  if (isActive()) {
+  #ifndef WLED_DISABLE_2D
+    if (Segment::maxHeight > 1 && start < Segment::maxWidth * Segment::maxHeight) {
+      w = mappedWidth();
+      h = mappedHeight();
+      if (is2D() && renderScale) {
+        scale = renderScale > 2 ? 2 : renderScale;
+        upW = w;
+        upH = h;
+        w = (upW + (1 << scale) - 1) >> scale;
+        h = (upH + (1 << scale) - 1) >> scale;
+        size_t freeHeap = ESP.getFreeHeap() + (_pixels ? _pixW * _pixH * sizeof(uint32_t) : 0); // current buffer is released first
+        if (!(_upPixels && _upW == upW && _upH == upH) && freeHeap < (w * h + upW * upH) * sizeof(uint32_t) + upscaleScratchSize(upW) + MIN_HEAP_SIZE) {
+          scale = 0; // not enough memory for both buffers, render at full resolution
+          w = upW;
+          h = upH;
+          upW = upH = 0;
+        }
+      }
+    } else
+  #endif
+    {
+      w = virtualLength();
+      h = 1;
+    }
+  }
+  if (_pixels && _pixW == w && _pixH == h && _scale == scale && _upW == upW && _upH == upH) return true; // already allocated
+  size_t len = w * h;
+  if (_pixels && (_pixW * _pixH != len || _scale != scale || _upW != upW || _upH != upH)) deallocatePixels();
+  if (len == 0) return false;
+  if (!_pixels) {
+    if (ESP.getFreeHeap() < len * sizeof(uint32_t) + MIN_HEAP_SIZE) return false; // keep heap for web server, render directly into strip
+    // do not use SPI RAM on ESP32 since it is slow
+    _pixels = (uint32_t*) malloc(len * sizeof(uint32_t));
+    if (!_pixels) return false; //allocation failed
+    if (scale) {
+      _upPixels = (uint32_t*) malloc(upW * upH * sizeof(uint32_t) + upscaleScratchSize(upW)); // upscaleBuffer() scratch follows the pixels
+      if (!_upPixels) { deallocatePixels(); return false; }
+      _upW = upW;
+      _upH = upH;
+      _scale = scale;
+      beginFrame(); // virtual dimensions changed
+    }
+  }
+  _pixW = w;
+  _pixH = h;
+  memset(_pixels, 0, len * sizeof(uint32_t));
+  return true;
+}
+
+void Segment::deallocatePixels() {
+  if (_map) free(_map);
+  _map = nullptr;
+  _mapRuns = 0;
+  _mapLayout.version = 0;
+  if (_arc) free(_arc);
+  _arc = nullptr;
+  _arcLen = _arcW = _arcH = 0;
+  if (_upPixels) free(_upPixels);
+  _upPixels = nullptr;
+  _upW = _upH = 0;
+  if (_scale) {
+    _scale = 0;
+    beginFrame(); // effects render directly into strip at full resolution
+  }
+  if (!_pixels) return;
+  free(_pixels);
+  _pixels = nullptr;
+  _pixW = _pixH = 0;
+}
+
+#ifndef WLED_DISABLE_2D
+// M12_pArc: render buffer indices of the quarter circle drawn for each 1D pixel (same points as the
+// float loop in setPixelColor(), consecutive duplicates removed), rebuilt when buffer dimensions change
+bool Segment::buildArcTable() {
+  if (_arc && _arcW == _pixW && _arcH == _pixH) return true;
+  if (_arc) free(_arc);
+  _arc = nullptr;
+  uint16_t n = _pixW > _pixH ? _pixW : _pixH; // virtualLength()
+  uint16_t *idx = nullptr;
+  for (int pass = 0; pass < 2; pass++) { // count, then fill
+    uint16_t k = 0;
+    for (int i = 0; i < n; i++) {
+      if (idx) idx[i] = k;
+      int last = -1;
+      if (i == 0) {
+        if (idx) idx[n+1+k] = 0;
+        k++;
+        continue;
+      }
+      uint32_t step = (5749UL << 8) / i; // HALF_PI/(2.85*i) in 1/256 of 16 bit angle units
+      for (uint32_t a = 0; a <= (16384UL << 8) + step/2; a += step) {
+        int x = (sin16_t(a >> 8) * i + 16384) >> 15;
+        int y = (cos16_t(a >> 8) * i + 16384) >> 15;
+        if (x < 0 || y < 0 || x >= _pixW || y >= _pixH) continue;
+        int p = x + y * _pixW;
+        if (p == last) continue;
+        last = p;
+        if (idx) idx[n+1+k] = p;
+        k++;
+      }
+    }
+    if (idx) {
+      idx[n] = k;
+      break;
+    }
+    size_t len = (n + 1 + k) * sizeof(uint16_t);
+    if (ESP.getFreeHeap() < len + MIN_HEAP_SIZE) return false;
+    idx = (uint16_t*) malloc(len);
+    if (!idx) return false;
+  }
+  _arc = idx;
+  _arcLen = n;
+  _arcW = _pixW;
+  _arcH = _pixH;
+  return true;
+}
+#endif
+
+// writes expanded pixel to strip, while a pixel map is compiled col holds the render buffer index instead
+void IRAM_ATTR Segment::emitPixel(uint16_t i, uint32_t col)
+{
+  if (!_mapTemp) {
+    strip.setPixelColor(i, col);
+    return;
+  }
+  size_t p = i - start;
+#ifndef WLED_DISABLE_2D
+  if (Segment::maxHeight > 1 && start < Segment::maxWidth * Segment::maxHeight) p = (i % Segment::maxWidth - start) + (i / Segment::maxWidth - startY) * width();
+#endif
+  if (p < (size_t)length()) _mapTemp[p] = col;
+}
+
+// expands every render buffer pixel once (with the same code used for direct rendering), then walks the
+// segment's pixels in strip order and merges consecutive bus pixels into runs
+bool Segment::compilePixelMap() {
+  MapLayout layout;
+  memset(&layout, 0, sizeof(layout)); // padding is compared too
+  layout.start    = start;
+  layout.stop     = stop;
+  layout.startY   = startY;
+  layout.stopY    = stopY;
+  layout.offset   = offset;
+  layout.options  = options & (0x01 << SEG_OPTION_REVERSED | 0x01 << SEG_OPTION_MIRROR | 0x01 << SEG_OPTION_REVERSED_Y | 0x01 << SEG_OPTION_MIRROR_Y | 0x01 << SEG_OPTION_TRANSPOSED);
+  layout.grouping = grouping;
+  layout.spacing  = spacing;
+  layout.version  = _layoutVersion;
+  if (_mapLayout.version && !memcmp(&layout, &_mapLayout, sizeof(layout))) return _map != nullptr; // unchanged (or failed before)
+
+  if (_map) free(_map);
+  _map = nullptr;
+  _mapRuns = 0;
+  _mapLayout = layout;
+
+  size_t len = length(); // segment pixels (2D: width * height)
+  if (ESP.getFreeHeap() < len * sizeof(uint16_t) + MIN_HEAP_SIZE) return false;
+  _mapTemp = (uint16_t*) malloc(len * sizeof(uint16_t));
+  if (!_mapTemp) return false;
+  memset(_mapTemp, 0xFF, len * sizeof(uint16_t)); // 0xFFFF: pixel not written (spacing)
+  bool matrix = false;
+#ifndef WLED_DISABLE_2D
+  matrix = Segment::maxHeight > 1 && start < Segment::maxWidth * Segment::maxHeight;
+#endif
+  uint16_t v = 0;
+  const uint16_t pixW = _scale ? _upW : _pixW; // map addresses the upscaled buffer if render scaled
+  const uint16_t pixH = _scale ? _upH : _pixH;
+  for (int y = 0; y < pixH; y++) for (int x = 0; x < pixW; x++, v++) {
+  #ifndef WLED_DISABLE_2D
+    if (matrix) expandPixelXY(x, y, v);
+    else
+  #endif
+    expandPixel(x, v);
+  }
+  uint16_t *temp = _mapTemp;
+  _mapTemp = nullptr;
+
+  uint16_t w = width();
+  uint16_t total = strip.getLengthTotal();
+  for (int pass = 0; pass < 2; pass++) { // count runs, then fill them
+    uint16_t n = 0;
+    PixelRun run = {0, 0, 0, 1, 0};
+    for (size_t p = 0; p < len; p++) {
+      uint16_t vp = temp[p];
+      if (vp == 0xFFFFU) continue;
+      uint16_t phys = matrix ? start + p % w + (startY + p / w) * Segment::maxWidth : start + p;
+      if (phys < strip.customMappingSize) phys = strip.customMappingTable[phys];
+      if (phys >= total) continue;
+      if (run.len) {
+        int dp = (int)phys - (run.phys + (run.len - 1) * run.physStep);
+        int dv = (int)vp   - (run.virt + (run.len - 1) * run.virtStep);
+        if (run.len == 1 && (dp == 1 || dp == -1) && dv >= -1 && dv <= 1) {
+          run.physStep = dp;
+          run.virtStep = dv;
+          run.len++;
+          continue;
+        }
+        if (run.len > 1 && dp == run.physStep && dv == run.virtStep) {
+          run.len++;
+          continue;
+        }
+        if (pass) _map[n] = run;
+        n++;
+      }
+      run = {phys, vp, 1, 1, 0};
+    }
+    if (run.len) {
+      if (pass) _map[n] = run;
+      n++;
+    }
+    if (pass) _mapRuns = n;
+    else if (n == 0 || ESP.getFreeHeap() < n * sizeof(PixelRun) + MIN_HEAP_SIZE) break;
+    else if (!(_map = (PixelRun*) malloc(n * sizeof(PixelRun)))) break;
+  }
+  free(temp);
+  return _map != nullptr;
+}
+
 /**
   * If reset of this segment was requested, clears runtime
   * settings of this segment.
@@ -185,7 +462,7 @@ void Segment::resetIfRequired() {
   reset = false;
 }
 
-CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
+uint8_t Segment::resolvePalette(uint8_t pal) const {
   if (pal < 245 && pal > GRADIENT_PALETTE_COUNT+13) pal = 0;
   if (pal > 245 && (strip.customPalettes.size() == 0 || 255U-pal > strip.customPalettes.size()-1)) pal = 0;
   //default palette. Differs depending on effect
@@ -202,23 +479,16 @@ CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
     case FX_MODE_RAILWAY    : pal =  3; break; // prim + sec
     case FX_MODE_2DSOAP     : pal = 11; break; // rainbow colors
   }
+  return pal;
+}
+
+CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
+  pal = resolvePalette(pal);
   switch (pal) {
     case 0: //default palette. Exceptions for specific effects above
       targetPalette = PartyColors_p; break;
-    case 1: {//periodically replace palette with a random one. Transition palette change in 500ms
-      unsigned long timeSinceLastChange = millis() - _lastPaletteChange;
-      if (timeSinceLastChange > randomPaletteChangeTime * 1000U) {
-        _randomPalette = _newRandomPalette;
-        _newRandomPalette = CRGBPalette16(
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)));
-        _lastPaletteChange = millis();
-        handleRandomPalette(); // do initial blend
-      }
-      targetPalette = _randomPalette;
-      break;}
+    case 1: //periodically replace palette with a random one (see handleRandomPalette())
+      targetPalette = _randomPalette; break;
     case 2: {//primary color only
       CRGB prim = gamma32(colors[0]);
       targetPalette = CRGBPalette16(prim); break;}
@@ -283,10 +553,9 @@ void Segment::startTransition(uint16_t dur) {
   _t = new Transition(dur); // no previous transition running
   if (!_t) return; // failed to allocate data
 
-  CRGBPalette16 _palT = CRGBPalette16(DEFAULT_COLOR); loadPalette(_palT, palette);
   _t->_briT  = on ? opacity : 0;
   _t->_cctT  = cct;
-  _t->_palT  = _palT;
+  _t->_palT  = getPalette();
   _t->_modeP = mode;
   for (size_t i=0; i<NUM_COLORS; i++) _t->_colorT[i] = colors[i];
   transitional = true; // setOption(SEG_OPTION_TRANSITIONAL, true);
@@ -318,8 +587,26 @@ uint32_t Segment::currentColor(uint8_t slot, uint32_t colorNew) {
   return transitional && _t ? color_blend(_t->_colorT[slot], colorNew, progress(), true) : colorNew;
 }
 
+// returns segment's palette; only gradient and color based palettes are cached as
+// random and custom palettes are already held in RAM
+const CRGBPalette16 &Segment::getPalette() {
+  uint8_t pal = resolvePalette(palette);
+  if (pal == 1)  return _randomPalette;
+  if (pal > 245) return strip.customPalettes[255-pal]; // bounds checked in resolvePalette()
+  bool usesColors = (pal > 1 && pal < 6); // palettes 2-5 are constructed from segment colors
+  if (_palCacheVersion != _paletteVersion || _palCacheId != pal ||
+      (usesColors && memcmp(_palCacheColors, colors, sizeof(colors)))) {
+    loadPalette(_palCache, pal);
+    memcpy(_palCacheColors, colors, sizeof(colors));
+    _palCacheId = pal;
+    _palCacheVersion = _paletteVersion;
+  }
+  return _palCache;
+}
+
 CRGBPalette16 &Segment::currentPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
-  loadPalette(targetPalette, pal);
+  if (pal == palette) targetPalette = getPalette();
+  else                loadPalette(targetPalette, pal);
   if (transitional && _t && progress() < 0xFFFFU) {
     // blend palettes
     // there are about 255 blend passes of 48 "blends" to completely blend two palettes (in _dur time)
@@ -347,6 +634,16 @@ void Segment::handleTransition() {
 
 // relies on WS2812FX::service() to call it max every 8ms or more (MIN_SHOW_DELAY)
 void Segment::handleRandomPalette() {
+  // periodically replace palette with a random one. Transition palette change in 500ms
+  if (millis() - _lastPaletteChange > randomPaletteChangeTime * 1000U) {
+    _randomPalette = _newRandomPalette;
+    _newRandomPalette = CRGBPalette16(
+                    CHSV(random8(), random8(160, 255), random8(128, 255)),
+                    CHSV(random8(), random8(160, 255), random8(128, 255)),
+                    CHSV(random8(), random8(160, 255), random8(128, 255)),
+                    CHSV(random8(), random8(160, 255), random8(128, 255)));
+    _lastPaletteChange = millis();
+  }
   // just do a blend; if the palettes are identical it will just compare 48 bytes (same as _randomPalette == _newRandomPalette)
   // this will slowly blend _newRandomPalette into _randomPalette every 15ms or 8ms (depending on MIN_SHOW_DELAY)
   nblendPaletteTowardPalette(_randomPalette, _newRandomPalette, 48);
@@ -363,7 +660,10 @@ void Segment::setUp(uint16_t i1, uint16_t i2, uint8_t grp, uint8_t spc, uint16_t
       && (!grp || (grouping == grp && spacing == spc))
       && (ofs == UINT16_MAX || ofs == offset)) return;
 
-  if (stop) fill(BLACK); // turn old segment range off (clears pixels if changing spacing)
+  if (stop) { // turn old segment range off (clears pixels if changing spacing)
+    fill(BLACK);
+    renderPixels();
+  }
   if (grp) { // prevent assignment of 0
     grouping = grp;
     spacing = spc;
@@ -374,7 +674,10 @@ void Segment::setUp(uint16_t i1, uint16_t i2, uint8_t grp, uint8_t spc, uint16_t
   if (ofs < UINT16_MAX) offset = ofs;
 
   markForReset();
-  if (boundsUnchanged) return;
+  if (boundsUnchanged) {
+    beginFrame();
+    return;
+  }
 
   // apply change immediately
   if (i2 <= i1) { //disable segment
@@ -397,6 +700,7 @@ void Segment::setUp(uint16_t i1, uint16_t i2, uint8_t grp, uint8_t spc, uint16_t
     return;
   }
   refreshLightCapabilities();
+  beginFrame();
 }
 
 
@@ -436,6 +740,7 @@ void Segment::setOption(uint8_t n, bool val) {
   if (fadeTransition && n == SEG_OPTION_ON && val != prevOn) startTransition(strip.getTransition()); // start transition prior to change
   if (val) options |=   0x01 << n;
   else     options &= ~(0x01 << n);
+  if (n == SEG_OPTION_MIRROR || n == SEG_OPTION_MIRROR_Y || n == SEG_OPTION_TRANSPOSED) beginFrame(); // virtual dimensions changed
   if (!(n == SEG_OPTION_SELECTED || n == SEG_OPTION_RESET || n == SEG_OPTION_TRANSITIONAL)) stateChanged = true; // send UDP/WS broadcast
 }
 
@@ -464,6 +769,7 @@ void Segment::setMode(uint8_t fx, bool loadDefaults) {
         sOpt = extractModeDefaults(fx, "rY");   if (sOpt >= 0) reverse_y = (bool)sOpt;
         sOpt = extractModeDefaults(fx, "mY");   if (sOpt >= 0) mirror_y  = (bool)sOpt; // NOTE: setting this option is a risky business
         sOpt = extractModeDefaults(fx, "pal");  if (sOpt >= 0) setPalette(sOpt); //else setPalette(0);
+        beginFrame(); // mapping and mirroring may have changed
       }
       stateChanged = true; // send UDP/WS broadcast
     }
@@ -481,20 +787,29 @@ void Segment::setPalette(uint8_t pal) {
 }
 
 // 2D matrix
-uint16_t Segment::virtualWidth() const {
+uint16_t Segment::mappedWidth() const {
   uint16_t groupLen = groupLength();
   uint16_t vWidth = ((transpose ? height() : width()) + groupLen - 1) / groupLen;
   if (mirror) vWidth = (vWidth + 1) /2;  // divide by 2 if mirror, leave at least a single LED
   return vWidth;
 }
 
-uint16_t Segment::virtualHeight() const {
+uint16_t Segment::mappedHeight() const {
   uint16_t groupLen = groupLength();
   uint16_t vHeight = ((transpose ? width() : height()) + groupLen - 1) / groupLen;
   if (mirror_y) vHeight = (vHeight + 1) /2;  // divide by 2 if mirror, leave at least a single LED
   return vHeight;
 }
 
+// effects see the (possibly reduced) render resolution
+uint16_t Segment::virtualWidth() const {
+  return (mappedWidth() + (1 << _scale) - 1) >> _scale;
+}
+
+uint16_t Segment::virtualHeight() const {
+  return (mappedHeight() + (1 << _scale) - 1) >> _scale;
+}
+
 uint16_t Segment::nrOfVStrips() const {
   uint16_t vLen = 1;
 #ifndef WLED_DISABLE_2D
@@ -542,12 +857,32 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
 #endif
   i &= 0xFFFF;
 
-  if (i >= virtualLength() || i<0) return;  // if pixel would fall out of segment just exit
+  if (i >= _vLength || i<0) return;  // if pixel would fall out of segment just exit
 
 #ifndef WLED_DISABLE_2D
   if (is2D()) {
-    uint16_t vH = virtualHeight();  // segment height in logical pixels
-    uint16_t vW = virtualWidth();
+    uint16_t vH = _vHeight;  // segment height in logical pixels
+    uint16_t vW = _vWidth;
+    if (_pixels && _pixW == vW && _pixH == vH) {
+      // write expansion directly into render buffer
+      switch (map1D2D) {
+        case M12_Pixels:
+          _pixels[i] = col;
+          return;
+        case M12_pBar:
+          if (vStrip>0) { if (vStrip <= vW) _pixels[vStrip - 1 + (vH - i - 1) * vW] = col; }
+          else          { uint32_t *row = _pixels + (vH - i - 1) * vW; for (int x = 0; x < vW; x++) row[x] = col; }
+          return;
+        case M12_pArc:
+          if (!buildArcTable()) break; // not enough memory, use slow path below
+          for (uint16_t k = _arc[i]; k < _arc[i+1]; k++) _pixels[_arc[_arcLen+1+k]] = col;
+          return;
+        case M12_pCorner:
+          if (i < vH) { uint32_t *row = _pixels + i * vW; for (int x = 0; x <= i && x < vW; x++) row[x] = col; }
+          if (i < vW) for (int y = 0; y < i && y < vH; y++) _pixels[i + y * vW] = col;
+          return;
+      }
+    }
     switch (map1D2D) {
       case M12_Pixels:
         // use all available pixels as a long strip
@@ -563,11 +898,10 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
         if (i==0)
           setPixelColorXY(0, 0, col);
         else {
-          float step = HALF_PI / (2.85f*i);
-          for (float rad = 0.0f; rad <= HALF_PI+step/2; rad += step) {
-            // may want to try float version as well (with or without antialiasing)
-            int x = roundf(sin_t(rad) * i);
-            int y = roundf(cos_t(rad) * i);
+          uint32_t step = (5749UL << 8) / i; // same walk as buildArcTable()
+          for (uint32_t a = 0; a <= (16384UL << 8) + step/2; a += step) {
+            int x = (sin16_t(a >> 8) * i + 16384) >> 15;
+            int y = (cos16_t(a >> 8) * i + 16384) >> 15;
             setPixelColorXY(x, y, col);
           }
           // Bresenham’s Algorithm (may not fill every pixel)
@@ -596,16 +930,21 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
     if (start < Segment::maxWidth*Segment::maxHeight) {
       // we have a vertical or horizontal 1D segment (WARNING: virtual...() may be transposed)
       int x = 0, y = 0;
-      if (virtualHeight()>1) y = i;
-      if (virtualWidth() >1) x = i;
+      if (_vHeight>1) y = i;
+      if (_vWidth >1) x = i;
       setPixelColorXY(x, y, col);
       return;
     }
   }
 #endif
 
-  uint16_t len = length();
-  uint8_t _bri_t = currentBri(on ? opacity : 0);
+  if (_pixels) {
+    if (i < _pixW * _pixH) _pixels[i] = col;
+    return;
+  }
+
+  // no render buffer, write directly into strip
+  uint8_t _bri_t = _frameBri;
   if (_bri_t < 255) {
     byte r = scale8(R(col), _bri_t);
     byte g = scale8(G(col), _bri_t);
@@ -613,6 +952,12 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
     byte w = scale8(W(col), _bri_t);
     col = RGBW32(r, g, b, w);
   }
+  expandPixel(i, col);
+}
+
+void IRAM_ATTR Segment::expandPixel(int i, uint32_t col)
+{
+  uint16_t len = length();
 
   // expand pixel (taking into account start, grouping, spacing [and offset])
   i = i * groupLength();
@@ -633,11 +978,11 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
         uint16_t indexMir = stop - indexSet + start - 1;
         indexMir += offset; // offset/phase
         if (indexMir >= stop) indexMir -= len; // wrap
-        strip.setPixelColor(indexMir, col);
+        emitPixel(indexMir, col);
       }
       indexSet += offset; // offset/phase
       if (indexSet >= stop) indexSet -= len; // wrap
-      strip.setPixelColor(indexSet, col);
+      emitPixel(indexSet, col);
     }
   }
 }
@@ -651,27 +996,28 @@ void Segment::setPixelColor(float i, uint32_t col, bool aa)
 
   if (i<0.0f || i>1.0f) return; // not normalized
 
-  float fC = i * (virtualLength()-1);
+  uint32_t pC = i * (_vLength-1) * 256.0f + 0.5f; // position in 1/256 pixels
   if (aa) {
-    uint16_t iL = roundf(fC-0.49f);
-    uint16_t iR = roundf(fC+0.49f);
-    float    dL = (fC - iL)*(fC - iL);
-    float    dR = (iR - fC)*(iR - fC);
+    uint16_t fC = pC & 0xFF;
+    uint16_t iL = pC >> 8;
+    uint16_t iR = iL + (fC != 0);
+    uint8_t  dL = (fC * fC * 255) >> 16;             // squared distances scaled to 0-255
+    uint8_t  dR = ((256 - fC) * (256 - fC) * 255) >> 16;
     uint32_t cIL = getPixelColor(iL | (vStrip<<16));
     uint32_t cIR = getPixelColor(iR | (vStrip<<16));
     if (iR!=iL) {
       // blend L pixel
-      cIL = color_blend(col, cIL, uint8_t(dL*255.0f));
+      cIL = color_blend(col, cIL, dL);
       setPixelColor(iL | (vStrip<<16), cIL);
       // blend R pixel
-      cIR = color_blend(col, cIR, uint8_t(dR*255.0f));
+      cIR = color_blend(col, cIR, dR);
       setPixelColor(iR | (vStrip<<16), cIR);
     } else {
       // exact match (x & y land on a pixel)
       setPixelColor(iL | (vStrip<<16), col);
     }
   } else {
-    setPixelColor(uint16_t(roundf(fC)) | (vStrip<<16), col);
+    setPixelColor(uint16_t((pC + 128) >> 8) | (vStrip<<16), col);
   }
 }
 
@@ -685,8 +1031,8 @@ uint32_t Segment::getPixelColor(int i)
 
 #ifndef WLED_DISABLE_2D
   if (is2D()) {
-    uint16_t vH = virtualHeight();  // segment height in logical pixels
-    uint16_t vW = virtualWidth();
+    uint16_t vH = _vHeight;  // segment height in logical pixels
+    uint16_t vW = _vWidth;
     switch (map1D2D) {
       case M12_Pixels:
         return getPixelColorXY(i % vW, i / vW);
@@ -705,7 +1051,9 @@ uint32_t Segment::getPixelColor(int i)
   }
 #endif
 
-  if (reverse) i = virtualLength() - i - 1;
+  if (_pixels) return i < _pixW * _pixH ? _pixels[i] : 0; // also covers 1D segments within matrix (one dimension is 1)
+
+  if (reverse) i = _vLength - i - 1;
   i *= groupLength();
   i += start;
   /* offset/phase */
@@ -714,6 +1062,55 @@ uint32_t Segment::getPixelColor(int i)
   return strip.getPixelColor(i);
 }
 
+/*
+ * Composites render buffer into strip: applies opacity/transition brightness once per frame,
+ * then writes each virtual pixel to its physical pixels using the compiled pixel map
+ * (grouping, spacing, reverse, mirror, transpose, offset and ledmap are folded into the map).
+ * Called by WS2812FX::service() after all effects have run.
+ */
+void Segment::renderPixels() {
+  if (!_pixels || !isActive()) return;
+  const uint8_t _bri_t = _frameBri;
+  const uint32_t *pixels = _pixels;
+  uint16_t pixW = _pixW, pixH = _pixH;
+  if (_scale) { // effect rendered at reduced resolution
+    upscaleBuffer(_pixels, _pixW, _pixH, _upPixels, _upW, _upH, _upPixels + _upW * _upH);
+    pixels = _upPixels;
+    pixW = _upW;
+    pixH = _upH;
+  }
+  if (!compilePixelMap()) { // not enough memory for the map, expand every pixel
+    const uint32_t *pix = pixels;
+    for (int y = 0; y < pixH; y++) for (int x = 0; x < pixW; x++) {
+      uint32_t col = *pix++;
+      if (_bri_t < 255) col = RGBW32(scale8(R(col), _bri_t), scale8(G(col), _bri_t), scale8(B(col), _bri_t), scale8(W(col), _bri_t));
+    #ifndef WLED_DISABLE_2D
+      if (Segment::maxHeight > 1 && start < Segment::maxWidth * Segment::maxHeight) expandPixelXY(x, y, col);
+      else
+    #endif
+      expandPixel(x, col);
+    }
+    return;
+  }
+  for (size_t r = 0; r < _mapRuns; r++) {
+    const PixelRun &run = _map[r];
+    if (_bri_t == 255 && run.physStep == 1 && run.virtStep == 1) { // consecutive on both sides
+      busses.setPixelColors(run.phys, pixels + run.virt, run.len);
+      continue;
+    }
+    uint16_t phys = run.phys;
+    uint16_t virt = run.virt;
+    uint32_t col = 0;
+    for (uint16_t n = 0; n < run.len; n++, phys += run.physStep, virt += run.virtStep) {
+      if (n == 0 || run.virtStep) { // grouped pixels share one color
+        col = pixels[virt];
+        if (_bri_t < 255) col = RGBW32(scale8(R(col), _bri_t), scale8(G(col), _bri_t), scale8(B(col), _bri_t), scale8(W(col), _bri_t));
+      }
+      busses.setPixelColor(phys, col);
+    }
+  }
+}
+
 uint8_t Segment::differs(Segment& b) const {
   uint8_t d = 0;
   if (start != b.start)         d |= SEG_DIFFERS_BOUNDS;
@@ -731,6 +1128,7 @@ uint8_t Segment::differs(Segment& b) const {
   if (custom3 != b.custom3)     d |= SEG_DIFFERS_FX;
   if (startY != b.startY)       d |= SEG_DIFFERS_BOUNDS;
   if (stopY != b.stopY)         d |= SEG_DIFFERS_BOUNDS;
+  if (renderScale != b.renderScale) d |= SEG_DIFFERS_OPT;
 
   //bit pattern: (msb first) set:2, sound:1, mapping:3, transposed, mirrorY, reverseY, [transitional, reset,] paused, mirrored, on, reverse, [selected]
   if ((options & 0b1111111110011110U) != (b.options & 0b1111111110011110U)) d |= SEG_DIFFERS_OPT;
@@ -795,6 +1193,10 @@ void Segment::refreshLightCapabilities() {
  */
 void Segment::fill(uint32_t c) {
   if (!isActive()) return; // not active
+  if (allocatePixels()) {
+    for (size_t i = 0; i < _pixW * _pixH; i++) _pixels[i] = c;
+    return;
+  }
   const uint16_t cols = is2D() ? virtualWidth() : virtualLength();
   const uint16_t rows = virtualHeight(); // will be 1 for 1D
   for(uint16_t y = 0; y < rows; y++) for (uint16_t x = 0; x < cols; x++) {
@@ -843,6 +1245,10 @@ void Segment::fade_out(uint8_t rate) {
   const uint16_t rows = virtualHeight(); // will be 1 for 1D
 
   rate = (255-rate) >> 1;
+  if (_pixels && _pixW * _pixH == cols * rows) {
+    fadeTowardColor(_pixels, cols * rows, colors[1], rate); // fade render buffer in one go
+    return;
+  }
   float mappedRate = float(rate) +1.1;
 
   uint32_t color = colors[1]; // SEGCOLOR(1); // target color
@@ -880,6 +1286,10 @@ void Segment::fadeToBlackBy(uint8_t fadeBy) {
   const uint16_t cols = is2D() ? virtualWidth() : virtualLength();
   const uint16_t rows = virtualHeight(); // will be 1 for 1D
 
+  if (_pixels && _pixW * _pixH == cols * rows) {
+    scaleBuffer(_pixels, cols * rows, 255-fadeBy);
+    return;
+  }
   for (uint16_t y = 0; y < rows; y++) for (uint16_t x = 0; x < cols; x++) {
     if (is2D()) setPixelColorXY(x, y, CRGB(getPixelColorXY(x,y)).nscale8(255-fadeBy));
     else        setPixelColor(x, CRGB(getPixelColor(x)).nscale8(255-fadeBy));
@@ -902,10 +1312,14 @@ void Segment::blur(uint8_t blur_amount)
     return;
   }
 #endif
+  uint_fast16_t vlength = virtualLength();
+  if (_pixels && _pixW * _pixH == vlength) {
+    blurBuffer(_pixels, vlength, 1, blur_amount);
+    return;
+  }
   uint8_t keep = 255 - blur_amount;
   uint8_t seep = blur_amount >> 1;
   CRGB carryover = CRGB::Black;
-  uint_fast16_t vlength = virtualLength();
   for(uint_fast16_t i = 0; i < vlength; i++)
   {
     CRGB cur = CRGB(getPixelColor(i));
@@ -981,13 +1395,10 @@ uint32_t Segment::color_from_palette(uint16_t i, bool mapping, bool wrap, uint8_
   }
 
   uint8_t paletteIndex = i;
-  if (mapping && virtualLength() > 1) paletteIndex = (i*255)/(virtualLength() -1);
+  if (mapping && _vLength > 1) paletteIndex = (i*255)/(_vLength -1);
   if (!wrap) paletteIndex = scale8(paletteIndex, 240); //cut off blend at palette "end"
-  CRGB fastled_col;
-  CRGBPalette16 curPal;
-  if (transitional && _t) curPal = _t->_palT;
-  else                    loadPalette(curPal, palette);
-  fastled_col = ColorFromPalette(curPal, paletteIndex, pbri, (strip.paletteBlend == 3)? NOBLEND:LINEARBLEND); // NOTE: paletteBlend should be global
+  const CRGBPalette16 &curPal = (transitional && _t) ? _t->_palT : getPalette(); // avoid copying the palette for each pixel
+  CRGB fastled_col = ColorFromPalette(curPal, paletteIndex, pbri, (strip.paletteBlend == 3)? NOBLEND:LINEARBLEND); // NOTE: paletteBlend should be global
 
   return RGBW32(fastled_col.r, fastled_col.g, fastled_col.b, 0);
 }
@@ -1000,6 +1411,8 @@ uint32_t Segment::color_from_palette(uint16_t i, bool mapping, bool wrap, uint8_
 //do not call this method from system context (network callback)
 void WS2812FX::finalizeInit(void)
 {
+  Segment::invalidatePixelMaps(); // bus layout (total length) may have changed
+
   //reset segment runtimes
   for (segment &seg : _segments) {
     seg.markForReset();
@@ -1078,6 +1491,8 @@ void WS2812FX::service() {
     seg.handleTransition();
     // reset the segment runtime data if needed
     seg.resetIfRequired();
+    if (seg.isActive()) seg.beginFrame(); // also needed by frozen segments for compositing
+    else                seg.deallocatePixels();
 
     // last condition ensures all solid segments are updated at the same time
     if (seg.isActive() && (nowUp > seg.next_time || _triggered || (doShow && seg.mode == FX_MODE_STATIC)))
@@ -1086,6 +1501,7 @@ void WS2812FX::service() {
       uint16_t delay = FRAMETIME;
 
       if (!seg.freeze) { //only run effect function if not frozen
+        seg.allocatePixels(); // effect renders directly into strip if render buffer cannot be allocated
         _virtualSegmentLength = seg.virtualLength();
         _colors_t[0] = seg.currentColor(0, seg.colors[0]);
         _colors_t[1] = seg.currentColor(1, seg.colors[1]);
@@ -1109,7 +1525,6 @@ void WS2812FX::service() {
     _segment_index++;
   }
   _virtualSegmentLength = 0;
-  busses.setSegmentCCT(-1);
   _isServicing = false;
   _triggered = false;
 
@@ -1117,6 +1532,13 @@ void WS2812FX::service() {
   if (millis() - nowUp > _frametime) DEBUG_PRINTLN(F("Slow effects."));
   #endif
   if (doShow) {
+    // single compositing pass, segments are drawn in order so later segments overlay earlier ones
+    for (segment &seg : _segments) {
+      if (!seg.isActive()) continue;
+      if (!cctFromRgb || correctWB) busses.setSegmentCCT(seg.currentBri(seg.cct, true), correctWB);
+      seg.renderPixels();
+    }
+    busses.setSegmentCCT(-1);
     yield();
     show();
   }
@@ -1151,7 +1573,17 @@ uint32_t WS2812FX::getPixelColor(uint16_t i)
 #define MA_FOR_ESP        100 //how much mA does the ESP use (Wemos D1 about 80mA, ESP32 about 120mA)
                               //you can set it to 0 if the ESP is powered by USB and the LEDs by external
 
-uint8_t WS2812FX::estimateCurrentAndLimitBri() {
+// scale brightness down so that power (mA at full brightness) stays within budget
+static uint8_t limitBrightness(uint8_t bri, size_t power, size_t budget) {
+  if (power * bri / 255 <= budget) return bri;
+  float scale = (float)(budget * 255) / (float)(power * bri);
+  uint16_t scaleI = scale * 255;
+  uint8_t scaleB = (scaleI > 255) ? 255 : scaleI;
+  return scale8(bri, scaleB) + 1;
+}
+
+// sets brightness of each bus, limited by the global budget and the bus' own power supply budget (if set)
+void WS2812FX::estimateCurrentAndLimitBri() {
   //power limit calculation
   //each LED can draw up 195075 "power units" (approx. 53mA)
   //one PU is the power it takes to have 1 channel 1 step brighter per brightness step
@@ -1161,40 +1593,42 @@ uint8_t WS2812FX::estimateCurrentAndLimitBri() {
 
   if (ablMilliampsMax < 150 || actualMilliampsPerLed == 0) { //0 mA per LED and too low numbers turn off calculation
     currentMilliamps = 0;
-    return _brightness;
+    for (uint_fast8_t bNum = 0; bNum < busses.getNumBusses(); bNum++) busses.getBus(bNum)->setCurrent(0);
+    busses.setBrightness(_brightness);
+    return;
   }
 
   if (milliampsPerLed == 255) {
     useWackyWS2815PowerModel = true;
     actualMilliampsPerLed = 12; // from testing an actual strip
   }
+  Bus::setWS2815PowerModel(useWackyWS2815PowerModel);
 
   size_t powerBudget = (ablMilliampsMax - MA_FOR_ESP); //100mA for ESP power
 
   size_t pLen = 0; //getLengthPhysical();
   size_t powerSum = 0;
+  uint32_t busPower[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES]; // mA at full brightness
+  uint8_t  busBri[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
   for (uint_fast8_t bNum = 0; bNum < busses.getNumBusses(); bNum++) {
     Bus *bus = busses.getBus(bNum);
+    busPower[bNum] = 0;
+    busBri[bNum] = _brightness;
     if (!IS_DIGITAL(bus->getType())) continue; //exclude non-digital network busses
     uint16_t len = bus->getLength();
     pLen += len;
-    uint32_t busPowerSum = 0;
-    for (uint_fast16_t i = 0; i < len; i++) { //sum up the usage of each LED
-      uint32_t c = bus->getPixelColor(i); // always returns original or restored color without brightness scaling
-      byte r = R(c), g = G(c), b = B(c), w = W(c);
-
-      if(useWackyWS2815PowerModel) { //ignore white component on WS2815 power calculation
-        busPowerSum += (MAX(MAX(r,g),b)) * 3;
-      } else {
-        busPowerSum += (r + g + b + w);
-      }
-    }
+    uint32_t busPowerSum = bus->getPowerSum(); // buffered busses keep the sum up to date while pixels are set
 
     if (bus->hasWhite()) { //RGBW led total output with white LEDs enabled is still 50mA, so each channel uses less
       busPowerSum *= 3;
       busPowerSum >>= 2; //same as /= 4
     }
-    powerSum += busPowerSum;
+    // busPowerSum has all the values of channels summed (max would be len*765 as white is excluded) so convert to milliAmps
+    busPower[bNum] = (busPowerSum * actualMilliampsPerLed) / 765;
+    powerSum += busPower[bNum];
+
+    size_t busBudget = bus->getMaxCurrent(); // bus has its own power supply
+    if (busBudget) busBri[bNum] = limitBrightness(_brightness, busPower[bNum], busBudget > len ? busBudget - len : 0);
   }
 
   if (powerBudget > pLen) { //each LED uses about 1mA in standby, exclude that from power budget
@@ -1203,20 +1637,19 @@ uint8_t WS2812FX::estimateCurrentAndLimitBri() {
     powerBudget = 0;
   }
 
-  // powerSum has all the values of channels summed (max would be pLen*765 as white is excluded) so convert to milliAmps
-  powerSum = (powerSum * actualMilliampsPerLed) / 765;
-
-  uint8_t newBri = _brightness;
-  if (powerSum * _brightness / 255 > powerBudget) { //scale brightness down to stay in current limit
-    float scale = (float)(powerBudget * 255) / (float)(powerSum * _brightness);
-    uint16_t scaleI = scale * 255;
-    uint8_t scaleB = (scaleI > 255) ? 255 : scaleI;
-    newBri = scale8(_brightness, scaleB) + 1;
+  uint8_t newBri = limitBrightness(_brightness, powerSum, powerBudget);
+  currentMilliamps = 0;
+  for (uint_fast8_t bNum = 0; bNum < busses.getNumBusses(); bNum++) {
+    Bus *bus = busses.getBus(bNum);
+    uint8_t bri = busBri[bNum] < newBri ? busBri[bNum] : newBri;
+    busses.setBusBrightness(bNum, bri);
+    if (!IS_DIGITAL(bus->getType())) continue;
+    uint32_t busMilliamps = (busPower[bNum] * bri) / 255;
+    bus->setCurrent(busMilliamps + bus->getLength()); //add standby power (1mA/LED) to estimate
+    currentMilliamps += busMilliamps;
   }
-  currentMilliamps = (powerSum * newBri) / 255;
   currentMilliamps += MA_FOR_ESP; //add power of ESP back to estimate
   currentMilliamps += pLen; //add standby power (1mA/LED) back to estimate
-  return newBri;
 }
 
 void WS2812FX::show(void) {
@@ -1224,19 +1657,15 @@ void WS2812FX::show(void) {
   show_callback callback = _callback;
   if (callback) callback();
 
-  uint8_t newBri = estimateCurrentAndLimitBri();
-  busses.setBrightness(newBri); // "repaints" all pixels if brightness changed
+  // brightness (including current limit) is applied by each bus while sending, buffered colors stay unscaled
+  // unbuffered digital busses only repaint when the limited brightness differs from previous frame
+  estimateCurrentAndLimitBri();
 
   // some buses send asynchronously and this method will return before
   // all of the data has been sent.
   // See https://github.com/Makuna/NeoPixelBus/wiki/ESP32-NeoMethods#neoesp32rmt-methods
   busses.show();
 
-  // restore bus brightness to its original value
-  // this is done right after show, so this is only OK if LED updates are completed before show() returns
-  // or async show has a separate buffer (ESP32 RMT and I2S are ok)
-  if (newBri < _brightness) busses.setBrightness(_brightness);
-
   unsigned long now = millis();
   size_t diff = now - _lastShow;
   size_t fpsCurr = 200;
@@ -1309,9 +1738,7 @@ void WS2812FX::setBrightness(uint8_t b, bool direct) {
       seg.freeze = false;
     }
   }
-  // setting brightness with NeoPixelBusLg has no effect on already painted pixels,
-  // so we need to force an update to existing buffer
-  busses.setBrightness(b);
+  // busses receive the new (possibly current limited) brightness in show()
   if (!direct) {
     unsigned long t = millis();
     if (_segments[0].next_time > t + 22 && t - _lastShow > MIN_SHOW_DELAY) trigger(); //apply brightness change immediately if no refresh soon
@@ -1622,6 +2049,7 @@ void WS2812FX::loadCustomPalettes() {
   byte tcp[72]; //support gradient palettes with up to 18 entries
   CRGBPalette16 targetPalette;
   customPalettes.clear(); // start fresh
+  Segment::invalidatePaletteCache(); // palette IDs of custom palettes may now point elsewhere
   for (int index = 0; index<10; index++) {
     char fileName[32];
     sprintf_P(fileName, PSTR("/palette%d.json"), index);
@@ -1668,6 +2096,7 @@ void WS2812FX::loadCustomPalettes() {
 //load custom mapping table from JSON file (called from finalizeInit() or deserializeState())
 bool WS2812FX::deserializeMap(uint8_t n) {
   // 2D support creates its own ledmap (on the fly) if a ledmap.json exists it will overwrite built one.
+  Segment::invalidatePixelMaps();
 
   char fileName[32];
   strcpy_P(fileName, PSTR("/ledmap"));
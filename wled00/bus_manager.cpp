@@ -10,12 +10,16 @@
 #include "bus_manager.h"
 
 //colors.cpp
-uint32_t colorBalanceFromKelvin(uint16_t kelvin, uint32_t rgb);
+void colorKtoRGB(uint16_t kelvin, byte* rgb);
 uint16_t approximateKelvinFromRGB(uint32_t rgb);
 void colorRGBtoRGBW(byte* rgb);
 
 //udp.cpp
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, uint8_t bri=255, bool isRGBW=false);
+size_t realtimePacketSize(uint8_t type);
+void realtimePreparePacket(uint8_t type, NetOutput *out);
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, uint8_t bri, bool isRGBW, NetOutput *out);
+void realtimeBeginFrame(uint8_t type, NetOutput *out, bool isRGBW);
+uint8_t realtimeSendPacket(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW, NetOutput *out);
 
 // enable additional debug output
 #if defined(WLED_DEBUG_HOST)
@@ -75,9 +79,31 @@ uint8_t IRAM_ATTR ColorOrderMap::getPixelColorOrder(uint16_t pix, uint8_t defaul
 }
 
 
-uint32_t Bus::autoWhiteCalc(uint32_t c) {
-  uint8_t aWM = _autoWhiteMode;
-  if (_gAWM < 255) aWM = _gAWM;
+void Bus::setCCT(uint16_t cct) {
+  int16_t kelvin = cct;
+  if (kelvin >= 1900 && kelvin != _cct) colorKtoRGB(kelvin, _cctRGB); // white balance correction is only recalculated on change
+  _cct = kelvin;
+}
+
+// exact c*k/255 per channel without division
+inline uint32_t IRAM_ATTR Bus::colorBalance(uint32_t c) {
+  uint16_t r = _cctRGB[0] * R(c), g = _cctRGB[1] * G(c), b = _cctRGB[2] * B(c);
+  return RGBW32((r + 1 + (r >> 8)) >> 8, (g + 1 + (g >> 8)) >> 8, (b + 1 + (b >> 8)) >> 8, W(c));
+}
+
+inline uint32_t IRAM_ATTR Bus::pixelPower(uint32_t c) {
+  uint8_t r = R(c), g = G(c), b = B(c);
+  if (_ws2815Power) { // ignore white component on WS2815 power calculation
+    if (g > r) r = g;
+    if (b > r) r = b;
+    return r * 3;
+  }
+  return r + g + b + W(c);
+}
+
+// white from min/max of RGB, depends on all channels so it cannot be folded into a per-channel table
+inline uint32_t IRAM_ATTR Bus::autoWhiteCalc(uint32_t c) {
+  uint8_t aWM = _gAWM < 255 ? _gAWM : _autoWhiteMode;
   if (aWM == RGBW_MODE_MANUAL_ONLY) return c;
   uint8_t w = W(c);
   //ignore auto-white calculation if w>0 and mode DUAL (DUAL behaves as BRIGHTER if w==0)
@@ -96,12 +122,27 @@ uint8_t *Bus::allocData(size_t size) {
   return _data = (uint8_t *)(size>0 ? calloc(size, sizeof(uint8_t)) : nullptr);
 }
 
+// copy of the first size bytes of _data for the output task, bus is sent synchronously if it cannot be allocated
+void Bus::allocSendData(size_t size) {
+  #ifdef WLED_ENABLE_PIPELINE
+  freeSendData();
+  _sendData = (uint8_t *)(size>0 ? calloc(size, sizeof(uint8_t)) : nullptr);
+  _sendLen = _sendData ? size : 0;
+  #endif
+}
+
 
 BusDigital::BusDigital(BusConfig &bc, uint8_t nr, const ColorOrderMap &com)
-: Bus(bc.type, bc.start, bc.autoWhite, bc.count, bc.reversed, (bc.refreshReq || bc.type == TYPE_TM1814))
+: Bus(bc.type, bc.start, bc.autoWhite, bc.count, bc.reversed, (bc.refreshReq || bc.type == TYPE_TM1814), bc.milliAmpsMax)
 , _skip(bc.skipAmount) //sacrificial pixels
 , _colorOrder(bc.colorOrder)
 , _colorOrderMap(com)
+, _powerSum(0)
+, _powerModel(false)
+, _briLUT(nullptr)
+, _lutBri(0)
+, _numCoRuns(0)
+, _lastCoRun(0)
 {
   if (!IS_DIGITAL(bc.type) || !bc.count) return;
   if (!pinManager.allocatePin(bc.pins[0], true, PinOwner::BusDigital)) return;
@@ -117,36 +158,41 @@ BusDigital::BusDigital(BusConfig &bc, uint8_t nr, const ColorOrderMap &com)
   }
   _iType = PolyBus::getI(bc.type, _pins, nr);
   if (_iType == I_NONE) return;
-  if (bc.doubleBuffer && !allocData(bc.count * (Bus::hasWhite(_type) + 3*Bus::hasRGB(_type)))) return; //warning: hardcoded channel count
+  size_t bufLen = bc.count * (Bus::hasWhite(_type) + 3*Bus::hasRGB(_type)); //warning: hardcoded channel count
+  if (bc.doubleBuffer && !allocData(bufLen + 256)) return;
+  if (bc.doubleBuffer) _briLUT = _data + bufLen;
   _buffering = bc.doubleBuffer;
   uint16_t lenToCreate = bc.count;
   if (bc.type == TYPE_WS2812_1CH_X3) lenToCreate = NUM_ICS_WS2812_1CH_3X(bc.count); // only needs a third of "RGB" LEDs for NeoPixelBus
   _busPtr = PolyBus::create(_iType, _pins, lenToCreate + _skip, nr, _frequencykHz);
   _valid = (_busPtr != nullptr);
+  if (_valid && _buffering) allocSendData(bufLen);
+  compileOutput();
   DEBUG_PRINTF("%successfully inited strip %u (len %u) with type %u and pins %u,%u (itype %u)\n", _valid?"S":"Uns", nr, bc.count, bc.type, _pins[0], _pins[1], _iType);
 }
 
 void BusDigital::show() {
   if (!_valid) return;
   if (_buffering) { // should be _data != nullptr, but that causes ~20% FPS drop
-    size_t channels = Bus::hasWhite(_type) + 3*Bus::hasRGB(_type);
-    for (size_t i=0; i<_len; i++) {
-      size_t offset = i*channels;
-      uint8_t co = _colorOrderMap.getPixelColorOrder(i+_start, _colorOrder);
-      uint32_t c;
-      if (_type == TYPE_WS2812_1CH_X3) { // map to correct IC, each controls 3 LEDs (_len is always a multiple of 3)
-        switch (i%3) {
-          case 0: c = RGBW32(_data[offset]  , _data[offset+1], _data[offset+2], 0); break;
-          case 1: c = RGBW32(_data[offset-1], _data[offset]  , _data[offset+1], 0); break;
-          case 2: c = RGBW32(_data[offset-2], _data[offset-1], _data[offset]  , 0); break;
-        }
-      } else {
-        c = RGBW32(_data[offset],_data[offset+1],_data[offset+2],(Bus::hasWhite(_type)?_data[offset+3]:0));
-      }
-      uint16_t pix = i;
-      if (_reversed) pix  = _len - pix -1;
-      else           pix += _skip;
-      PolyBus::setPixelColor(_busPtr, _iType, pix, c, co);
+    // _data holds unscaled colors, brightness is applied here once per frame (NeoPixelBus luminance stays at 255)
+    const uint8_t *lut = _briLUT;
+    const uint8_t bri = frameBri();
+    if (_lutBri != bri) { // zeroed table matches initial _lutBri of 0
+      for (size_t v = 0; v < 256; v++) _briLUT[v] = (v * (bri + 1)) >> 8; // same scaling as NeoPixelBusLg
+      _lutBri = bri;
+    }
+    const bool    x3 = _type == TYPE_WS2812_1CH_X3;
+    const bool    white = Bus::hasWhite(_type) && !x3;
+    const size_t  channels = Bus::hasWhite(_type) + 3*Bus::hasRGB(_type);
+    const uint8_t *d = frameData();
+    size_t run = 0;
+    uint8_t co = _numCoRuns < 2 ? _colorOrder : _coRun[0];
+    for (size_t i=0; i<_len; i++, d += channels) {
+      if (_numCoRuns > 1 && i >= _coRunEnd[run]) co = _coRun[++run]; // next color order run
+      const uint8_t *p = d;
+      if (x3) p -= i%3; // map to correct IC, each controls 3 LEDs (_len is always a multiple of 3)
+      uint32_t c = RGBW32(lut[p[0]], lut[p[1]], lut[p[2]], white ? lut[p[3]] : 0);
+      PolyBus::setPixelColor(_busPtr, _iType, _reversed ? _len - i - 1 : i + _skip, c, co);
     }
   }
   PolyBus::show(_busPtr, _iType, !_buffering); // faster if buffer consistency is not important
@@ -167,9 +213,9 @@ void BusDigital::setBrightness(uint8_t b) {
   #endif
   uint8_t prevBri = _bri;
   Bus::setBrightness(b);
-  PolyBus::setBrightness(_busPtr, _iType, b);
+  if (_buffering) return; // applied in show()
 
-  if (_buffering) return;
+  PolyBus::setBrightness(_busPtr, _iType, b);
 
   // must update/repaint every LED in the NeoPixelBus buffer to the new brightness
   // the only case where repainting is unnecessary is when all pixels are set after the brightness change but before the next show
@@ -187,7 +233,7 @@ void BusDigital::setBrightness(uint8_t b) {
 //TODO only show if no new show due in the next 50ms
 void BusDigital::setStatusPixel(uint32_t c) {
   if (_valid && _skip) {
-    PolyBus::setPixelColor(_busPtr, _iType, 0, c, _colorOrderMap.getPixelColorOrder(_start, _colorOrder));
+    PolyBus::setPixelColor(_busPtr, _iType, 0, c, colorOrderAt(0));
     if (canShow()) PolyBus::show(_busPtr, _iType);
   }
 }
@@ -195,20 +241,15 @@ void BusDigital::setStatusPixel(uint32_t c) {
 void IRAM_ATTR BusDigital::setPixelColor(uint16_t pix, uint32_t c) {
   if (!_valid) return;
   if (Bus::hasWhite(_type)) c = autoWhiteCalc(c);
-  if (_cct >= 1900) c = colorBalanceFromKelvin(_cct, c); //color correction from CCT
+  if (_cct >= 1900) c = colorBalance(c); //color correction from CCT
   if (_buffering) { // should be _data != nullptr, but that causes ~20% FPS drop
-    size_t channels = Bus::hasWhite(_type) + 3*Bus::hasRGB(_type);
-    size_t offset = pix*channels;
-    if (Bus::hasRGB(_type)) {
-      _data[offset++] = R(c);
-      _data[offset++] = G(c);
-      _data[offset++] = B(c);
-    }
-    if (Bus::hasWhite(_type)) _data[offset] = W(c);
+    bool rgb = Bus::hasRGB(_type), white = Bus::hasWhite(_type);
+    storePixel(_data + pix*(white + 3*rgb), c, rgb, white);
   } else {
+    _changed = true; // reading back from NeoPixelBus is lossy and slow, always send
+    uint8_t co = colorOrderAt(pix);
     if (_reversed) pix  = _len - pix -1;
     else           pix += _skip;
-    uint8_t co = _colorOrderMap.getPixelColorOrder(pix+_start, _colorOrder);
     if (_type == TYPE_WS2812_1CH_X3) { // map to correct IC, each controls 3 LEDs
       uint16_t pOld = pix;
       pix = IC_INDEX_WS2812_1CH_3X(pix);
@@ -223,6 +264,22 @@ void IRAM_ATTR BusDigital::setPixelColor(uint16_t pix, uint32_t c) {
   }
 }
 
+// same as setPixelColor() for consecutive pixels, type and white balance checks are done once per call
+void IRAM_ATTR BusDigital::setPixelColors(uint16_t pix, const uint32_t *c, uint16_t count) {
+  if (!_valid || pix >= _len) return;
+  if (!_buffering) { Bus::setPixelColors(pix, c, count); return; } // NeoPixelBus is written pixel by pixel anyway
+  if (count > _len - pix) count = _len - pix;
+  const bool rgb = Bus::hasRGB(_type), white = Bus::hasWhite(_type), balance = _cct >= 1900;
+  const size_t channels = white + 3*rgb;
+  uint8_t *d = _data + pix*channels;
+  for (uint16_t i = 0; i < count; i++, d += channels) {
+    uint32_t col = c[i];
+    if (white)   col = autoWhiteCalc(col);
+    if (balance) col = colorBalance(col); //color correction from CCT
+    storePixel(d, col, rgb, white);
+  }
+}
+
 // returns original color if global buffering is enabled, else returns lossly restored color from bus
 uint32_t BusDigital::getPixelColor(uint16_t pix) {
   if (!_valid) return 0;
@@ -237,9 +294,9 @@ uint32_t BusDigital::getPixelColor(uint16_t pix) {
     }
     return c;
   } else {
+    uint8_t co = colorOrderAt(pix);
     if (_reversed) pix  = _len - pix -1;
     else           pix += _skip;
-    uint8_t co = _colorOrderMap.getPixelColorOrder(pix+_start, _colorOrder);
     uint32_t c = restoreColorLossy(PolyBus::getPixelColor(_busPtr, _iType, (_type==TYPE_WS2812_1CH_X3) ? IC_INDEX_WS2812_1CH_3X(pix) : pix, co),_bri);
     if (_type == TYPE_WS2812_1CH_X3) { // map to correct IC, each controls 3 LEDs
       uint8_t r = R(c);
@@ -265,6 +322,33 @@ void BusDigital::setColorOrder(uint8_t colorOrder) {
   // upper nibble contains W swap information
   if ((colorOrder & 0x0F) > 5) return;
   _colorOrder = colorOrder;
+  compileOutput();
+}
+
+// sum of pixelPower() of all pixels, only unbuffered busses need to read back every pixel
+uint32_t BusDigital::getPowerSum() {
+  if (!_valid) return 0;
+  if (_buffering && _powerModel == _ws2815Power) return _powerSum;
+  _powerModel = _ws2815Power;
+  uint32_t sum = 0;
+  for (uint_fast16_t i = 0; i < _len; i++) sum += pixelPower(getPixelColor(i)); // always returns original or restored color without brightness scaling
+  if (_buffering) _powerSum = sum;
+  return sum;
+}
+
+// resolve color order map into runs of bus pixels so show() and setPixelColor() do not scan the map for every pixel
+void BusDigital::compileOutput() {
+  _numCoRuns = 0;
+  _lastCoRun = 0;
+  for (uint16_t i = 0; i < _len; i++) {
+    uint8_t co = _colorOrderMap.getPixelColorOrder(i+_start, _colorOrder);
+    if (_numCoRuns == 0 || co != _coRun[_numCoRuns-1]) {
+      if (_numCoRuns >= sizeof(_coRun)) break; // cannot happen, map entries can split bus into at most 2*n+1 runs
+      _coRun[_numCoRuns++] = co;
+    }
+    _coRunEnd[_numCoRuns-1] = i+1;
+  }
+  if (_numCoRuns) _coRunEnd[_numCoRuns-1] = _len; // in case of break above
 }
 
 void BusDigital::reinit() {
@@ -279,6 +363,8 @@ void BusDigital::cleanup() {
   _valid = false;
   _busPtr = nullptr;
   if (_data != nullptr) freeData();
+  freeSendData();
+  _briLUT = nullptr;
   pinManager.deallocatePin(_pins[1], PinOwner::BusDigital);
   pinManager.deallocatePin(_pins[0], PinOwner::BusDigital);
 }
@@ -316,13 +402,14 @@ BusPwm::BusPwm(BusConfig &bc)
   }
   _data = _pwmdata; // avoid malloc() and use stack
   _valid = true;
+  allocSendData(numPins);
 }
 
 void BusPwm::setPixelColor(uint16_t pix, uint32_t c) {
   if (pix != 0 || !_valid) return; //only react to first pixel
   if (_type != TYPE_ANALOG_3CH) c = autoWhiteCalc(c);
   if (_cct >= 1900 && (_type == TYPE_ANALOG_3CH || _type == TYPE_ANALOG_4CH)) {
-    c = colorBalanceFromKelvin(_cct, c); //color correction from CCT
+    c = colorBalance(c); //color correction from CCT
   }
   uint8_t r = R(c);
   uint8_t g = G(c);
@@ -352,6 +439,8 @@ void BusPwm::setPixelColor(uint16_t pix, uint32_t c) {
   cw = (w * cw) / 255;
   #endif
 
+  uint8_t prev[5];
+  memcpy(prev, _data, NUM_PWM_PINS(_type));
   switch (_type) {
     case TYPE_ANALOG_1CH: //one channel (white), relies on auto white calculation
       _data[0] = w;
@@ -369,6 +458,7 @@ void BusPwm::setPixelColor(uint16_t pix, uint32_t c) {
       _data[0] = r; _data[1] = g; _data[2] = b;
       break;
   }
+  if (memcmp(prev, _data, NUM_PWM_PINS(_type))) _changed = true;
 }
 
 //does no index check
@@ -380,8 +470,10 @@ uint32_t BusPwm::getPixelColor(uint16_t pix) {
 void BusPwm::show() {
   if (!_valid) return;
   uint8_t numPins = NUM_PWM_PINS(_type);
+  const uint8_t *d = frameData();
+  const uint8_t bri = frameBri();
   for (uint8_t i = 0; i < numPins; i++) {
-    uint8_t scaled = (_data[i] * _bri) / 255;
+    uint8_t scaled = (d[i] * bri) / 255;
     if (_reversed) scaled = 255 - scaled;
     #ifdef ESP8266
     analogWrite(_pins[i], scaled);
@@ -431,6 +523,7 @@ BusOnOff::BusOnOff(BusConfig &bc)
   pinMode(_pin, OUTPUT);
   _data = &_onoffdata; // avoid malloc() and use stack
   _valid = true;
+  allocSendData(1);
 }
 
 void BusOnOff::setPixelColor(uint16_t pix, uint32_t c) {
@@ -440,7 +533,9 @@ void BusOnOff::setPixelColor(uint16_t pix, uint32_t c) {
   uint8_t g = G(c);
   uint8_t b = B(c);
   uint8_t w = W(c);
-  _data[0] = bool(r|g|b|w) && bool(_bri) ? 0xFF : 0;
+  uint8_t onoff = bool(r|g|b|w) && bool(_bri) ? 0xFF : 0;
+  if (_data[0] != onoff) _changed = true;
+  _data[0] = onoff;
 }
 
 uint32_t BusOnOff::getPixelColor(uint16_t pix) {
@@ -450,7 +545,8 @@ uint32_t BusOnOff::getPixelColor(uint16_t pix) {
 
 void BusOnOff::show() {
   if (!_valid) return;
-  digitalWrite(_pin, _reversed ? !(bool)_data[0] : (bool)_data[0]);
+  bool on = frameData()[0];
+  digitalWrite(_pin, _reversed ? !on : on);
 }
 
 uint8_t BusOnOff::getPins(uint8_t* pinArray) {
@@ -473,6 +569,11 @@ BusNetwork::BusNetwork(BusConfig &bc)
       _rgbw = false;
       _UDPtype = 1;
       break;
+    case TYPE_NET_WLED_RGB:
+    case TYPE_NET_WLED_RGBW:
+      _rgbw = bc.type == TYPE_NET_WLED_RGBW;
+      _UDPtype = 3;
+      break;
     default: // TYPE_NET_DDP_RGB / TYPE_NET_DDP_RGBW
       _rgbw = bc.type == TYPE_NET_DDP_RGBW;
       _UDPtype = 0;
@@ -481,19 +582,62 @@ BusNetwork::BusNetwork(BusConfig &bc)
   _UDPchannels = _rgbw ? 4 : 3;
   _client = IPAddress(bc.pins[0],bc.pins[1],bc.pins[2],bc.pins[3]);
   _valid = (allocData(_len * _UDPchannels) != nullptr);
+  static_cast<NetOutputConfig&>(_out) = bc.net;
+  if (_out.priority > 200) _out.priority = 200;
+  if (_out.channel > 512 - _UDPchannels) _out.channel = 0; // at least one pixel must fit into first universe
+  size_t packetSize = realtimePacketSize(_UDPtype);
+  if (_valid && packetSize) {
+    _out.packet = (uint8_t*) malloc(packetSize);
+    _valid = (_out.packet != nullptr);
+    if (_valid) realtimePreparePacket(_UDPtype, &_out);
+  }
+  if (_valid && _UDPtype == 3) { // delta stream keeps the previous frame
+    _out.last = (uint8_t*) malloc(_len * _UDPchannels);
+    _valid = (_out.last != nullptr);
+  }
+  #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+  if (_valid) {
+    for (uint8_t i = 0; i < 3; i++) {
+      _frame[i].data = (uint8_t*) malloc(_len * _UDPchannels);
+      if (!_frame[i].data) { freeFrames(); break; } // not enough memory, bus is sent synchronously
+    }
+    _out.fromTask = _frame[0].data != nullptr;
+  }
+  #endif
+  if (_valid) allocSendData(_len * _UDPchannels);
 }
 
 void BusNetwork::setPixelColor(uint16_t pix, uint32_t c) {
   if (!_valid || pix >= _len) return;
   if (_rgbw) c = autoWhiteCalc(c);
-  if (_cct >= 1900) c = colorBalanceFromKelvin(_cct, c); //color correction from CCT
+  if (_cct >= 1900) c = colorBalance(c); //color correction from CCT
   uint16_t offset = pix * _UDPchannels;
+  if (_data[offset] != R(c) || _data[offset+1] != G(c) || _data[offset+2] != B(c) || (_rgbw && _data[offset+3] != W(c))) _changed = true;
   _data[offset]   = R(c);
   _data[offset+1] = G(c);
   _data[offset+2] = B(c);
   if (_rgbw) _data[offset+3] = W(c);
 }
 
+void BusNetwork::setPixelColors(uint16_t pix, const uint32_t *c, uint16_t count) {
+  if (!_valid || pix >= _len) return;
+  if (count > _len - pix) count = _len - pix;
+  const bool balance = _cct >= 1900;
+  uint8_t *d = _data + pix * _UDPchannels;
+  bool changed = false;
+  for (uint16_t i = 0; i < count; i++, d += _UDPchannels) {
+    uint32_t col = c[i];
+    if (_rgbw)   col = autoWhiteCalc(col);
+    if (balance) col = colorBalance(col); //color correction from CCT
+    changed |= d[0] != R(col) || d[1] != G(col) || d[2] != B(col) || (_rgbw && d[3] != W(col));
+    d[0] = R(col);
+    d[1] = G(col);
+    d[2] = B(col);
+    if (_rgbw) d[3] = W(col);
+  }
+  if (changed) _changed = true;
+}
+
 uint32_t BusNetwork::getPixelColor(uint16_t pix) {
   if (!_valid || pix >= _len) return 0;
   uint16_t offset = pix * _UDPchannels;
@@ -503,10 +647,56 @@ uint32_t BusNetwork::getPixelColor(uint16_t pix) {
 void BusNetwork::show() {
   if (!_valid || !canShow()) return;
   _broadcastLock = true;
-  realtimeBroadcast(_UDPtype, _client, _len, _data, _bri, _rgbw);
+  if (realtimeBroadcast(_UDPtype, _client, _len, frameData(), frameBri(), _rgbw, &_out) == 0) _stats.sent++;
   _broadcastLock = false;
 }
 
+#ifdef WLED_ENABLE_NET_OUTPUT_TASK
+#define NET_FRAME_NEW 0x80
+
+bool BusNetwork::queueFrame() {
+  if (!_valid || !_frame[0].data) return false;
+  NetFrame &f = _frame[_fillFrame];
+  memcpy(f.data, frameData(), _len * _UDPchannels);
+  f.bri = frameBri();
+  f.queued = millis();
+  uint8_t prev = _waitingFrame.exchange(_fillFrame | NET_FRAME_NEW);
+  if (prev & NET_FRAME_NEW) _stats.dropped++; // destination fell behind, previous frame is stale
+  _fillFrame = prev & 0x03;
+  return true;
+}
+
+// packets to one destination are spaced WLED_NET_PACKET_GAP apart (bursts overflow the WiFi TX queue),
+// the task only wakes up once per RTOS tick so a destination may catch up within one tick
+int32_t BusNetwork::sendPacket(uint32_t now) {
+  if (!_valid) return -1;
+  if (!_out.pending) {
+    if (!(_waitingFrame.load() & NET_FRAME_NEW)) return -1;
+    _sendFrame = _waitingFrame.exchange(_sendFrame) & 0x03;
+    if (millis() - _frame[_sendFrame].queued > WLED_NET_LATE_MS) _stats.late++;
+    realtimeBeginFrame(_UDPtype, &_out, _rgbw);
+    if (!_out.pending) return -1;
+  }
+  int32_t wait = int32_t(_nextPacket - now);
+  if (wait > 0) return wait;
+  const int32_t maxLag = portTICK_PERIOD_MS * 1000;
+  if (wait < -maxLag) _nextPacket = now - maxLag;
+  _nextPacket += WLED_NET_PACKET_GAP;
+  NetFrame &f = _frame[_sendFrame];
+  if (realtimeSendPacket(_UDPtype, _client, _len, f.data, f.bri, _rgbw, &_out)) return -1; // rest of frame is dropped
+  if (!_out.pending) _stats.sent++;
+  if (!_out.pending && !(_waitingFrame.load() & NET_FRAME_NEW)) return -1;
+  return int32_t(_nextPacket - now);
+}
+
+void BusNetwork::freeFrames() {
+  for (uint8_t i = 0; i < 3; i++) {
+    if (_frame[i].data) free(_frame[i].data);
+    _frame[i].data = nullptr;
+  }
+}
+#endif
+
 uint8_t BusNetwork::getPins(uint8_t* pinArray) {
   for (uint8_t i = 0; i < 4; i++) {
     pinArray[i] = _client[i];
@@ -518,6 +708,14 @@ void BusNetwork::cleanup() {
   _type = I_NONE;
   _valid = false;
   freeData();
+  if (_out.packet) free(_out.packet);
+  if (_out.last) free(_out.last);
+  _out.packet = nullptr;
+  _out.last = nullptr;
+  freeSendData();
+  #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+  freeFrames();
+  #endif
 }
 
 
@@ -535,18 +733,48 @@ uint32_t BusManager::memUsage(BusConfig &bc) {
       if (type > 28) return len*4; //RGBW
       return len*3;
     #else //ESP32 RMT uses double buffer?
-      if (type > 28) return len*8; //RGBW
-      return len*6;
+      uint8_t frames = 2;
+      #ifdef WLED_ENABLE_PIPELINE
+      if (bc.doubleBuffer) frames++; // copy sent by the output task
+      #endif
+      if (type > 28) return len*4*frames; //RGBW
+      return len*3*frames;
     #endif
   }
   if (type > 31 && type < 48) return 5;
+  if (IS_VIRTUAL(type)) { // network busses also hold one packet buffer
+    uint8_t udpType = 0, frames = 1;
+    switch (type) {
+      case TYPE_NET_E131_RGB:   udpType = 1; break;
+      case TYPE_NET_ARTNET_RGB: udpType = 2; break;
+      case TYPE_NET_WLED_RGB:
+      case TYPE_NET_WLED_RGBW:  udpType = 3; frames++; break; // and the previous frame
+    }
+    #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+    frames += 3; // queued frames
+    #endif
+    #ifdef WLED_ENABLE_PIPELINE
+    frames++; // copy sent by the output task
+    #endif
+    return len*(Bus::hasWhite(type) ? 4 : 3)*frames + realtimePacketSize(udpType);
+  }
   return len*3; //RGB
 }
 
 int BusManager::add(BusConfig &bc) {
   if (getNumBusses() - getNumVirtualBusses() >= WLED_MAX_BUSSES) return -1;
-  if (bc.type >= TYPE_NET_DDP_RGB && bc.type < 96) {
+  if (getNumBusses() >= WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES) return -1;
+  if (IS_VIRTUAL(bc.type)) {
     busses[numBusses] = new BusNetwork(bc);
+    #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+    #ifdef CONFIG_FREERTOS_UNICORE
+    const BaseType_t netCore = tskNO_AFFINITY;
+    #else
+    const BaseType_t netCore = 1 - xPortGetCoreID();
+    #endif
+    // busses are sent from the main loop if the task can not be created
+    if (netTask == nullptr && xTaskCreatePinnedToCore(netOutputLoop, "netOutput", 4096, this, 1, &netTask, netCore) != pdPASS) netTask = nullptr;
+    #endif
   } else if (IS_DIGITAL(bc.type)) {
     busses[numBusses] = new BusDigital(bc, numBusses, colorOrderMap);
   } else if (bc.type == TYPE_ONOFF) {
@@ -554,7 +782,12 @@ int BusManager::add(BusConfig &bc) {
   } else {
     busses[numBusses] = new BusPwm(bc);
   }
-  return numBusses++;
+  #ifdef WLED_ENABLE_PIPELINE
+  if (busses[numBusses]->isOk() && !busses[numBusses]->hasFrame()) serialOutput = true; // unbuffered digital bus or out of memory
+  #endif
+  numBusses++;
+  buildPixelLookup();
+  return numBusses-1;
 }
 
 //do not call this method from system context (network callback)
@@ -562,37 +795,221 @@ void BusManager::removeAll() {
   DEBUG_PRINTLN(F("Removing all."));
   //prevents crashes due to deleting busses while in use.
   while (!canAllShow()) yield();
+  #ifdef WLED_ENABLE_PIPELINE
+  if (outputTask != nullptr) vTaskDelete(outputTask); // idle now, show() creates it again for the new busses
+  outputTask = nullptr;
+  serialOutput = false;
+  #endif
+  #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+  netHold = true; // released by the next showBusses(), after all new busses were added
+  while (netActive) yield();
+  #endif
   for (uint8_t i = 0; i < numBusses; i++) delete busses[i];
   numBusses = 0;
+  buildPixelLookup();
 }
 
-void BusManager::show() {
+// sort bus ranges by start so a pixel can be resolved with a binary search instead of testing every bus
+void BusManager::buildPixelLookup() {
+  numRuns = 0;
+  lastRun = 0;
+  overlapping = false;
   for (uint8_t i = 0; i < numBusses; i++) {
-    busses[i]->show();
+    uint16_t len = busses[i]->getLength();
+    if (len == 0) continue;
+    uint16_t start = busses[i]->getStart();
+    uint8_t j = numRuns++;
+    for (; j > 0 && runStart[j-1] > start; j--) { // insertion sort, there are only a few busses
+      runStart[j] = runStart[j-1];
+      runEnd[j]   = runEnd[j-1];
+      runBus[j]   = runBus[j-1];
+    }
+    runStart[j] = start;
+    runEnd[j]   = start + len;
+    runBus[j]   = i;
   }
+  for (uint8_t r = 1; r < numRuns; r++) if (runStart[r] < runEnd[r-1]) overlapping = true;
 }
 
+// returns index of the run containing pixel or -1 if pixel is not on any bus
+int IRAM_ATTR BusManager::findRun(uint16_t pix) {
+  if (numRuns == 0) return -1;
+  if (pix >= runStart[lastRun] && pix < runEnd[lastRun]) return lastRun;
+  int lo = 0, hi = numRuns - 1;
+  while (lo < hi) { // last run starting at or before pix
+    int mid = (lo + hi + 1) >> 1;
+    if (runStart[mid] <= pix) lo = mid;
+    else                      hi = mid - 1;
+  }
+  if (pix < runStart[lo] || pix >= runEnd[lo]) return -1;
+  lastRun = lo;
+  return lo;
+}
+
+// busses without pixel or brightness changes since their last show are skipped
+// unless they need refresh when off or the keep-alive interval elapsed (receivers may time out)
+void BusManager::prepareFrame() {
+  unsigned long now = millis();
+  bool refreshAll = !keepAlive || now - lastKeepAlive >= keepAlive;
+  if (refreshAll) lastKeepAlive = now;
+  for (uint8_t i = 0; i < numBusses; i++) {
+    Bus *b = busses[i];
+    showBus[i] = refreshAll || b->isChanged() || b->isOffRefreshRequired();
+    if (!showBus[i]) continue;
+    b->captureFrame(); // pipelined output: next frame is composited into _data while this copy is sent
+    b->clearChanged();
+  }
+}
+
+// sends the busses picked by prepareFrame(), runs on the output task with pipelined output
+void BusManager::showBusses() {
+  #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+  bool queued = false;
+  #endif
+  for (uint8_t i = 0; i < numBusses; i++) {
+    if (!showBus[i]) continue;
+    Bus *b = busses[i];
+    #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+    if (netTask && IS_VIRTUAL(b->getType()) && static_cast<BusNetwork*>(b)->queueFrame()) {
+      queued = true;
+      continue;
+    }
+    #endif
+    b->show();
+  }
+  #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+  if (queued) {
+    netHold = false;
+    xTaskNotifyGive(netTask);
+  }
+  #endif
+}
+
+#ifdef WLED_ENABLE_NET_OUTPUT_TASK
+// sends the latest queued frame of each network bus, frames queued meanwhile replace older ones;
+// destinations are interleaved packet by packet and the task blocks until the next packet is due
+void BusManager::netOutputLoop(void *arg) {
+  BusManager *bm = static_cast<BusManager*>(arg);
+  const int32_t tickUs = portTICK_PERIOD_MS * 1000;
+  TickType_t timeout = portMAX_DELAY;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, timeout);
+    timeout = portMAX_DELAY;
+    bm->netActive = true;
+    int32_t next = 0;
+    while (next <= 0 && !bm->netHold) { // one packet per due destination and pass
+      next = INT32_MAX;
+      for (uint8_t i = 0; i < bm->numBusses; i++) {
+        Bus *b = bm->busses[i];
+        if (!IS_VIRTUAL(b->getType())) continue;
+        int32_t wait = static_cast<BusNetwork*>(b)->sendPacket(micros());
+        if (wait >= 0 && wait < next) next = wait;
+      }
+    }
+    if (next > 0 && next < INT32_MAX) timeout = (next + tickUs - 1) / tickUs; // at least one tick, never spins
+    bm->netActive = false;
+  }
+}
+#endif
+
+void BusManager::show() {
+  #ifdef WLED_ENABLE_PIPELINE
+  // hand copies of the frame over to the output task on the other core, the caller composites the next frame meanwhile
+  if (!serialOutput && outputTask == nullptr && xTaskCreatePinnedToCore(outputLoop, "busOutput", 4096, this, 1, &outputTask, 1 - xPortGetCoreID()) != pdPASS) {
+    outputTask = nullptr;
+    serialOutput = true; // out of memory, send from the main loop until the busses are re-created
+  }
+  if (!serialOutput && outputTask != nullptr) {
+    waitForOutput(); // copies of the previous frame are still being sent
+    prepareFrame();
+    output.publish();
+    xTaskNotifyGive(outputTask);
+    return;
+  }
+  #endif
+  prepareFrame();
+  showBusses();
+}
+
+#ifdef WLED_ENABLE_PIPELINE
+void BusManager::outputLoop(void *arg) {
+  BusManager *bm = static_cast<BusManager*>(arg);
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    if (!bm->output.pending()) continue;
+    bm->showBusses();
+    bm->output.done();
+  }
+}
+#endif
+
 void BusManager::setStatusPixel(uint32_t c) {
+  waitForOutput();
   for (uint8_t i = 0; i < numBusses; i++) {
     busses[i]->setStatusPixel(c);
   }
 }
 
 void IRAM_ATTR BusManager::setPixelColor(uint16_t pix, uint32_t c) {
-  for (uint8_t i = 0; i < numBusses; i++) {
-    Bus* b = busses[i];
-    uint16_t bstart = b->getStart();
-    if (pix < bstart || pix >= bstart + b->getLength()) continue;
-    busses[i]->setPixelColor(pix - bstart, c);
+  if (overlapping) {
+    for (uint8_t i = 0; i < numBusses; i++) {
+      Bus* b = busses[i];
+      uint16_t bstart = b->getStart();
+      if (pix < bstart || pix >= bstart + b->getLength()) continue;
+      busses[i]->setPixelColor(pix - bstart, c);
+    }
+    return;
   }
+  int r = findRun(pix);
+  if (r < 0) return;
+  busses[runBus[r]]->setPixelColor(pix - runStart[r], c);
 }
 
-void BusManager::setBrightness(uint8_t b) {
-  for (uint8_t i = 0; i < numBusses; i++) {
-    busses[i]->setBrightness(b);
+void IRAM_ATTR BusManager::setPixelColors(uint16_t pix, const uint32_t *c, uint16_t count) {
+  if (overlapping) { // every bus gets its part of the span
+    for (uint8_t i = 0; i < numBusses; i++) {
+      Bus* b = busses[i];
+      uint16_t bstart = b->getStart(), bend = bstart + b->getLength();
+      uint16_t first = pix > bstart ? pix : bstart;
+      uint16_t last  = pix + count < bend ? pix + count : bend;
+      if (first < last) b->setPixelColors(first - bstart, c + (first - pix), last - first);
+    }
+    return;
+  }
+  while (count) {
+    int r = findRun(pix);
+    uint16_t n;
+    if (r < 0) { // skip gap between busses
+      uint8_t next = 0;
+      while (next < numRuns && runStart[next] <= pix) next++;
+      if (next >= numRuns) return;
+      n = runStart[next] - pix;
+      if (n > count) n = count;
+    } else {
+      Bus* b = busses[runBus[r]];
+      uint16_t i = pix - runStart[r];
+      n = runEnd[r] - pix;
+      if (n > count) n = count;
+      b->setPixelColors(i, c, n);
+    }
+    pix += n;
+    c += n;
+    count -= n;
   }
 }
 
+void BusManager::setBrightness(uint8_t b) {
+  for (uint8_t i = 0; i < numBusses; i++) setBusBrightness(i, b);
+}
+
+void BusManager::setBusBrightness(uint8_t busNr, uint8_t b) {
+  if (busNr >= numBusses) return;
+  #ifdef LED_BUILTIN
+  if (b && !busses[busNr]->getBrightness()) waitForOutput(); // BusDigital re-inits a bus on the onboard LED pin when turned on
+  #endif
+  busses[busNr]->setBrightness(b);
+}
+
 void BusManager::setSegmentCCT(int16_t cct, bool allowWBCorrection) {
   if (cct > 255) cct = 255;
   if (cct >= 0) {
@@ -603,16 +1020,24 @@ void BusManager::setSegmentCCT(int16_t cct, bool allowWBCorrection) {
 }
 
 uint32_t BusManager::getPixelColor(uint16_t pix) {
-  for (uint8_t i = 0; i < numBusses; i++) {
-    Bus* b = busses[i];
-    uint16_t bstart = b->getStart();
-    if (pix < bstart || pix >= bstart + b->getLength()) continue;
-    return b->getPixelColor(pix - bstart);
+  if (overlapping) {
+    for (uint8_t i = 0; i < numBusses; i++) {
+      Bus* b = busses[i];
+      uint16_t bstart = b->getStart();
+      if (pix < bstart || pix >= bstart + b->getLength()) continue;
+      return b->getPixelColor(pix - bstart);
+    }
+    return 0;
   }
-  return 0;
+  int r = findRun(pix);
+  if (r < 0) return 0;
+  return busses[runBus[r]]->getPixelColor(pix - runStart[r]);
 }
 
 bool BusManager::canAllShow() {
+  #ifdef WLED_ENABLE_PIPELINE
+  if (output.pending()) return false;
+  #endif
   for (uint8_t i = 0; i < numBusses; i++) {
     if (!busses[i]->canShow()) return false;
   }
@@ -633,5 +1058,7 @@ uint16_t BusManager::getTotalLength() {
 
 // Bus static member definition
 int16_t Bus::_cct = -1;
+uint8_t Bus::_cctRGB[4] = {255, 255, 255, 0};
+bool    Bus::_ws2815Power = false;
 uint8_t Bus::_cctBlend = 0;
 uint8_t Bus::_gAWM = 255;
@@ -6,6 +6,13 @@
  */
 
 #include "const.h"
+#include "delta_stream.h"
+#ifdef WLED_ENABLE_NET_OUTPUT_TASK
+#include <atomic>
+#endif
+#ifdef WLED_ENABLE_PIPELINE
+#include "frame_pipeline.h"
+#endif
 
 #define GET_BIT(var,bit)    (((var)>>(bit))&0x01)
 #define SET_BIT(var,bit)    ((var)|=(uint16_t)(0x0001<<(bit)))
@@ -22,6 +29,37 @@
 extern bool useGlobalLedBuffer;
 
 
+// network bus output options (E1.31 & Art-Net), only configurable in cfg.json
+struct NetOutputConfig {
+  uint16_t universe = 1;      // first universe (Art-Net: 15 bit Port-Address, Net:SubNet:Universe)
+  uint16_t channel = 0;       // channel offset of first pixel within first universe
+  uint16_t syncUniverse = 0;  // E1.31 universe synchronization address, 0 = no sync packets
+  uint8_t  priority = 100;    // E1.31 source priority (0-200)
+  bool     multicast = false; // E1.31 multicast (Art-Net: directed broadcast) instead of unicast
+};
+
+// per bus protocol state used by realtimeBroadcast()
+struct NetOutput : NetOutputConfig {
+  uint8_t *packet = nullptr;  // packet buffer (realtimePacketSize() bytes) holding the prebuilt header
+  uint8_t  sequence = 0;      // data sequence number, every universe advances once per frame
+  uint8_t  syncSequence = 0;  // sequence number of E1.31 sync packets
+  uint8_t *last = nullptr;    // WLED delta stream: channels of the previous frame, deltas are encoded against it
+  uint8_t  keyframe = 0;      // WLED delta stream: frames until the next keyframe
+  // progress of the frame being sent (see realtimeBeginFrame() and realtimeSendPacket())
+  bool     pending = false;   // frame has packets left
+  size_t   offset = 0;        // first buffer channel not sent yet
+  uint16_t target = 0;        // universe (Port-Address) of the next data packet
+  DeltaEncoder delta;         // WLED delta stream encoder
+  bool     fromTask = false;  // sent by the network output task, which uses its own socket
+};
+
+// frame counters of a network bus
+struct NetOutputStats {
+  uint32_t sent = 0;          // frames sent successfully
+  uint32_t dropped = 0;       // frames replaced by a newer one before they could be sent
+  uint32_t late = 0;          // frames sent more than WLED_NET_LATE_MS after they were queued
+};
+
 //temporary struct for passing bus configuration to bus
 struct BusConfig {
   uint8_t type;
@@ -35,8 +73,10 @@ struct BusConfig {
   uint8_t pins[5] = {LEDPIN, 255, 255, 255, 255};
   uint16_t frequency;
   bool doubleBuffer;
+  uint16_t milliAmpsMax;
+  NetOutputConfig net;
 
-  BusConfig(uint8_t busType, uint8_t* ppins, uint16_t pstart, uint16_t len = 1, uint8_t pcolorOrder = COL_ORDER_GRB, bool rev = false, uint8_t skip = 0, byte aw=RGBW_MODE_MANUAL_ONLY, uint16_t clock_kHz=0U, bool dblBfr=false)
+  BusConfig(uint8_t busType, uint8_t* ppins, uint16_t pstart, uint16_t len = 1, uint8_t pcolorOrder = COL_ORDER_GRB, bool rev = false, uint8_t skip = 0, byte aw=RGBW_MODE_MANUAL_ONLY, uint16_t clock_kHz=0U, bool dblBfr=false, uint16_t maxPwr=0)
   : count(len)
   , start(pstart)
   , colorOrder(pcolorOrder)
@@ -45,9 +85,11 @@ struct BusConfig {
   , autoWhite(aw)
   , frequency(clock_kHz)
   , doubleBuffer(dblBfr)
+  , milliAmpsMax(maxPwr)
   {
     refreshReq = (bool) GET_BIT(busType,7);
     type = busType & 0x7F;  // bit 7 may be/is hacked to include refresh info (1=refresh in off state, 0=no refresh)
+    if (type == TYPE_NET_ARTNET_RGB) net.universe = 0; // Art-Net Port-Addresses start at 0, E1.31 universes at 1
     size_t nPins = 1;
     if (type >= TYPE_NET_DDP_RGB && type < 96) nPins = 4; //virtual network bus. 4 "pins" store IP address
     else if (type > 47) nPins = 2;
@@ -104,7 +146,7 @@ struct ColorOrderMap {
 //parent class of BusDigital, BusPwm, and BusNetwork
 class Bus {
   public:
-    Bus(uint8_t type, uint16_t start, uint8_t aw, uint16_t len = 1, bool reversed = false, bool refresh = false)
+    Bus(uint8_t type, uint16_t start, uint8_t aw, uint16_t len = 1, bool reversed = false, bool refresh = false, uint16_t maxPwr = 0)
     : _type(type)
     , _bri(255)
     , _start(start)
@@ -112,19 +154,28 @@ class Bus {
     , _reversed(reversed)
     , _valid(false)
     , _needsRefresh(refresh)
+    , _changed(true)
+    , _milliAmpsMax(maxPwr)
+    , _milliAmps(0)
     , _data(nullptr) // keep data access consistent across all types of buses
+    , _sendData(nullptr)
+    , _sendLen(0)
+    , _sendBri(255)
     {
       _autoWhiteMode = Bus::hasWhite(_type) ? aw : RGBW_MODE_MANUAL_ONLY;
     };
 
-    virtual ~Bus() {} //throw the bus under the bus
+    virtual ~Bus() { freeSendData(); } //throw the bus under the bus
 
     virtual void     show() = 0;
     virtual bool     canShow()                   { return true; }
     virtual void     setStatusPixel(uint32_t c)  {}
     virtual void     setPixelColor(uint16_t pix, uint32_t c) = 0;
+    virtual void     setPixelColors(uint16_t pix, const uint32_t *c, uint16_t count) { // contiguous pixels within the bus
+      for (uint16_t i = 0; i < count; i++) setPixelColor(pix + i, c[i]);
+    }
     virtual uint32_t getPixelColor(uint16_t pix) { return 0; }
-    virtual void     setBrightness(uint8_t b)    { _bri = b; };
+    virtual void     setBrightness(uint8_t b)    { if (_bri != b) _changed = true; _bri = b; };
     virtual void     cleanup() = 0;
     virtual uint8_t  getPins(uint8_t* pinArray)  { return 0; }
     virtual uint16_t getLength()                 { return _len; }
@@ -132,6 +183,13 @@ class Bus {
     virtual uint8_t  getColorOrder()             { return COL_ORDER_RGB; }
     virtual uint8_t  skippedLeds()               { return 0; }
     virtual uint16_t getFrequency()              { return 0U; }
+    virtual void     compileOutput()             {} // rebuild precomputed output data after configuration change
+    virtual uint32_t getPowerSum()               { return 0; } // sum of channel values for current estimation
+    virtual const NetOutputConfig *getNetConfig() { return nullptr; } // network busses only
+    virtual const NetOutputStats  *getNetStats()  { return nullptr; }
+    inline  uint16_t getMaxCurrent()             { return _milliAmpsMax; } // 0 if bus has no own power supply budget
+    inline  void     setCurrent(uint16_t mA)     { _milliAmps = mA; }
+    inline  uint16_t getCurrent()                { return _milliAmps; }  // estimated current set by the limiter
     inline  void     setReversed(bool reversed)  { _reversed = reversed; }
     inline  uint16_t getStart()                  { return _start; }
     inline  void     setStart(uint16_t start)    { _start = start; }
@@ -139,6 +197,11 @@ class Bus {
     inline  bool     isOk()                      { return _valid; }
     inline  bool     isReversed()                { return _reversed; }
     inline  bool     isOffRefreshRequired()      { return _needsRefresh; }
+    inline  bool     isChanged()                 { return _changed; } // pixels or brightness changed since last show()
+    inline  void     clearChanged()              { _changed = false; }
+    inline  uint8_t  getBrightness()             { return _bri; }
+    inline  bool     hasFrame()                  { return _sendData != nullptr; } // show() sends a copy taken by captureFrame()
+    inline  void     captureFrame()              { if (_sendData) { memcpy(_sendData, _data, _sendLen); _sendBri = _bri; } }
             bool     containsPixel(uint16_t pix) { return pix >= _start && pix < _start+_len; }
 
     virtual bool hasRGB(void) { return Bus::hasRGB(_type); }
@@ -150,7 +213,7 @@ class Bus {
     static  bool hasWhite(uint8_t type) {
       if ((type >= TYPE_WS2812_1CH && type <= TYPE_WS2812_WWA) || type == TYPE_SK6812_RGBW || type == TYPE_TM1814) return true; // digital types with white channel
       if (type > TYPE_ONOFF && type <= TYPE_ANALOG_5CH && type != TYPE_ANALOG_3CH) return true; // analog types with white channel
-      if (type == TYPE_NET_DDP_RGBW) return true; // network types with white channel
+      if (type == TYPE_NET_DDP_RGBW || type == TYPE_NET_WLED_RGBW) return true; // network types with white channel
       return false;
     }
     virtual bool hasCCT(void) { return Bus::hasCCT(_type); }
@@ -159,9 +222,7 @@ class Bus {
           type == TYPE_ANALOG_2CH    || type == TYPE_ANALOG_5CH) return true;
       return false;
     }
-    static void setCCT(uint16_t cct) {
-      _cct = cct;
-    }
+    static void setCCT(uint16_t cct);
     static void setCCTBlend(uint8_t b) {
       if (b > 100) b = 100;
       _cctBlend = (b * 127) / 100;
@@ -174,6 +235,7 @@ class Bus {
     inline        uint8_t getAutoWhiteMode()          { return _autoWhiteMode; }
     inline static void    setGlobalAWMode(uint8_t m)  { if (m < 5) _gAWM = m; else _gAWM = AW_GLOBAL_DISABLED; }
     inline static uint8_t getGlobalAWMode()           { return _gAWM; }
+    inline static void    setWS2815PowerModel(bool b) { _ws2815Power = b; }
 
   protected:
     uint8_t  _type;
@@ -183,15 +245,29 @@ class Bus {
     bool     _reversed;
     bool     _valid;
     bool     _needsRefresh;
+    bool     _changed;
     uint8_t  _autoWhiteMode;
+    uint16_t _milliAmpsMax;
+    uint16_t _milliAmps;
     uint8_t  *_data;
+    uint8_t  *_sendData; // pipelined output: copy of _data (and _bri) sent by show() on the output task, nullptr if show() reads _data
+    size_t    _sendLen;
+    uint8_t   _sendBri;
     static uint8_t _gAWM;
     static int16_t _cct;
     static uint8_t _cctBlend;
+    static uint8_t _cctRGB[4]; // white balance correction for _cct, recalculated only when _cct changes
+    static bool    _ws2815Power; // power estimation ignores white and uses brightest RGB channel
 
     uint32_t autoWhiteCalc(uint32_t c);
+    static uint32_t colorBalance(uint32_t c); // color correction from CCT
+    static uint32_t pixelPower(uint32_t c);   // power estimation units of a single pixel
     uint8_t *allocData(size_t size = 1);
     void     freeData() { if (_data != nullptr) free(_data); _data = nullptr; }
+    void     allocSendData(size_t size); // no-op unless WLED_ENABLE_PIPELINE
+    void     freeSendData() { if (_sendData != nullptr) free(_sendData); _sendData = nullptr; }
+    inline uint8_t *frameData() { return _sendData ? _sendData : _data; } // pixels and brightness to be sent by show()
+    inline uint8_t  frameBri()  { return _sendData ? _sendBri : _bri; }
 };
 
 
@@ -205,12 +281,15 @@ class BusDigital : public Bus {
     void setBrightness(uint8_t b);
     void setStatusPixel(uint32_t c);
     void setPixelColor(uint16_t pix, uint32_t c);
+    void setPixelColors(uint16_t pix, const uint32_t *c, uint16_t count);
     void setColorOrder(uint8_t colorOrder);
     uint32_t getPixelColor(uint16_t pix);
     uint8_t  getColorOrder() { return _colorOrder; }
     uint8_t  getPins(uint8_t* pinArray);
     uint8_t  skippedLeds()   { return _skip; }
     uint16_t getFrequency()  { return _frequencykHz; }
+    uint32_t getPowerSum();
+    void compileOutput();
     void reinit();
     void cleanup();
 
@@ -223,6 +302,50 @@ class BusDigital : public Bus {
     void * _busPtr;
     const ColorOrderMap &_colorOrderMap;
     bool _buffering; // temporary until we figure out why comparison "_data != nullptr" causes severe FPS drop
+    uint32_t _powerSum;  // sum of pixelPower() over buffer, updated in setPixelColor()
+    bool _powerModel;    // _ws2815Power used for _powerSum
+
+    // brightness table of buffered busses (allocated behind _data), rebuilt by show() when brightness changed
+    // white balance depends on the CCT of the segment being drawn and stays in setPixelColor()
+    uint8_t *_briLUT;
+    uint8_t  _lutBri;
+
+    // color order runs over bus pixels (resolved from _colorOrder and color order map by compileOutput())
+    uint16_t _coRunEnd[2*WLED_MAX_COLOR_ORDER_MAPPINGS+1]; // first pixel after run
+    uint8_t  _coRun[2*WLED_MAX_COLOR_ORDER_MAPPINGS+1];
+    uint8_t  _numCoRuns;
+    uint8_t  _lastCoRun;
+
+    inline uint8_t colorOrderAt(uint16_t pix) {
+      if (_numCoRuns < 2) return _colorOrder;
+      uint8_t r = _lastCoRun;
+      if (pix >= _coRunEnd[r] || (r > 0 && pix < _coRunEnd[r-1])) {
+        for (r = 0; r < _numCoRuns-1 && pix >= _coRunEnd[r]; r++);
+        _lastCoRun = r;
+      }
+      return _coRun[r];
+    }
+
+    // stores c into the double buffer at d, keeps _powerSum up to date
+    inline void storePixel(uint8_t *d, uint32_t c, bool rgb, bool white) {
+      uint32_t cOld; // same representation as getPixelColor()
+      if (rgb) {
+        cOld = uint32_t(d[0]) << 16 | uint32_t(d[1]) << 8 | d[2] | (white ? uint32_t(d[3]) << 24 : 0);
+        if (!white) c &= 0x00FFFFFF;
+      } else {
+        cOld = d[0] * 0x01010101UL;
+        c = (c >> 24) * 0x01010101UL;
+      }
+      if (c == cOld) return;
+      _changed = true;
+      _powerSum += pixelPower(c) - pixelPower(cOld); // keeps current estimation incremental
+      if (rgb) {
+        d[0] = c >> 16;
+        d[1] = c >> 8;
+        d[2] = c;
+        if (white) d[3] = c >> 24;
+      } else d[0] = c;
+    }
 
     inline uint32_t restoreColorLossy(uint32_t c, uint8_t restoreBri) {
       if (restoreBri < 255) {
@@ -287,10 +410,17 @@ class BusNetwork : public Bus {
     bool hasWhite() { return _rgbw; }
     bool canShow()  { return !_broadcastLock; } // this should be a return value from UDP routine if it is still sending data out
     void setPixelColor(uint16_t pix, uint32_t c);
+    void setPixelColors(uint16_t pix, const uint32_t *c, uint16_t count);
     uint32_t getPixelColor(uint16_t pix);
     uint8_t  getPins(uint8_t* pinArray);
+    const NetOutputConfig *getNetConfig() { return &_out; }
+    const NetOutputStats  *getNetStats()  { return &_stats; }
     void show();
     void cleanup();
+    #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+    bool    queueFrame();           // main loop: hand the current pixels over to the output task, false if not possible
+    int32_t sendPacket(uint32_t now); // output task: send next packet if due, returns us until the next one (-1 idle)
+    #endif
 
   private:
     IPAddress _client;
@@ -298,12 +428,30 @@ class BusNetwork : public Bus {
     uint8_t   _UDPchannels;
     bool      _rgbw;
     bool      _broadcastLock;
+    NetOutput _out;            // output options, preallocated packet buffer and sequence numbers
+    NetOutputStats _stats;
+    #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+    // latest-wins triple buffer: the main loop fills one frame while the task sends another,
+    // the third one waits; a waiting frame that was not taken yet is replaced (dropped)
+    struct NetFrame {
+      uint8_t      *data = nullptr;
+      uint8_t       bri = 0;
+      unsigned long queued = 0;  // millis() when the frame was handed over
+    };
+    NetFrame _frame[3];
+    uint8_t  _fillFrame = 0;     // owned by the main loop
+    uint8_t  _sendFrame = 1;     // owned by the output task
+    std::atomic<uint8_t> _waitingFrame{2}; // index of waiting frame, NET_FRAME_NEW while the task has not taken it
+    uint32_t _nextPacket = 0;    // micros() when the next packet to this destination may be sent
+
+    void freeFrames();
+    #endif
 };
 
 
 class BusManager {
   public:
-    BusManager() : numBusses(0) {};
+    BusManager() : numBusses(0), numRuns(0), lastRun(0), overlapping(false), keepAlive(WLED_BUS_KEEPALIVE), lastKeepAlive(0) {};
 
     //utility to get the approx. memory usage of a given BusConfig
     static uint32_t memUsage(BusConfig &bc);
@@ -317,7 +465,9 @@ class BusManager {
     bool canAllShow();
     void setStatusPixel(uint32_t c);
     void setPixelColor(uint16_t pix, uint32_t c);
+    void setPixelColors(uint16_t pix, const uint32_t *c, uint16_t count); // contiguous pixels, bus is resolved once per run
     void setBrightness(uint8_t b);
+    void setBusBrightness(uint8_t busNr, uint8_t b); // single bus, e.g. from the current limiter
     void setSegmentCCT(int16_t cct, bool allowWBCorrection = false);
     uint32_t getPixelColor(uint16_t pix);
 
@@ -327,17 +477,61 @@ class BusManager {
     uint16_t getTotalLength();
     inline uint8_t getNumBusses() const { return numBusses; }
 
-    inline void                 updateColorOrderMap(const ColorOrderMap &com) { memcpy(&colorOrderMap, &com, sizeof(ColorOrderMap)); }
+    inline void                 updateColorOrderMap(const ColorOrderMap &com) {
+      waitForOutput();
+      memcpy(&colorOrderMap, &com, sizeof(ColorOrderMap));
+      for (uint8_t i = 0; i < numBusses; i++) busses[i]->compileOutput();
+    }
     inline const ColorOrderMap& getColorOrderMap() const { return colorOrderMap; }
 
+    // output state (NeoPixelBus, color order runs) must not be modified while the output task is sending a frame
+    #ifdef WLED_ENABLE_PIPELINE
+    inline void waitForOutput() const { while (output.pending()) yield(); }
+    #else
+    inline void waitForOutput() const {}
+    #endif
+
+    inline void     setKeepAlive(uint16_t ms) { keepAlive = ms; }
+    inline uint16_t getKeepAlive() const      { return keepAlive; }
+
   private:
     uint8_t numBusses;
     Bus* busses[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
     ColorOrderMap colorOrderMap;
 
+    // pixel to bus lookup, busses sorted by start (rebuilt in add() and removeAll())
+    uint16_t runStart[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
+    uint16_t runEnd[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];  // first pixel after bus
+    uint8_t  runBus[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
+    uint8_t  numRuns;
+    uint8_t  lastRun;      // run of previous lookup (consecutive pixels usually hit the same bus)
+    bool     overlapping;  // busses share pixels, all matching busses must be written
+
+    uint16_t keepAlive;    // max. time (ms) an unchanged bus is not sent, 0 = send every frame
+    unsigned long lastKeepAlive;
+
+    bool showBus[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES]; // picked by prepareFrame()
+    void prepareFrame();
+    void showBusses();
+    #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+    TaskHandle_t      netTask = nullptr;
+    std::atomic<bool> netHold{true};    // set while busses are removed or added, task must not touch them
+    std::atomic<bool> netActive{false}; // task is iterating busses
+    static void       netOutputLoop(void *arg);
+    #endif
+    #ifdef WLED_ENABLE_PIPELINE
+    TaskHandle_t  outputTask = nullptr;
+    FramePipeline output;
+    bool          serialOutput = false; // a bus cannot keep a frame copy, show() sends synchronously
+    static void   outputLoop(void *arg);
+    #endif
+
+    void buildPixelLookup();
+    int  findRun(uint16_t pix);
+
     inline uint8_t getNumVirtualBusses() {
       int j = 0;
-      for (int i=0; i<numBusses; i++) if (busses[i]->getType() >= TYPE_NET_DDP_RGB && busses[i]->getType() < 96) j++;
+      for (int i=0; i<numBusses; i++) if (IS_VIRTUAL(busses[i]->getType())) j++;
       return j;
     }
 };
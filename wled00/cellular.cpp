@@ -0,0 +1,71 @@
+/*
+ * Bit packed cellular automata core, see cellular.h
+ */
+
+#include "cellular.h"
+
+// fills w & e with west and east neighbour of each cell in a row (wrapping around)
+void caNeighbourRows(const uint32_t *row, uint16_t cols, uint32_t *w, uint32_t *e) {
+  const uint16_t n = caWords(cols);
+  for (size_t i = 0; i < n; i++) {
+    w[i] = (row[i] << 1) | (i     ? row[i-1] >> 31 : 0);
+    e[i] = (row[i] >> 1) | (i+1<n ? row[i+1] << 31 : 0);
+  }
+  w[0]   |= caGet(row, cols-1);                  // west of first cell is last cell
+  e[n-1] |= uint32_t(row[0] & 1) << ((cols-1) & 31); // east of last cell is first cell
+  if (cols & 31) w[n-1] &= (1UL << (cols & 31)) - 1; // clear bits beyond last cell
+}
+
+/*
+ * Computes next generation of a life-like 2D automaton on a torus.
+ * Bit k of birth/survive mask means a cell is born/survives with k live neighbours (B3/S23 is Game of Life).
+ * Neighbours are counted for 32 cells at once using bit sliced adders.
+ */
+void caStepLife(const uint32_t *cur, uint32_t *next, uint16_t cols, uint16_t rows, uint16_t birth, uint16_t survive) {
+  const uint16_t n = caWords(cols);
+  const uint32_t lastMask = (cols & 31) ? (1UL << (cols & 31)) - 1 : 0xFFFFFFFFUL;
+  uint32_t wA[n], eA[n], wC[n], eC[n], wB[n], eB[n];
+  for (size_t y = 0; y < rows; y++) {
+    const uint32_t *rowA = cur + ((y + rows - 1) % rows) * n; // row above
+    const uint32_t *rowC = cur + y * n;
+    const uint32_t *rowB = cur + ((y + 1) % rows) * n;        // row below
+    caNeighbourRows(rowA, cols, wA, eA);
+    caNeighbourRows(rowC, cols, wC, eC);
+    caNeighbourRows(rowB, cols, wB, eB);
+    for (size_t i = 0; i < n; i++) {
+      const uint32_t in[8] = { wA[i], rowA[i], eA[i], wC[i], eC[i], wB[i], rowB[i], eB[i] };
+      uint32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0; // 4 bit neighbour count per cell
+      for (size_t k = 0; k < 8; k++) {
+        uint32_t c0 = s0 & in[k]; s0 ^= in[k];
+        uint32_t c1 = s1 & c0;    s1 ^= c0;
+        uint32_t c2 = s2 & c1;    s2 ^= c1;
+        s3 |= c2;
+      }
+      const uint32_t alive = rowC[i];
+      uint32_t res = 0;
+      for (size_t k = 0; k <= 8; k++) {
+        if (!((birth | survive) & (1 << k))) continue;
+        uint32_t eq = ((k&1) ? s0 : ~s0) & ((k&2) ? s1 : ~s1) & ((k&4) ? s2 : ~s2) & ((k&8) ? s3 : ~s3);
+        if (birth   & (1 << k)) res |= eq & ~alive;
+        if (survive & (1 << k)) res |= eq &  alive;
+      }
+      next[y * n + i] = (i+1 < n) ? res : res & lastMask;
+    }
+  }
+}
+
+// computes next generation of an elementary (Wolfram) 1D automaton, wrapping around
+void caStepElementary(const uint32_t *cur, uint32_t *next, uint16_t cols, uint8_t rule) {
+  const uint16_t n = caWords(cols);
+  const uint32_t lastMask = (cols & 31) ? (1UL << (cols & 31)) - 1 : 0xFFFFFFFFUL;
+  uint32_t w[n], e[n];
+  caNeighbourRows(cur, cols, w, e);
+  for (size_t i = 0; i < n; i++) {
+    uint32_t res = 0;
+    for (size_t p = 0; p < 8; p++) { // pattern p = left,center,right
+      if (!(rule & (1 << p))) continue;
+      res |= ((p&4) ? w[i] : ~w[i]) & ((p&2) ? cur[i] : ~cur[i]) & ((p&1) ? e[i] : ~e[i]);
+    }
+    next[i] = (i+1 < n) ? res : res & lastMask;
+  }
+}
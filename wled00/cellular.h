@@ -0,0 +1,21 @@
+#ifndef WLED_CELLULAR_H
+#define WLED_CELLULAR_H
+/*
+ * Bit packed cellular automata core (used by Game of Life and 1D elementary automata effects).
+ * Cell states are stored as bit planes (32 cells per word, each row starts on a word boundary,
+ * unused bits of last word in a row are kept 0), colors live in the segment pixels.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+inline uint16_t caWords(uint16_t cols) { return (cols + 31) >> 5; }
+inline bool caGet(const uint32_t *row, uint16_t x) { return (row[x >> 5] >> (x & 31)) & 1; }
+inline void caSet(uint32_t *row, uint16_t x) { row[x >> 5] |= 1UL << (x & 31); }
+inline void caClear(uint32_t *row, uint16_t x) { row[x >> 5] &= ~(1UL << (x & 31)); }
+
+void caNeighbourRows(const uint32_t *row, uint16_t cols, uint32_t *w, uint32_t *e);
+void caStepLife(const uint32_t *cur, uint32_t *next, uint16_t cols, uint16_t rows, uint16_t birth, uint16_t survive);
+void caStepElementary(const uint32_t *cur, uint32_t *next, uint16_t cols, uint8_t rule);
+
+#endif
@@ -13,6 +13,15 @@ void getStringFromJson(char* dest, const char* src, size_t len) {
   if (src != nullptr) strlcpy(dest, src, len);
 }
 
+// E1.31 & Art-Net output options of a network bus ("ins" element), missing keys keep bus type defaults
+static void deserializeNetOutput(JsonObject elm, NetOutputConfig &net) {
+  CJSON(net.universe,     elm[F("uni")]);
+  CJSON(net.channel,      elm[F("chn")]);
+  CJSON(net.syncUniverse, elm[F("sync")]);
+  CJSON(net.priority,     elm[F("prio")]);
+  CJSON(net.multicast,    elm[F("mc")]);
+}
+
 bool deserializeConfig(JsonObject doc, bool fromFS) {
   bool needsSave = false;
   //int rev_major = doc["rev"][0]; // 1
@@ -91,6 +100,7 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   Bus::setCCTBlend(strip.cctBlending);
   strip.setTargetFps(hw_led["fps"]); //NOP if 0, default 42 FPS
   CJSON(useGlobalLedBuffer, hw_led[F("ld")]);
+  busses.setKeepAlive(hw_led[F("ka")] | busses.getKeepAlive());
 
   #ifndef WLED_DISABLE_2D
   // 2D Matrix Settings
@@ -160,8 +170,10 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
       uint16_t freqkHz = elm[F("freq")] | 0;  // will be in kHz for DotStar and Hz for PWM (not yet implemented fully)
       ledType |= refresh << 7; // hack bit 7 to indicate strip requires off refresh
       uint8_t AWmode = elm[F("rgbwm")] | autoWhiteMode;
+      uint16_t maxPwr = elm[F("maxpwr")] | 0; // budget of bus' own power supply (mA), 0 = global limit only
       if (fromFS) {
-        BusConfig bc = BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz, useGlobalLedBuffer);
+        BusConfig bc = BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz, useGlobalLedBuffer, maxPwr);
+        deserializeNetOutput(elm, bc.net);
         mem += BusManager::memUsage(bc);
         if (useGlobalLedBuffer && start + length > maxlen) {
           maxlen = start + length;
@@ -170,7 +182,8 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
         if (mem + globalBufMem <= MAX_LED_MEMORY) if (busses.add(bc) == -1) break;  // finalization will be done in WLED::beginStrip()
       } else {
         if (busConfigs[s] != nullptr) delete busConfigs[s];
-        busConfigs[s] = new BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz, useGlobalLedBuffer);
+        busConfigs[s] = new BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz, useGlobalLedBuffer, maxPwr);
+        deserializeNetOutput(elm, busConfigs[s]->net);
         busesChanged = true;
       }
       s++;
@@ -354,6 +367,7 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
     gammaCorrectBri = false;
     gammaCorrectCol = false;
   }
+  Segment::invalidatePaletteCache(); // color palettes are gamma corrected
 
   JsonObject light_tr = light["tr"];
   CJSON(fadeTransition, light_tr["mode"]);
@@ -717,6 +731,7 @@ void serializeConfig() {
   hw_led["fps"] = strip.getTargetFps();
   hw_led[F("rgbwm")] = Bus::getGlobalAWMode(); // global auto white mode override
   hw_led[F("ld")] = useGlobalLedBuffer;
+  hw_led[F("ka")] = busses.getKeepAlive();
 
   #ifndef WLED_DISABLE_2D
   // 2D Matrix Settings
@@ -757,6 +772,14 @@ void serializeConfig() {
     ins["ref"] = bus->isOffRefreshRequired();
     ins[F("rgbwm")] = bus->getAutoWhiteMode();
     ins[F("freq")] = bus->getFrequency();
+    if (bus->getMaxCurrent()) ins[F("maxpwr")] = bus->getMaxCurrent();
+    if (const NetOutputConfig *net = bus->getNetConfig()) {
+      ins[F("uni")]  = net->universe;
+      ins[F("chn")]  = net->channel;
+      ins[F("sync")] = net->syncUniverse;
+      ins[F("prio")] = net->priority;
+      ins[F("mc")]   = net->multicast;
+    }
   }
 
   JsonArray hw_com = hw.createNestedArray(F("com"));
@@ -4,6 +4,43 @@
  * Color conversion & utility methods
  */
 
+/*
+ * SWAR helpers: channels are processed two at a time, R+B and W+G are masked
+ * into 16 bit lanes of a 32 bit word so that a single multiply scales both
+ */
+#define SWAR_RB 0x00FF00FFUL
+#define SWAR_WG 0xFF00FF00UL
+
+// scales all channels by (scale+1)/256, same result as FastLED nscale8()
+static inline uint32_t swarScale(uint32_t c, uint16_t scale) {
+  return ((((c & SWAR_RB) * scale) >> 8) & SWAR_RB) | ((((c >> 8) & SWAR_RB) * scale) & SWAR_WG);
+}
+
+// per channel saturating add, same result as FastLED qadd8()
+static inline uint32_t swarQadd(uint32_t c1, uint32_t c2) {
+  uint32_t rb = (c1 & SWAR_RB) + (c2 & SWAR_RB);
+  uint32_t wg = ((c1 >> 8) & SWAR_RB) + ((c2 >> 8) & SWAR_RB);
+  rb |= ((rb >> 8) & 0x00010001UL) * 0xFF; // saturate overflowing lanes
+  wg |= ((wg >> 8) & 0x00010001UL) * 0xFF;
+  return (rb & SWAR_RB) | ((wg & SWAR_RB) << 8);
+}
+
+// (c2*blend + c1*(255-blend)) >> 8 for all channels, same result as 8 bit color_blend()
+static inline uint32_t swarBlend(uint32_t c1, uint32_t c2, uint8_t blend) {
+  uint8_t inv = 255 - blend;
+  uint32_t rb = (((c2 & SWAR_RB) * blend + (c1 & SWAR_RB) * inv) >> 8) & SWAR_RB;
+  uint32_t wg = (((c2 >> 8) & SWAR_RB) * blend + ((c1 >> 8) & SWAR_RB) * inv) & SWAR_WG;
+  return rb | wg;
+}
+
+// (c1*(256-f) + c2*f) >> 8, exact at f = 0 (unlike swarBlend() which is slightly darker)
+static inline uint32_t swarLerp(uint32_t c1, uint32_t c2, uint8_t f) {
+  uint16_t inv = 256 - f;
+  uint32_t rb = (((c2 & SWAR_RB) * f + (c1 & SWAR_RB) * inv) >> 8) & SWAR_RB;
+  uint32_t wg = (((c2 >> 8) & SWAR_RB) * f + ((c1 >> 8) & SWAR_RB) * inv) & SWAR_WG;
+  return rb | wg;
+}
+
 /*
  * color blend function
  */
@@ -11,7 +48,8 @@ uint32_t color_blend(uint32_t color1, uint32_t color2, uint16_t blend, bool b16)
   if(blend == 0)   return color1;
   uint16_t blendmax = b16 ? 0xFFFF : 0xFF;
   if(blend == blendmax) return color2;
-  uint8_t shift = b16 ? 16 : 8;
+  if (!b16) return swarBlend(color1, color2, blend);
+  uint8_t shift = 16;
 
   uint32_t w1 = W(color1);
   uint32_t r1 = R(color1);
@@ -49,6 +87,120 @@ uint32_t color_add(uint32_t c1, uint32_t c2)
   else           return RGBW32(r * 255 / max, g * 255 / max, b * 255 / max, w * 255 / max);
 }
 
+/*
+ * Bulk color kernels operating on RGBW32 arrays (i.e. segment render buffers).
+ * See SWAR helpers at the top of this file.
+ */
+void scaleBuffer(uint32_t *buf, size_t n, uint8_t scale) {
+  if (scale == 255) return;
+  if (scale == 0) { memset(buf, 0, n * sizeof(uint32_t)); return; }
+  for (size_t i = 0; i < n; i++) if (buf[i]) buf[i] = swarScale(buf[i], scale + 1);
+}
+
+/*
+ * moves every pixel towards target color by 1/(rate+1.1) of the remaining difference (at least 1)
+ * integer equivalent of the float division formerly used by Segment::fade_out()
+ * rate: 0-127
+ */
+void fadeTowardColor(uint32_t *buf, size_t n, uint32_t target, uint8_t rate) {
+  // |d|*10/(10*rate+11) == (|d|*inv)>>24 for all |d| <= 255 (reciprocal error stays below 1/divisor)
+  const uint32_t div = 10 * uint32_t(rate) + 11;
+  const uint32_t inv = (10UL * (1UL << 24) + div - 1) / div;
+  for (size_t i = 0; i < n; i++) {
+    uint32_t c = buf[i];
+    if (c == target) continue;
+    uint32_t out = 0;
+    for (unsigned shift = 0; shift < 32; shift += 8) {
+      int c1 = (c >> shift) & 0xFF;
+      int c2 = (target >> shift) & 0xFF;
+      if (c2 > c1)      c1 += int(((c2 - c1) * inv) >> 24) + 1;
+      else if (c2 < c1) c1 -= int(((c1 - c2) * inv) >> 24) + 1;
+      out |= uint32_t(c1) << shift;
+    }
+    buf[i] = out;
+  }
+}
+
+/*
+ * FastLED style blur (spreads blur_amount/2 of each pixel to both neighbours) over n pixels
+ * that are stride elements apart, i.e. a row (stride 1) or a column (stride = width) of a buffer
+ */
+void blurBuffer(uint32_t *buf, size_t n, size_t stride, uint8_t blur_amount) {
+  if (blur_amount == 0 || n == 0) return;
+  const uint16_t keep = 256 - blur_amount;        // (255 - blur_amount) + 1
+  const uint16_t seep = (blur_amount >> 1) + 1;
+  uint32_t carryover = 0;
+  uint32_t *prev = nullptr;
+  for (size_t i = 0; i < n; i++, buf += stride) {
+    uint32_t cur  = *buf;
+    uint32_t part = swarScale(cur, seep);
+    if (prev) *prev = swarQadd(*prev, part);
+    *buf = swarQadd(swarScale(cur, keep), carryover);
+    carryover = part;
+    prev = buf;
+  }
+}
+
+// dst[i] = scale8(src[i], scale) for a byte stream (i.e. bus channel data), four channels per multiply
+void scaleChannels(uint8_t *dst, const uint8_t *src, size_t n, uint8_t scale) {
+  if (scale == 255) { memcpy(dst, src, n); return; }
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    uint32_t c;
+    memcpy(&c, src + i, 4); // unaligned
+    c = swarScale(c, scale + 1);
+    memcpy(dst + i, &c, 4);
+  }
+  for (; i < n; i++) dst[i] = (src[i] * (scale + 1)) >> 8;
+}
+
+// source position (1/256 pixel) of destination pixel i when stretching sn pixels to dn, pixel centres aligned
+static inline uint32_t upscalePos(uint16_t i, uint16_t sn, uint16_t dn) {
+  int32_t p = (int32_t)(((2*i + 1) * sn) << 7) / dn - 128;
+  if (p < 0) p = 0;
+  if (p > (sn - 1) << 8) p = (sn - 1) << 8;
+  return p;
+}
+
+// horizontally stretched source row
+static void upscaleRow(const uint32_t *row, uint16_t sw, uint32_t *out, uint16_t dw, const uint16_t *xi, const uint8_t *xf) {
+  for (size_t x = 0; x < dw; x++) {
+    uint16_t x1 = xi[x] + 1 < sw ? xi[x] + 1 : xi[x];
+    out[x] = swarLerp(row[xi[x]], row[x1], xf[x]);
+  }
+}
+
+/*
+ * bilinear upscale of a sw x sh buffer into a dw x dh buffer; each source row is stretched
+ * only once and then shared by all destination rows between it and the next one
+ * scratch must hold upscaleScratchSize(dw) bytes (two stretched rows and the column weights)
+ */
+void upscaleBuffer(const uint32_t *src, uint16_t sw, uint16_t sh, uint32_t *dst, uint16_t dw, uint16_t dh, void *scratch) {
+  if (sw == 0 || sh == 0 || dw == 0 || dh == 0) return;
+  uint32_t *top    = (uint32_t*)scratch;
+  uint32_t *bottom = top + dw;
+  uint16_t *xi     = (uint16_t*)(bottom + dw);
+  uint8_t  *xf     = (uint8_t*)(xi + dw);
+  for (size_t x = 0; x < dw; x++) {
+    uint32_t p = upscalePos(x, sw, dw);
+    xi[x] = p >> 8;
+    xf[x] = p & 0xFF;
+  }
+  int cached = -1;
+  for (size_t y = 0; y < dh; y++) {
+    uint32_t p  = upscalePos(y, sh, dh);
+    int      y0 = p >> 8;
+    uint8_t  fy = p & 0xFF;
+    if (y0 != cached) {
+      if (cached >= 0 && y0 == cached + 1) { uint32_t *t = top; top = bottom; bottom = t; }
+      else upscaleRow(src + y0 * sw, sw, top, dw, xi, xf);
+      upscaleRow(src + (y0 + 1 < sh ? y0 + 1 : y0) * sw, sw, bottom, dw, xi, xf);
+      cached = y0;
+    }
+    for (size_t x = 0; x < dw; x++) *dst++ = swarLerp(top[x], bottom[x], fy);
+  }
+}
+
 void setRandomColor(byte* rgb)
 {
   lastRandomIndex = strip.getMainSegment().get_random_wheel_index(lastRandomIndex);
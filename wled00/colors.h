@@ -0,0 +1,43 @@
+#ifndef WLED_COLORS_H
+#define WLED_COLORS_H
+/*
+ * Color conversion, gamma and bulk color buffer functions (colors.cpp)
+ * The buffer kernels cover what segments do to a whole render buffer (scale, fade, blur, upscale);
+ * blending and adding stay per pixel (color_blend(), color_add()) and gamma is applied to colors, not buffers.
+ */
+
+#include <Arduino.h>
+
+// similar to NeoPixelBus NeoGammaTableMethod but allows dynamic changes (superseded by NPB::NeoGammaDynamicTableMethod)
+class NeoGammaWLEDMethod {
+  public:
+    static uint8_t Correct(uint8_t value);      // apply Gamma to single channel
+    static uint32_t Correct32(uint32_t color);  // apply Gamma to RGBW32 color (WLED specific, not used by NPB)
+    static void calcGammaTable(float gamma);    // re-calculates & fills gamma table
+    static inline uint8_t rawGamma8(uint8_t val) { return gammaT[val]; }  // get value from Gamma table (WLED specific, not used by NPB)
+  private:
+    static uint8_t gammaT[];
+};
+#define gamma32(c) NeoGammaWLEDMethod::Correct32(c)
+#define gamma8(c)  NeoGammaWLEDMethod::rawGamma8(c)
+uint32_t color_blend(uint32_t,uint32_t,uint16_t,bool b16=false);
+uint32_t color_add(uint32_t,uint32_t);
+void scaleBuffer(uint32_t *buf, size_t n, uint8_t scale);
+void fadeTowardColor(uint32_t *buf, size_t n, uint32_t target, uint8_t rate);
+void blurBuffer(uint32_t *buf, size_t n, size_t stride, uint8_t blur_amount);
+void scaleChannels(uint8_t *dst, const uint8_t *src, size_t n, uint8_t scale);
+void upscaleBuffer(const uint32_t *src, uint16_t sw, uint16_t sh, uint32_t *dst, uint16_t dw, uint16_t dh, void *scratch);
+inline size_t upscaleScratchSize(uint16_t dw) { return dw * (2*sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t)); }
+inline uint32_t colorFromRgbw(byte* rgbw) { return uint32_t((byte(rgbw[3]) << 24) | (byte(rgbw[0]) << 16) | (byte(rgbw[1]) << 8) | (byte(rgbw[2]))); }
+void colorHStoRGB(uint16_t hue, byte sat, byte* rgb); //hue, sat to rgb
+void colorKtoRGB(uint16_t kelvin, byte* rgb);
+void colorCTtoRGB(uint16_t mired, byte* rgb); //white spectrum to rgb
+void colorXYtoRGB(float x, float y, byte* rgb); // only defined if huesync disabled TODO
+void colorRGBtoXY(byte* rgb, float* xy); // only defined if huesync disabled TODO
+void colorFromDecOrHexString(byte* rgb, char* in);
+bool colorFromHexString(byte* rgb, const char* in);
+uint32_t colorBalanceFromKelvin(uint16_t kelvin, uint32_t rgb);
+uint16_t approximateKelvinFromRGB(uint32_t rgb);
+void setRandomColor(byte* rgb);
+
+#endif
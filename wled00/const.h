@@ -74,6 +74,38 @@
   #endif
 #endif
 
+// network busses are sent from their own task, frames are queued per destination (ESP32 only)
+#if defined(WLED_ENABLE_NET_OUTPUT_TASK) && !defined(ARDUINO_ARCH_ESP32)
+  #undef WLED_ENABLE_NET_OUTPUT_TASK
+#endif
+#ifdef WLED_ENABLE_NET_OUTPUT_TASK
+  // sending no longer blocks the main loop, so many more remote nodes can be driven
+  #ifndef WLED_MAX_NET_BUSSES
+    #define WLED_MAX_NET_BUSSES 24
+  #endif
+  #undef  WLED_MIN_VIRTUAL_BUSSES
+  #define WLED_MIN_VIRTUAL_BUSSES WLED_MAX_NET_BUSSES
+  #ifndef WLED_NET_PACKET_GAP
+    #define WLED_NET_PACKET_GAP 400 // min. time between packets to the same destination (us, on average over one RTOS tick)
+  #endif
+  #ifndef WLED_NET_LATE_MS
+    #define WLED_NET_LATE_MS 25     // frames sent later than this after they were queued are counted as late
+  #endif
+#endif
+#if WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES > 36
+  #error Maximum number of buses (incl. virtual) is 36.
+#endif
+
+// pipelined output sends busses from a task on the second core
+#if defined(WLED_ENABLE_PIPELINE) && (!defined(ARDUINO_ARCH_ESP32) || defined(CONFIG_FREERTOS_UNICORE))
+  #undef WLED_ENABLE_PIPELINE
+#endif
+
+// busses with unchanged content are re-sent at least this often (ms), 0 sends every frame
+#ifndef WLED_BUS_KEEPALIVE
+  #define WLED_BUS_KEEPALIVE 1000
+#endif
+
 #ifdef ESP8266
 #define WLED_MAX_COLOR_ORDER_MAPPINGS 5
 #else
@@ -253,12 +285,15 @@
 #define TYPE_NET_DDP_RGB         80            //network DDP RGB bus (master broadcast bus)
 #define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus, unused)
 #define TYPE_NET_ARTNET_RGB      82            //network ArtNet RGB bus (master broadcast bus, unused)
+#define TYPE_NET_WLED_RGB        83            //network WLED delta stream RGB bus (master broadcast bus)
 #define TYPE_NET_DDP_RGBW        88            //network DDP RGBW bus (master broadcast bus)
+#define TYPE_NET_WLED_RGBW       89            //network WLED delta stream RGBW bus (master broadcast bus)
 
 #define IS_DIGITAL(t) ((t) & 0x10) //digital are 16-31 and 48-63
 #define IS_PWM(t)     ((t) > 40 && (t) < 46)
 #define NUM_PWM_PINS(t) ((t) - 40) //for analog PWM 41-45 only
 #define IS_2PIN(t)      ((t) > 47)
+#define IS_VIRTUAL(t)   ((t) >= TYPE_NET_DDP_RGB && (t) < 96) //network busses 80-95
 
 //Color orders
 #define COL_ORDER_GRB             0           //GRB(w),defaut
@@ -0,0 +1,109 @@
+#include "wled.h"
+#include "delta_stream.h"
+
+/*
+ * WLED delta stream encoder and decoder, packet format see delta_stream.h
+ * (network I/O lives in udp.cpp)
+ */
+
+static inline void putUint16(uint8_t *p, uint16_t v) { p[0] = v >> 8; p[1] = v; } // network byte order
+
+// starts a new frame, packet header fields that stay the same for all packets of the frame are set
+void deltaBeginFrame(DeltaEncoder *enc, uint8_t *packet, uint8_t timeout, uint8_t sequence, bool key, bool rgbw) {
+  enc->pixel = 0;
+  enc->index = 0;
+  enc->flags = (key ? WLED_DELTA_KEY : 0) | (rgbw ? WLED_DELTA_RGBW : 0);
+  enc->done  = false;
+  packet[0] = WLED_DELTA_PROTOCOL;
+  packet[1] = timeout;
+  packet[3] = sequence;
+}
+
+/*
+ * Builds the next packet of the frame (at most maxLen bytes) and returns its length, 0 once the frame is complete.
+ * buffer holds the channels of length pixels, last the brightness scaled channels sent in the previous frame
+ * (updated for every pixel that is encoded). The last packet is built even without data so the receiver can
+ * show the frame and track the sequence.
+ */
+size_t deltaEncodePacket(DeltaEncoder *enc, uint8_t *packet, size_t maxLen, const uint8_t *buffer, uint8_t *last, uint16_t length, uint8_t bri) {
+  if (enc->done) return 0;
+  const bool   key = enc->flags & WLED_DELTA_KEY;
+  const size_t ch  = (enc->flags & WLED_DELTA_RGBW) ? 4 : 3;
+  const uint16_t first = enc->pixel;
+  uint16_t cursor = first;   // pixel after the last encoded one
+  uint8_t *run    = nullptr; // pixel count of the run being extended
+  size_t   pos    = WLED_DELTA_HEADER_LEN;
+  uint8_t  px[4];
+  uint16_t i = first;
+  for (; i < length; i++) {
+    scaleChannels(px, buffer + i*ch, ch, bri);
+    uint8_t *prev = last + i*ch;
+    if (!key && !memcmp(px, prev, ch)) {
+      run = nullptr;
+      continue;
+    }
+    size_t need = (key || (run && *run < 255)) ? ch : 3 + ch;
+    if (pos + need > maxLen) break; // packet is full, pixel goes into the next one
+    memcpy(prev, px, ch);
+    if (!key) {
+      if (need > ch) { // start a new run
+        putUint16(packet + pos, i - cursor);
+        run = packet + pos + 2;
+        *run = 0;
+        pos += 3;
+      }
+      (*run)++;
+      cursor = i + 1;
+    }
+    memcpy(packet + pos, px, ch);
+    pos += ch;
+  }
+  enc->pixel = i;
+  enc->done  = i >= length;
+  packet[2] = enc->flags | (enc->done ? WLED_DELTA_PUSH : 0);
+  packet[4] = enc->index++;
+  putUint16(packet + 5, first);
+  return pos;
+}
+
+/*
+ * Applies a received packet through setPixel (ignoring pixels at or above maxPixels).
+ * Returns -1 if the packet was dropped because an earlier one was lost (until the next keyframe),
+ * 1 if it completed a frame that should be shown, 0 otherwise.
+ */
+int deltaDecodePacket(DeltaDecoder *dec, const uint8_t *in, size_t len, uint16_t maxPixels, void (*setPixel)(uint16_t, uint8_t, uint8_t, uint8_t, uint8_t)) {
+  if (len < WLED_DELTA_HEADER_LEN) return -1;
+  uint8_t flags  = in[2];
+  uint8_t seq    = in[3];
+  uint8_t packet = in[4];
+  bool    key    = flags & WLED_DELTA_KEY;
+  if (packet == 0) { // a delta frame can only be applied on top of the complete previous frame
+    dec->inSync    = key || (dec->inSync && dec->frameDone && seq == uint8_t(dec->frameSeq + 1));
+    dec->frameSeq  = seq;
+    dec->frameDone = false;
+  } else {
+    dec->inSync = dec->inSync && seq == dec->frameSeq && packet == dec->nextPacket;
+  }
+  dec->nextPacket = packet + 1;
+  if (!dec->inSync && !key) return -1; // lost a packet, wait for the next keyframe (its pixels are absolute)
+
+  uint8_t  ch = (flags & WLED_DELTA_RGBW) ? 4 : 3;
+  uint16_t id = (in[5] << 8) | in[6];
+  size_t   i  = WLED_DELTA_HEADER_LEN;
+  if (key) {
+    for (; i + ch <= len && id < maxPixels; i += ch, id++) {
+      setPixel(id, in[i], in[i+1], in[i+2], ch > 3 ? in[i+3] : 0);
+    }
+  } else {
+    while (i + 3 <= len) {
+      id += (in[i] << 8) | in[i+1];
+      uint8_t count = in[i+2];
+      for (i += 3; count && i + ch <= len; count--, i += ch, id++) {
+        if (id < maxPixels) setPixel(id, in[i], in[i+1], in[i+2], ch > 3 ? in[i+3] : 0);
+      }
+    }
+  }
+  if (!(flags & WLED_DELTA_PUSH)) return 0;
+  dec->frameDone = true;
+  return 1;
+}
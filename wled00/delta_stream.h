@@ -0,0 +1,44 @@
+#ifndef WLED_DELTA_STREAM_H
+#define WLED_DELTA_STREAM_H
+/*
+ * WLED delta stream (WLED to WLED virtual bus): keyframes carry raw pixels,
+ * delta frames only runs of pixels that changed since the previous frame.
+ *
+ * header: protocol, timeout (s), flags, frame sequence, packet index, first pixel of packet (big endian)
+ * keyframe data: channels of consecutive pixels
+ * delta data: runs of unchanged pixels to skip (2 bytes) + number of changed pixels (1) + their channels
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define WLED_DELTA_PROTOCOL   6    // first byte, follows UDP realtime protocols 1-5
+#define WLED_DELTA_HEADER_LEN 7    // protocol, timeout, flags, frame sequence, packet index, first pixel (2)
+#define WLED_DELTA_KEY        0x01 // keyframe
+#define WLED_DELTA_RGBW       0x02 // 4 channels per pixel
+#define WLED_DELTA_PUSH       0x80 // last packet of frame
+#ifndef WLED_DELTA_KEYFRAME
+  #define WLED_DELTA_KEYFRAME 50   // frames between keyframes, limits how long a lost packet stays visible
+#endif
+
+// sender side, one frame is split into as many packets as needed
+struct DeltaEncoder {
+  uint16_t pixel = 0;     // first pixel not yet encoded
+  uint8_t  index = 0;     // index of the next packet
+  uint8_t  flags = 0;     // WLED_DELTA_KEY and WLED_DELTA_RGBW of the current frame
+  bool     done  = true;  // packet carrying WLED_DELTA_PUSH has been built
+};
+
+// receiver side
+struct DeltaDecoder {
+  uint8_t frameSeq   = 0;
+  uint8_t nextPacket = 0;
+  bool    inSync     = false; // every packet since the last keyframe arrived in order
+  bool    frameDone  = false; // last packet of frame frameSeq arrived
+};
+
+void   deltaBeginFrame(DeltaEncoder *enc, uint8_t *packet, uint8_t timeout, uint8_t sequence, bool key, bool rgbw);
+size_t deltaEncodePacket(DeltaEncoder *enc, uint8_t *packet, size_t maxLen, const uint8_t *buffer, uint8_t *last, uint16_t length, uint8_t bri);
+int    deltaDecodePacket(DeltaDecoder *dec, const uint8_t *in, size_t len, uint16_t maxPixels, void (*setPixel)(uint16_t, uint8_t, uint8_t, uint8_t, uint8_t));
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef WLED_FRAME_PIPELINE_H
+#define WLED_FRAME_PIPELINE_H
+/*
+ * Handoff between the render side (main loop) and the output side (output task) of pipelined bus output.
+ * The render side composites frame N+1 into the bus buffers while the output side sends copies of frame N.
+ * Once the output side is done, the render side copies the next frame (Bus::captureFrame()) and publishes it.
+ *
+ * A single flag is shared: it is set with release ordering after the copies were written and cleared with
+ * release ordering after the copies were sent, so each side sees the other's writes once it observes the flag.
+ */
+
+#include <atomic>
+
+class FramePipeline {
+  public:
+    inline bool pending() const { return _pending.load(std::memory_order_acquire); } // frame copies are owned by the output side
+    inline void publish()       { _pending.store(true, std::memory_order_release); }  // render side: frame copies are complete
+    inline void done()          { _pending.store(false, std::memory_order_release); } // output side: frame copies may be overwritten
+
+  private:
+    std::atomic<bool> _pending{false};
+};
+
+#endif
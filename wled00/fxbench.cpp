@@ -0,0 +1,332 @@
+#include "wled.h"
+
+/*
+ * On-device effect benchmark (enable with -D WLED_ENABLE_FXBENCH)
+ *
+ * Renders every registered effect through WS2812FX::service() into a memory-only
+ * bus (DDP bus with IP 0.0.0.0, never transmits) for a set of 1D lengths and 2D sizes.
+ * Results (ns/frame and ns/pixel) are written to /fxbench.json so runs can be diffed
+ * between commits. Start a run with POST /fxbench (needs the settings PIN and OTA unlocked),
+ * download results from /fxbench.json.
+ *
+ * Afterwards the bus output path is timed with the same pixels split over 1, 4 and 10
+ * memory-only busses, written pixel by pixel (setPixelColor()) and as one span (setPixelColors()).
+ *
+ * The benchmark runs one effect/size case per loop() iteration so the web server and
+ * watchdog are serviced in between. Bus configuration, matrix setup and state are
+ * restored when the run completes.
+ */
+
+#ifdef WLED_ENABLE_FXBENCH
+
+#define FXBENCH_WARMUP   2   // frames rendered before timing starts (allocations, first-call setup)
+#define FXBENCH_FRAMES  16   // timed frames per case
+
+#define FXBENCH_IDLE     0
+#define FXBENCH_RUNNING  1
+#define FXBENCH_RESTORE  2
+
+#define FXBENCH_RESULTS  "/fxbench.json"
+#define FXBENCH_STATE    "/fxbench.tmp"  // state saved before the run
+
+// 1D lengths first (height 1), then 2D sizes; cases exceeding MAX_LEDS are skipped
+static const struct { uint16_t width; uint16_t height; } fxBenchSizes[] = {
+  {300, 1}, {1500, 1}, {8192, 1},
+  {16, 16}, {32, 32}, {64, 32}, {64, 64}, {128, 64}
+};
+#define FXBENCH_NUM_SIZES (sizeof(fxBenchSizes) / sizeof(fxBenchSizes[0]))
+
+// bus output cases: FXBENCH_BUS_PIXELS split evenly over this many busses (skipped if not enough bus slots)
+static const uint8_t fxBenchBusCounts[] = {1, 4, 10};
+#define FXBENCH_NUM_BUS_CASES (sizeof(fxBenchBusCounts) / sizeof(fxBenchBusCounts[0]))
+#define FXBENCH_BUS_PIXELS 1500
+
+static byte     benchStep = FXBENCH_IDLE;
+static uint8_t  benchSize = 0;
+static uint8_t  benchFx   = 0;
+static uint16_t benchCases = 0;
+static uint8_t  benchBus  = 0;
+static uint8_t  benchBusResults = 0;
+
+// saved configuration, restored after the run
+static BusConfig* savedBusses[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES] = {nullptr};
+static bool     savedFade;
+static uint8_t  savedFps;
+static bool     savedMatrix;
+#ifndef WLED_DISABLE_2D
+static uint8_t  savedPanels;
+static std::vector<WS2812FX::Panel> savedPanel;
+#endif
+
+// effects flagged as 2D only ("2" without "1" in the 4th field of the effect data string) are not run on 1D strips
+static bool fxBenchIs2DOnly(uint8_t fx) {
+  char lineBuffer[128] = "";
+  strncpy_P(lineBuffer, strip.getModeData(fx), sizeof(lineBuffer)-1);
+  char *flags = lineBuffer;
+  for (uint8_t i = 0; i < 3 && flags; i++) {
+    flags = strchr(flags, ';');
+    if (flags) flags++;
+  }
+  if (flags == nullptr) return false;
+  char *end = strchr(flags, ';');
+  if (end) *end = 0;
+  return strchr(flags, '2') && !strchr(flags, '1');
+}
+
+static bool fxBenchSizeFits(uint8_t s) {
+  #ifdef WLED_DISABLE_2D
+  if (fxBenchSizes[s].height > 1) return false;
+  #endif
+  return (uint32_t)fxBenchSizes[s].width * fxBenchSizes[s].height <= MAX_LEDS;
+}
+
+// replaces all busses with a single memory-only bus and (re)configures the matrix
+static bool fxBenchSetupSize(uint8_t s) {
+  uint16_t width  = fxBenchSizes[s].width;
+  uint16_t height = fxBenchSizes[s].height;
+  uint8_t pins[4] = {0, 0, 0, 0}; // 0.0.0.0 disables transmission in realtimeBroadcast()
+
+  busses.removeAll();
+  BusConfig bc = BusConfig(TYPE_NET_DDP_RGB, pins, 0, width * height);
+  if (busses.add(bc) == -1 || !busses.getBus(0)->isOk()) return false;
+
+  #ifndef WLED_DISABLE_2D
+  strip.isMatrix = height > 1;
+  strip.panel.clear();
+  if (strip.isMatrix) {
+    WS2812FX::Panel p;
+    p.width  = width;
+    p.height = height;
+    strip.panel.push_back(p);
+  }
+  strip.panels = strip.panel.size();
+  #endif
+  strip.finalizeInit();
+  return true;
+}
+
+static void fxBenchWriteHeader() {
+  File file = WLED_FS.open(FXBENCH_RESULTS, "w");
+  if (!file) return;
+  file.printf_P(PSTR("{\"ver\":\"%s\",\"vid\":%d,"), versionString, VERSION);
+  #if !defined(ARDUINO_ARCH_ESP32)
+  file.printf_P(PSTR("\"arch\":\"esp8266\","));
+  #elif !defined(CONFIG_IDF_TARGET_ESP32C2) && !defined(CONFIG_IDF_TARGET_ESP32C3) && !defined(CONFIG_IDF_TARGET_ESP32S2) && !defined(CONFIG_IDF_TARGET_ESP32S3)
+  file.printf_P(PSTR("\"arch\":\"esp32\","));
+  #else
+  file.printf_P(PSTR("\"arch\":\"%s\","), ESP.getChipModel());
+  #endif
+  file.printf_P(PSTR("\"freq\":%u,"), ESP.getCpuFreqMHz());
+  file.printf_P(PSTR("\"frames\":%d,\"results\":["), FXBENCH_FRAMES);
+  file.close();
+}
+
+static void fxBenchWriteResult(uint8_t fx, uint16_t width, uint16_t height, uint32_t nsPerFrame) {
+  File file = WLED_FS.open(FXBENCH_RESULTS, "a");
+  if (!file) return;
+  char name[48] = "";
+  strncpy_P(name, strip.getModeData(fx), sizeof(name)-1);
+  char *end = strchr(name, '@');
+  if (end) *end = 0;
+  file.printf_P(PSTR("%s{\"fx\":%d,\"n\":\"%s\",\"w\":%d,\"h\":%d,\"nsf\":%u,\"nsp\":%u}"),
+    benchCases ? "," : "", fx, name, width, height, nsPerFrame, nsPerFrame / (width * height));
+  file.close();
+  benchCases++;
+}
+
+// times BusManager::setPixelColor() per pixel and setPixelColors() for the whole span on
+// FXBENCH_BUS_PIXELS pixels split over n memory-only busses
+static void fxBenchRunBusCase(uint8_t n) {
+  uint8_t pins[4] = {0, 0, 0, 0}; // 0.0.0.0 disables transmission in realtimeBroadcast()
+  const uint16_t len = FXBENCH_BUS_PIXELS / n;
+  busses.removeAll();
+  for (uint8_t b = 0; b < n; b++) {
+    BusConfig bc = BusConfig(TYPE_NET_DDP_RGB, pins, b * len, len);
+    if (busses.add(bc) == -1 || !busses.getBus(b)->isOk()) return; // not enough bus slots on this chip
+  }
+  uint32_t *pixels = (uint32_t*) malloc(n * len * sizeof(uint32_t));
+  if (!pixels) return;
+
+  uint32_t perPixel = 0, span = 0;
+  for (uint8_t frame = 0; frame < FXBENCH_WARMUP + FXBENCH_FRAMES; frame++) {
+    for (uint16_t i = 0; i < n * len; i++) pixels[i] = (i * 0x010203UL) ^ (frame * 0x0F0F0FUL); // changes every frame
+    unsigned long start = micros();
+    for (uint16_t i = 0; i < n * len; i++) busses.setPixelColor(i, pixels[i]);
+    unsigned long mid = micros();
+    for (uint16_t i = 0; i < n * len; i++) pixels[i] = ~pixels[i];
+    unsigned long mid2 = micros();
+    busses.setPixelColors(0, pixels, n * len);
+    unsigned long end = micros();
+    if (frame >= FXBENCH_WARMUP) {
+      perPixel += mid - start;
+      span     += end - mid2;
+    }
+  }
+  free(pixels);
+
+  File file = WLED_FS.open(FXBENCH_RESULTS, "a");
+  if (!file) return;
+  file.printf_P(PSTR("%s{\"busses\":%d,\"len\":%d,\"nsp\":%u,\"nsb\":%u}"), benchBusResults++ ? "," : "", n, n * len,
+    (uint32_t)((perPixel * 1000ULL) / ((uint32_t)FXBENCH_FRAMES * n * len)), (uint32_t)((span * 1000ULL) / ((uint32_t)FXBENCH_FRAMES * n * len)));
+  file.close();
+}
+
+// render a single effect on the current size and return average ns per frame
+static uint32_t fxBenchRunCase(uint8_t fx) {
+  strip.makeAutoSegments(true); // also refreshes the light capabilities of the segment
+  Segment &seg = strip.getMainSegment();
+  seg.setMode(fx, true);
+  seg.setOption(SEG_OPTION_ON, true);
+
+  uint32_t elapsed = 0;
+  for (uint8_t frame = 0; frame < FXBENCH_WARMUP + FXBENCH_FRAMES; frame++) {
+    // service() will not render faster than MIN_SHOW_DELAY, wait outside of the timed section
+    while (millis() - strip.getLastShow() < strip.getMinShowDelay()) yield();
+    strip.trigger();
+    unsigned long start = micros();
+    strip.service();
+    if (frame >= FXBENCH_WARMUP) elapsed += micros() - start;
+  }
+  return (elapsed / FXBENCH_FRAMES) * 1000;
+}
+
+static bool fxBenchStart() {
+  if (realtimeMode || doInitBusses || !requestJSONBufferLock(24)) return false;
+  // save current state so it can be re-applied after the run
+  JsonObject state = doc.to<JsonObject>();
+  serializeState(state, true);
+  File file = WLED_FS.open(FXBENCH_STATE, "w");
+  if (file) {
+    serializeJson(doc, file);
+    file.close();
+  }
+  releaseJSONBufferLock();
+
+  // snapshot bus configuration (same fields as serializeConfig())
+  for (uint8_t s = 0; s < busses.getNumBusses() && s < WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES; s++) {
+    Bus *bus = busses.getBus(s);
+    if (bus == nullptr) break;
+    uint8_t pins[5] = {255, 255, 255, 255, 255};
+    bus->getPins(pins);
+    uint8_t type = bus->getType() | (bus->isOffRefreshRequired() << 7);
+    savedBusses[s] = new BusConfig(type, pins, bus->getStart(), bus->getLength(), bus->getColorOrder(), bus->isReversed(),
+                                   bus->skippedLeds(), bus->getAutoWhiteMode(), bus->getFrequency(), useGlobalLedBuffer, bus->getMaxCurrent());
+    if (bus->getNetConfig()) savedBusses[s]->net = *bus->getNetConfig();
+  }
+  savedMatrix = strip.isMatrix;
+  #ifndef WLED_DISABLE_2D
+  savedPanels = strip.panels;
+  savedPanel  = strip.panel;
+  #endif
+  savedFade = fadeTransition;
+  savedFps  = strip.getTargetFps();
+  fadeTransition = false;   // no crossfade between cases
+  strip.setTargetFps(250);  // shortest MIN_SHOW_DELAY
+
+  fxBenchWriteHeader();
+  benchCases = 0;
+  benchSize  = 0;
+  benchFx    = 0;
+  benchBus   = 0;
+  benchBusResults = 0;
+  while (benchSize < FXBENCH_NUM_SIZES && !fxBenchSizeFits(benchSize)) benchSize++;
+  if (benchSize >= FXBENCH_NUM_SIZES || !fxBenchSetupSize(benchSize)) benchSize = FXBENCH_NUM_SIZES; // finish immediately
+  DEBUG_PRINTLN(F("FX benchmark started."));
+  return true;
+}
+
+// hand the saved bus configuration to the bus re-init in WLED::loop()
+static void fxBenchFinish() {
+  File file = WLED_FS.open(FXBENCH_RESULTS, "a");
+  if (file) {
+    file.print(F("]}"));
+    file.close();
+  }
+  for (uint8_t s = 0; s < WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES; s++) {
+    busConfigs[s] = savedBusses[s];
+    savedBusses[s] = nullptr;
+  }
+  strip.isMatrix = savedMatrix;
+  #ifndef WLED_DISABLE_2D
+  strip.panels = savedPanels;
+  strip.panel  = savedPanel;
+  savedPanel.clear();
+  #endif
+  fadeTransition = savedFade;
+  strip.setTargetFps(savedFps);
+  doInitBusses = true;
+  DEBUG_PRINTF("FX benchmark done, %d cases.\n", benchCases);
+}
+
+// re-apply the state saved before the run (busses have been re-initialized by now)
+static void fxBenchRestoreState() {
+  if (!WLED_FS.exists(FXBENCH_STATE)) return;
+  if (!requestJSONBufferLock(24)) return;
+  File file = WLED_FS.open(FXBENCH_STATE, "r");
+  if (file) {
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+    if (!error) deserializeState(doc.as<JsonObject>(), CALL_MODE_NO_NOTIFY);
+  }
+  releaseJSONBufferLock();
+  WLED_FS.remove(FXBENCH_STATE);
+  stateUpdated(CALL_MODE_DIRECT_CHANGE);
+}
+
+// called from WLED::loop(), returns true while the benchmark owns the strip
+bool handleFxBench() {
+  switch (benchStep) {
+    case FXBENCH_IDLE:
+      if (!doRunFxBench) return false;
+      doRunFxBench = false;
+      if (!fxBenchStart()) return false;
+      benchStep = FXBENCH_RUNNING;
+      return true;
+
+    case FXBENCH_RUNNING:
+      if (benchSize < FXBENCH_NUM_SIZES) {
+        uint16_t width  = fxBenchSizes[benchSize].width;
+        uint16_t height = fxBenchSizes[benchSize].height;
+        // skip reserved slots and 2D-only effects on 1D strips
+        while (benchFx < strip.getModeCount() &&
+               (!strncmp_P("RSVD", strip.getModeData(benchFx), 4) || (height == 1 && fxBenchIs2DOnly(benchFx)))) benchFx++;
+        if (benchFx < strip.getModeCount()) {
+          fxBenchWriteResult(benchFx, width, height, fxBenchRunCase(benchFx));
+          benchFx++;
+          return true;
+        }
+        // next size
+        benchFx = 0;
+        do benchSize++; while (benchSize < FXBENCH_NUM_SIZES && !fxBenchSizeFits(benchSize));
+        if (benchSize < FXBENCH_NUM_SIZES && fxBenchSetupSize(benchSize)) return true;
+        benchSize = FXBENCH_NUM_SIZES;
+      }
+      if (benchBus < FXBENCH_NUM_BUS_CASES) {
+        if (benchBus == 0) {
+          File file = WLED_FS.open(FXBENCH_RESULTS, "a");
+          if (file) {
+            file.print(F("],\"bus\":["));
+            file.close();
+          }
+        }
+        fxBenchRunBusCase(fxBenchBusCounts[benchBus]);
+        benchBus++;
+        return true;
+      }
+      fxBenchFinish();
+      benchStep = FXBENCH_RESTORE;
+      return true;
+
+    case FXBENCH_RESTORE:
+      fxBenchRestoreState();
+      benchStep = FXBENCH_IDLE;
+      return false;
+  }
+  return false;
+}
+
+bool isFxBenchRunning() {
+  return benchStep != FXBENCH_IDLE || doRunFxBench;
+}
+
+#endif
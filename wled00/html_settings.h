@@ -300,533 +300,536 @@ const uint8_t PAGE_settings_wifi[] PROGMEM = {
 
 
 // Autogenerated from wled00/data/settings_leds.htm, do not edit!!
-const uint16_t PAGE_settings_leds_length = 8389;
+const uint16_t PAGE_settings_leds_length = 8447;
 const uint8_t PAGE_settings_leds[] PROGMEM = {
   0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0a, 0xdd, 0x7d, 0xeb, 0x76, 0xdb, 0x38,
-  0xd2, 0xe0, 0x7f, 0x3d, 0x05, 0x8d, 0xee, 0x76, 0xc8, 0x16, 0x25, 0x91, 0xb2, 0x95, 0x76, 0x24,
+  0xd2, 0xe0, 0x7f, 0x3d, 0x05, 0x8d, 0xee, 0x76, 0xc8, 0x16, 0x25, 0x91, 0xb2, 0x95, 0xb6, 0x25,
   0x51, 0x5e, 0x5f, 0x92, 0xb4, 0xbf, 0xb1, 0x63, 0x1f, 0xdb, 0xe9, 0xcc, 0x77, 0xd2, 0xd9, 0x0e,
-  0x44, 0x41, 0x12, 0x63, 0x8a, 0xd4, 0x90, 0x94, 0x2f, 0x6b, 0x7b, 0x9f, 0x69, 0x9f, 0x61, 0x9f,
-  0x6c, 0xab, 0x70, 0xe1, 0x45, 0x24, 0x65, 0xf7, 0xce, 0xb7, 0x7f, 0x76, 0xce, 0xe9, 0x98, 0x22,
-  0x0b, 0x85, 0x42, 0xa1, 0xae, 0x40, 0x01, 0x33, 0xdc, 0x3a, 0x3e, 0x3f, 0xba, 0xfe, 0xcf, 0x8b,
-  0xf7, 0xda, 0x3c, 0x59, 0xf8, 0xa3, 0x21, 0xfe, 0xab, 0xf9, 0x34, 0x98, 0x39, 0x84, 0x05, 0x04,
-  0x7e, 0x33, 0x3a, 0x19, 0x0d, 0x17, 0x2c, 0xa1, 0x9a, 0x3b, 0xa7, 0x51, 0xcc, 0x12, 0x87, 0xac,
-  0x92, 0x69, 0x6b, 0x8f, 0xc8, 0xb7, 0x8d, 0x80, 0x2e, 0x98, 0x43, 0x6e, 0x3d, 0x76, 0xb7, 0x0c,
-  0xa3, 0x84, 0x68, 0x6e, 0x18, 0x24, 0x2c, 0x00, 0xb0, 0x3b, 0x6f, 0x92, 0xcc, 0x9d, 0x9e, 0x65,
-  0xa5, 0xa0, 0x6b, 0x9f, 0x26, 0xec, 0xd6, 0x73, 0x59, 0x8b, 0xff, 0x30, 0xbd, 0xc0, 0x4b, 0x3c,
-  0xea, 0xb7, 0x62, 0x97, 0xfa, 0xcc, 0xb1, 0xcd, 0x05, 0xbd, 0xf7, 0x16, 0xab, 0x45, 0xfa, 0x7b,
-  0x15, 0xb3, 0x88, 0xff, 0xa0, 0x63, 0xf8, 0x1d, 0x84, 0xa4, 0xd4, 0xf3, 0x68, 0x98, 0x78, 0x89,
-  0xcf, 0x46, 0xa7, 0xef, 0x8f, 0xb5, 0x2b, 0x96, 0x24, 0x5e, 0x30, 0x8b, 0x87, 0x1d, 0xf1, 0x6e,
-  0x18, 0xbb, 0x91, 0xb7, 0x4c, 0x46, 0x8d, 0x5b, 0x1a, 0x69, 0x13, 0x67, 0x12, 0xba, 0xab, 0x05,
-  0x50, 0x62, 0xfa, 0x74, 0x19, 0xb1, 0x5b, 0xa7, 0xd7, 0xc3, 0xfe, 0x0e, 0x45, 0xb7, 0x7f, 0x38,
-  0x16, 0xfe, 0x39, 0x73, 0x76, 0xd9, 0x0e, 0x3e, 0x5c, 0x1c, 0x3a, 0xbb, 0xd6, 0xbb, 0xb7, 0xf8,
-  0x78, 0xea, 0xd8, 0x3b, 0x3b, 0xfc, 0xe5, 0xe9, 0xf8, 0x5f, 0xab, 0x30, 0x71, 0xac, 0xc1, 0xa4,
-  0xbd, 0x5a, 0xfc, 0xb5, 0x74, 0xbe, 0x7e, 0x33, 0x27, 0xed, 0x28, 0xbe, 0x9d, 0xc8, 0xa7, 0xf0,
-  0xaf, 0xd9, 0xd2, 0x0b, 0xc5, 0x0f, 0x00, 0x17, 0xbf, 0x7a, 0xd6, 0x00, 0xfb, 0xf7, 0x43, 0xd7,
-  0x5b, 0x9a, 0x89, 0xb7, 0x60, 0xe1, 0x2a, 0x31, 0xdd, 0x55, 0x9c, 0x84, 0x8b, 0xab, 0x84, 0x46,
-  0x49, 0xec, 0x6c, 0xd9, 0x66, 0xcc, 0x9f, 0x8e, 0xbd, 0x28, 0x79, 0xc0, 0xe6, 0xd0, 0xf8, 0xe8,
-  0xfc, 0xfc, 0x96, 0x45, 0x91, 0x37, 0x61, 0xb1, 0xd3, 0x33, 0xa1, 0x35, 0x82, 0xc1, 0x9f, 0x65,
-  0x14, 0x26, 0xa1, 0x43, 0xe6, 0x49, 0xb2, 0xec, 0x93, 0xc1, 0x74, 0x15, 0xb8, 0x89, 0x17, 0x06,
-  0xda, 0xef, 0xba, 0xf1, 0x78, 0xe7, 0x05, 0x93, 0xf0, 0xae, 0x1d, 0x2e, 0x59, 0xa0, 0x73, 0x80,
-  0xb8, 0xdf, 0xe9, 0xdc, 0x04, 0x61, 0xfb, 0xce, 0x67, 0x93, 0xf6, 0x8c, 0x75, 0xa6, 0x8c, 0x26,
-  0xab, 0x88, 0xc5, 0x9d, 0x58, 0x72, 0xaa, 0xf3, 0x13, 0x7c, 0x69, 0xa9, 0x5f, 0xc4, 0x78, 0x4e,
-  0xf1, 0x1d, 0xae, 0xe1, 0x9b, 0xb1, 0xe4, 0xf3, 0xe5, 0xa9, 0x4e, 0x3a, 0x19, 0xb0, 0x49, 0xfe,
-  0x8a, 0x99, 0x3f, 0xcd, 0xb7, 0x9a, 0x9d, 0x4c, 0x74, 0x66, 0x3c, 0x46, 0x0c, 0xba, 0x09, 0x34,
-  0xec, 0x33, 0x79, 0xef, 0x33, 0x64, 0xfa, 0xe1, 0x03, 0xff, 0x94, 0x81, 0x86, 0xd3, 0x29, 0x82,
-  0xe6, 0x61, 0xe2, 0xc3, 0x87, 0x4f, 0x30, 0xbb, 0xf0, 0xfa, 0xab, 0xf5, 0xad, 0x7d, 0x4b, 0xfd,
-  0x15, 0x73, 0x5a, 0x76, 0xd6, 0xc4, 0x0f, 0xe9, 0xe4, 0x3f, 0xae, 0x74, 0x66, 0x06, 0xce, 0x96,
-  0x65, 0x3c, 0xfa, 0x2c, 0xd1, 0x12, 0x67, 0xd2, 0x76, 0x23, 0x18, 0x16, 0x93, 0x38, 0x74, 0x22,
-  0x26, 0x9d, 0x18, 0x83, 0xa4, 0x0d, 0xb4, 0x1e, 0x24, 0x49, 0xe4, 0x8d, 0x57, 0x09, 0x83, 0x0f,
-  0x91, 0x4b, 0x4c, 0x66, 0x98, 0xeb, 0xef, 0x93, 0x87, 0x25, 0x23, 0x26, 0x49, 0xd8, 0x7d, 0xd2,
-  0xf9, 0x41, 0x6f, 0xa9, 0x42, 0x50, 0x02, 0xa4, 0xf1, 0x43, 0x00, 0x28, 0x02, 0x03, 0xa6, 0x77,
-  0x1c, 0x4e, 0x1e, 0xda, 0x74, 0x09, 0xac, 0x99, 0x1c, 0xcd, 0x3d, 0x7f, 0xa2, 0x27, 0x08, 0x4f,
-  0x27, 0x93, 0xf7, 0xb7, 0x40, 0xc5, 0xa9, 0x17, 0x83, 0xcc, 0xb3, 0x48, 0x27, 0x48, 0x33, 0x31,
-  0x75, 0xc3, 0x19, 0x3d, 0x7e, 0x64, 0xc9, 0x1f, 0xba, 0x61, 0xba, 0x73, 0xe6, 0xde, 0x5c, 0x79,
-  0xf0, 0x84, 0xd8, 0x0f, 0x4f, 0x75, 0x44, 0x77, 0x35, 0xad, 0x68, 0x1b, 0xaf, 0xc6, 0x0b, 0x2f,
-  0x21, 0x66, 0x12, 0x3d, 0x5c, 0xf1, 0x47, 0xc3, 0x6c, 0xd9, 0x8e, 0x23, 0x84, 0x0f, 0x58, 0xb4,
-  0xbd, 0x2d, 0x1e, 0xdb, 0xf1, 0xdc, 0x9b, 0x26, 0x80, 0x67, 0xe9, 0x05, 0xc7, 0x51, 0xb8, 0x84,
-  0x49, 0x0b, 0x62, 0xdd, 0x78, 0xae, 0xa6, 0x08, 0x84, 0x2a, 0x8c, 0x80, 0x11, 0x40, 0x11, 0xa8,
-  0x66, 0x1c, 0xfa, 0xac, 0xed, 0x87, 0x33, 0x9d, 0xbc, 0xc7, 0xf7, 0x9a, 0x64, 0x33, 0xcc, 0xb0,
-  0x36, 0xf5, 0x7c, 0xc6, 0x19, 0x06, 0xba, 0x18, 0x01, 0x63, 0x4f, 0xe5, 0xfb, 0x70, 0x8a, 0xea,
-  0x3e, 0xf5, 0x66, 0xab, 0x88, 0xf2, 0x79, 0x11, 0x0c, 0xd3, 0xa6, 0xd4, 0x43, 0x39, 0xfb, 0x33,
-  0x38, 0x09, 0xdc, 0x70, 0xb1, 0x84, 0xe9, 0x61, 0xda, 0x92, 0xce, 0x98, 0x36, 0xa1, 0x09, 0xdd,
-  0x02, 0x31, 0xc9, 0xcd, 0x7e, 0x3c, 0x0f, 0xef, 0xae, 0x43, 0x1a, 0x27, 0x62, 0x36, 0x6d, 0xe3,
-  0x11, 0x75, 0x24, 0x71, 0x50, 0x80, 0x48, 0x82, 0x1f, 0xf8, 0x04, 0x7a, 0x01, 0x90, 0xfc, 0xfb,
-  0xf5, 0xd9, 0xa9, 0xc3, 0x60, 0x2c, 0xae, 0x4f, 0xe3, 0x18, 0x25, 0xc4, 0x09, 0xf6, 0xe5, 0x30,
-  0xfa, 0x04, 0x31, 0x11, 0xd3, 0xf5, 0x19, 0x8d, 0xae, 0x85, 0x72, 0xe9, 0x52, 0xc9, 0xf8, 0x04,
-  0x26, 0x0f, 0x30, 0x3e, 0x1a, 0x78, 0x0b, 0x4e, 0xaa, 0x43, 0x82, 0x30, 0x80, 0x41, 0x49, 0x08,
-  0x07, 0x66, 0x40, 0x35, 0xd2, 0x15, 0x6d, 0x20, 0xf8, 0xf9, 0xae, 0x72, 0xcf, 0xed, 0x88, 0x2d,
-  0x7d, 0xea, 0xa2, 0x28, 0xf1, 0x4e, 0x09, 0x8e, 0xc9, 0xec, 0xbe, 0xb3, 0xac, 0xdc, 0xc8, 0xc6,
-  0xa7, 0x1e, 0xcc, 0x54, 0x8c, 0xe3, 0x32, 0x13, 0x93, 0x9a, 0x9e, 0xf1, 0xc8, 0xad, 0x0c, 0x13,
-  0x56, 0x26, 0x10, 0x56, 0x86, 0x4a, 0x1b, 0x93, 0x08, 0x03, 0xe3, 0x65, 0xed, 0x61, 0x0e, 0xe3,
-  0xf3, 0x7f, 0xe8, 0x82, 0x21, 0xcc, 0xe1, 0xa2, 0xf1, 0xaf, 0x15, 0x03, 0x11, 0x60, 0x3e, 0x73,
-  0x93, 0x30, 0x3a, 0xf0, 0x7d, 0x9d, 0xfc, 0xb4, 0x38, 0x3d, 0xd2, 0xbc, 0x60, 0xb9, 0x4a, 0xbe,
-  0xa2, 0x41, 0xfc, 0xef, 0xce, 0xe9, 0x37, 0x60, 0xd8, 0x34, 0x8c, 0x74, 0x0f, 0xcc, 0x93, 0x37,
-  0x84, 0x39, 0x65, 0xc1, 0x2c, 0x99, 0x0f, 0xbc, 0x66, 0x53, 0xa0, 0x0a, 0x1c, 0xf6, 0xd5, 0xfb,
-  0xd6, 0x46, 0xe8, 0x36, 0x08, 0x56, 0x0c, 0x52, 0x1d, 0xcc, 0x74, 0xcb, 0xec, 0x1a, 0x03, 0x6f,
-  0x0a, 0x93, 0x6b, 0x11, 0xc7, 0x09, 0x9e, 0x9e, 0xc8, 0xa9, 0xad, 0x1e, 0xba, 0xea, 0x61, 0x07,
-  0x1f, 0xd4, 0x0c, 0x55, 0x61, 0x11, 0x38, 0x96, 0xe8, 0x29, 0x4e, 0x40, 0x05, 0xab, 0x74, 0x9a,
-  0x9c, 0x5e, 0x93, 0x66, 0x92, 0x29, 0xb6, 0x69, 0x5b, 0xc6, 0xc8, 0xd9, 0xb3, 0x0c, 0x74, 0x0f,
-  0x5e, 0xb0, 0x62, 0xcf, 0x80, 0xe1, 0x15, 0x64, 0xe0, 0xc3, 0x2e, 0xa7, 0x67, 0x7b, 0x9b, 0x90,
-  0x2d, 0x41, 0x0e, 0xc7, 0x08, 0xbf, 0x5b, 0x76, 0xe1, 0x8d, 0x20, 0x99, 0x3a, 0xc2, 0x46, 0xb7,
-  0xa1, 0x27, 0x97, 0x22, 0x75, 0xa8, 0x33, 0x9c, 0xe2, 0x1a, 0xe6, 0xc6, 0xfc, 0x47, 0x1b, 0x66,
-  0x82, 0x18, 0x6d, 0xe0, 0xe9, 0x7b, 0xea, 0xce, 0x75, 0xd4, 0x17, 0x26, 0xf0, 0x8e, 0x5a, 0xf6,
-  0xf6, 0x36, 0x6d, 0x2f, 0x57, 0xf1, 0x3c, 0x1b, 0xb4, 0xfc, 0x66, 0xa0, 0x48, 0xd0, 0x76, 0x1c,
-  0xc2, 0x98, 0x03, 0x67, 0x14, 0x38, 0x4e, 0x06, 0x91, 0x11, 0x66, 0x18, 0xd2, 0x44, 0x0a, 0xd5,
-  0xfa, 0x7e, 0x15, 0x46, 0xd1, 0x83, 0xc9, 0xe7, 0x5e, 0xfb, 0xf9, 0xf1, 0x3f, 0xae, 0xce, 0x3f,
-  0xb5, 0x05, 0x6b, 0xbd, 0xe9, 0x83, 0x4e, 0x8d, 0x67, 0xcd, 0xa5, 0xc1, 0x9b, 0x44, 0x1b, 0x33,
-  0x0d, 0x3c, 0xe2, 0xa4, 0xfd, 0xdd, 0x30, 0x33, 0x64, 0x0e, 0x21, 0xe2, 0xd7, 0x14, 0xfc, 0x1b,
-  0xa8, 0xbd, 0xb9, 0x65, 0xe3, 0xd8, 0x3a, 0xbf, 0x6e, 0xe9, 0xc1, 0x42, 0x73, 0x1c, 0x8d, 0x9c,
-  0x5c, 0x12, 0xed, 0xe9, 0x49, 0x0b, 0x16, 0x8e, 0x43, 0x0e, 0xaf, 0x89, 0xa1, 0x6d, 0x6f, 0xff,
-  0xda, 0x49, 0xdd, 0xd5, 0x7f, 0x29, 0xad, 0x29, 0x56, 0xa0, 0x99, 0x46, 0x4c, 0x88, 0x28, 0x18,
-  0x15, 0xff, 0xe1, 0x65, 0xa2, 0x51, 0x7a, 0x7f, 0x38, 0x5e, 0xd3, 0x1e, 0xfc, 0xc8, 0xe4, 0xf7,
-  0x87, 0x92, 0x5f, 0x1f, 0x26, 0xf6, 0xc7, 0x0b, 0xf2, 0xeb, 0x2b, 0xc1, 0xf1, 0x95, 0xe0, 0xf8,
-  0x4a, 0x70, 0x7c, 0x25, 0x38, 0xbe, 0xf1, 0xc8, 0xe1, 0xe1, 0xd1, 0xf1, 0x0b, 0x98, 0x6c, 0x43,
-  0xf4, 0x14, 0x56, 0xf6, 0xf4, 0x5a, 0x19, 0x0f, 0x5f, 0x90, 0x71, 0x21, 0xb4, 0x3f, 0x52, 0xa1,
-  0xcd, 0xf1, 0x24, 0xf7, 0x7e, 0x8d, 0xe7, 0x17, 0x5e, 0xc0, 0x6d, 0xae, 0xef, 0xb9, 0x28, 0x05,
-  0xc9, 0x1d, 0x63, 0x01, 0x30, 0x3f, 0xd5, 0xc5, 0xe7, 0x0e, 0xfe, 0x90, 0x44, 0x3f, 0x6f, 0x71,
-  0x56, 0xff, 0x28, 0xb0, 0xfa, 0x47, 0x9e, 0xd5, 0xcf, 0xf0, 0x3f, 0xd1, 0xc1, 0x96, 0x95, 0x59,
-  0x9e, 0xd4, 0xcd, 0xa0, 0x5f, 0x56, 0xda, 0x81, 0xb6, 0x3b, 0x87, 0xa7, 0x8d, 0x91, 0x13, 0x0c,
-  0xf9, 0x98, 0x4d, 0xe9, 0xca, 0x47, 0x9f, 0xb3, 0xa5, 0x0c, 0x96, 0x22, 0x19, 0x98, 0x96, 0x84,
-  0xcb, 0x0b, 0xf0, 0x43, 0x74, 0x46, 0x85, 0x41, 0x95, 0x22, 0xc9, 0xa3, 0xa7, 0x91, 0x0d, 0xe6,
-  0x52, 0x5a, 0x24, 0x72, 0x1d, 0x86, 0xda, 0x82, 0x06, 0x0f, 0x1a, 0x84, 0x6f, 0xb1, 0x06, 0x02,
-  0xa0, 0x2d, 0x98, 0x96, 0x84, 0xda, 0x9c, 0x06, 0x13, 0x9f, 0x6d, 0x91, 0x01, 0x1a, 0xcb, 0xa1,
-  0xcd, 0x76, 0xb7, 0xb7, 0xf5, 0xa0, 0xe9, 0x90, 0x3f, 0x83, 0x3f, 0xa3, 0x23, 0x70, 0x5a, 0x10,
-  0x15, 0x45, 0xa0, 0x0a, 0xe8, 0x8d, 0x68, 0xa0, 0xbd, 0xbf, 0xba, 0xd8, 0xe9, 0xb6, 0x89, 0x72,
-  0x54, 0x81, 0xf1, 0xcc, 0x49, 0xe7, 0x8e, 0xf6, 0x0f, 0xea, 0x7b, 0x13, 0x2f, 0x79, 0xd0, 0x0d,
-  0xf4, 0x96, 0xf0, 0x56, 0x38, 0x55, 0x3d, 0x67, 0xb1, 0x59, 0xc0, 0xbd, 0xb0, 0x34, 0xb8, 0xdc,
-  0x03, 0x61, 0xb8, 0x09, 0xba, 0xcf, 0x31, 0xb0, 0xc9, 0x80, 0x37, 0x3c, 0x3d, 0x90, 0x7c, 0x60,
-  0xfb, 0x22, 0x80, 0xec, 0x5b, 0xa6, 0x02, 0x06, 0x58, 0xe1, 0x69, 0x26, 0x5e, 0x0c, 0x2e, 0xe2,
-  0x01, 0x60, 0x88, 0x17, 0xf8, 0x1e, 0xf8, 0x9a, 0xbe, 0x74, 0x39, 0x1c, 0x74, 0x19, 0xaf, 0xba,
-  0xaf, 0x80, 0x2d, 0xf4, 0x37, 0xb2, 0xb6, 0xb7, 0xd3, 0x48, 0xe1, 0xf3, 0x49, 0x91, 0xf2, 0xd3,
-  0x83, 0xa2, 0xa7, 0x38, 0x3d, 0x00, 0xe3, 0x25, 0xda, 0xad, 0x53, 0x2d, 0x28, 0x38, 0x3d, 0x80,
-  0x6e, 0x4b, 0x24, 0xf4, 0x2c, 0xa7, 0x82, 0x8c, 0x62, 0x67, 0x8a, 0x86, 0xc7, 0xf8, 0xce, 0x4b,
-  0xc0, 0x20, 0x56, 0x30, 0x0a, 0xc2, 0x32, 0x73, 0x9d, 0x0c, 0xc0, 0x6d, 0xe6, 0xb4, 0x26, 0x47,
-  0x12, 0xa8, 0x9b, 0x4b, 0x63, 0xa6, 0x59, 0xfd, 0x4a, 0x54, 0xb6, 0x29, 0x27, 0x66, 0x30, 0x86,
-  0x00, 0xef, 0x66, 0xc0, 0x61, 0x77, 0xac, 0x7e, 0xa9, 0x83, 0x1d, 0xab, 0x00, 0xd1, 0xab, 0x80,
-  0xe8, 0xe5, 0x21, 0x7a, 0x15, 0x10, 0xbd, 0x02, 0x44, 0xb7, 0x0a, 0xa4, 0x9b, 0xc2, 0x4c, 0x84,
-  0xf0, 0xf7, 0x37, 0x30, 0x54, 0xb1, 0xf2, 0x99, 0xc3, 0x2c, 0x6c, 0x00, 0xc8, 0x62, 0x19, 0x14,
-  0xea, 0x5c, 0xcc, 0xcc, 0x92, 0x33, 0xb6, 0xc0, 0x78, 0x41, 0x85, 0xb4, 0x2f, 0x18, 0x99, 0x23,
-  0xd2, 0x0c, 0x32, 0x23, 0x03, 0x61, 0x52, 0xf3, 0x85, 0x16, 0x57, 0xa7, 0x6b, 0x2d, 0xb0, 0x1b,
-  0x0a, 0x71, 0x42, 0x1a, 0xa7, 0xe3, 0x50, 0x8f, 0x15, 0xeb, 0x41, 0xd7, 0xa8, 0xb3, 0xf3, 0x2b,
-  0xc4, 0x4f, 0x6c, 0xb8, 0xd3, 0xdd, 0xd7, 0xbb, 0x6f, 0xc1, 0x62, 0x6d, 0x6f, 0x77, 0xdf, 0xc1,
-  0x9f, 0xa7, 0x27, 0x3d, 0xf9, 0xd5, 0xe9, 0x1a, 0x66, 0xa6, 0x98, 0x3b, 0x18, 0x91, 0x56, 0xd1,
-  0x69, 0x15, 0x7a, 0xdd, 0x67, 0xa3, 0xee, 0xde, 0x7e, 0xd7, 0xfa, 0x35, 0x69, 0xd2, 0xbe, 0xdd,
-  0xe3, 0x7f, 0x10, 0xc9, 0xc8, 0x01, 0x2c, 0xe2, 0xe3, 0x1e, 0x7f, 0xf9, 0x96, 0xff, 0xcb, 0x5f,
-  0xec, 0xf2, 0xc7, 0x1d, 0xfc, 0xd7, 0x80, 0x37, 0x3b, 0xe0, 0x76, 0xd9, 0x70, 0x77, 0x6f, 0xbf,
-  0x27, 0xde, 0x65, 0x3c, 0x04, 0x49, 0x65, 0x3c, 0x8a, 0xc4, 0x91, 0x61, 0x3c, 0x69, 0x26, 0xf8,
-  0x0f, 0x8e, 0x51, 0xc8, 0xd6, 0x62, 0x79, 0x47, 0xa3, 0x00, 0xec, 0x45, 0x69, 0xa6, 0xf8, 0xe0,
-  0xcf, 0x94, 0xae, 0xfd, 0xd6, 0xb5, 0xac, 0x92, 0x1e, 0xc0, 0xcc, 0x3b, 0x4e, 0x41, 0x74, 0xa5,
-  0x05, 0x70, 0xec, 0x6e, 0xbf, 0xa4, 0xab, 0xba, 0xfc, 0x56, 0x94, 0x75, 0x73, 0x53, 0x20, 0x27,
-  0x02, 0x0e, 0x15, 0xc9, 0x5d, 0x7f, 0xcb, 0x85, 0x1d, 0x1e, 0x84, 0x1d, 0xc2, 0xfd, 0x79, 0x65,
-  0x8f, 0x64, 0x86, 0xd9, 0xcc, 0x7b, 0x6a, 0x72, 0xd1, 0x8d, 0x0a, 0x63, 0x63, 0x4d, 0x48, 0xd3,
-  0xcf, 0x0b, 0x5e, 0x88, 0xde, 0x68, 0x7b, 0x3b, 0x1c, 0xbe, 0x7b, 0xbb, 0x4f, 0x4e, 0x2e, 0x34,
-  0x48, 0x0e, 0x20, 0x1b, 0x8c, 0xfb, 0xa4, 0x1f, 0x8e, 0x76, 0xdf, 0xed, 0x93, 0x63, 0x30, 0xf6,
-  0xda, 0xc7, 0x8b, 0x93, 0x73, 0xf1, 0xc6, 0xde, 0x27, 0xf8, 0x03, 0xbf, 0x13, 0xf1, 0x56, 0x5a,
-  0x31, 0xbb, 0x8c, 0x78, 0xf7, 0x1d, 0xe2, 0x7d, 0xbb, 0xbb, 0x4f, 0x8e, 0xfc, 0x1b, 0x85, 0x03,
-  0x3c, 0x06, 0x6d, 0x3a, 0x52, 0xc0, 0x43, 0xd3, 0x87, 0xe4, 0xc7, 0xb1, 0x07, 0xee, 0xb0, 0x37,
-  0x70, 0x95, 0x5b, 0x8f, 0x6b, 0x84, 0x87, 0x34, 0x5d, 0xe8, 0x02, 0xa4, 0x67, 0x10, 0x03, 0x4b,
-  0x73, 0x84, 0x6f, 0x6f, 0xbb, 0xc3, 0xdd, 0xa7, 0x27, 0xd1, 0x23, 0x64, 0x43, 0x2e, 0x7f, 0xb6,
-  0xf1, 0x63, 0x0f, 0x40, 0xdc, 0xe6, 0xae, 0x35, 0x0c, 0xf7, 0xf5, 0xb8, 0x46, 0x21, 0xcd, 0x18,
-  0xa2, 0xf8, 0x7f, 0xad, 0xbc, 0x88, 0x5b, 0x2b, 0xa3, 0x5f, 0x06, 0x14, 0x73, 0x9e, 0x07, 0x83,
-  0xf4, 0x3c, 0x75, 0x81, 0x10, 0xdf, 0x81, 0x2e, 0x08, 0x06, 0x47, 0x53, 0xce, 0x06, 0x65, 0xb1,
-  0x2a, 0xde, 0x3d, 0x3d, 0xed, 0x00, 0x89, 0xa1, 0x19, 0x72, 0xd9, 0x0d, 0x41, 0x76, 0xa1, 0x6d,
-  0xad, 0x56, 0xfb, 0xb9, 0xbc, 0x17, 0x82, 0x11, 0x33, 0x8f, 0x10, 0x62, 0x57, 0x70, 0xfe, 0x37,
-  0x0e, 0xc7, 0xb7, 0x8f, 0xf9, 0xe4, 0x96, 0xdd, 0xe7, 0x69, 0xe5, 0xb3, 0x99, 0x3c, 0x39, 0x01,
-  0x4c, 0x81, 0xfd, 0x1b, 0x76, 0xd1, 0xed, 0x22, 0x43, 0xba, 0x7b, 0xf8, 0xbc, 0xc3, 0x9f, 0x77,
-  0x39, 0xe7, 0x76, 0x81, 0x73, 0xbb, 0x3b, 0x5b, 0x4e, 0xf8, 0xf4, 0xb4, 0xb7, 0x87, 0x34, 0x71,
-  0xec, 0x6e, 0xc8, 0xb1, 0x17, 0x59, 0x90, 0xe3, 0x36, 0xb6, 0x77, 0x24, 0x82, 0xbd, 0x7d, 0xc1,
-  0x9b, 0x7e, 0xca, 0x4b, 0x8e, 0x62, 0xe2, 0xcd, 0x00, 0x47, 0x93, 0xdc, 0x91, 0x32, 0x1e, 0x45,
-  0x46, 0x49, 0xa5, 0xf2, 0x14, 0x56, 0x33, 0xe4, 0xcb, 0x79, 0x91, 0x21, 0x96, 0x51, 0xec, 0xce,
-  0xad, 0xe8, 0xee, 0x95, 0x94, 0x46, 0x64, 0xc3, 0x88, 0x37, 0x37, 0x8d, 0xc9, 0x7f, 0x0d, 0xb3,
-  0xa6, 0x55, 0x78, 0xec, 0xb7, 0xd9, 0xa4, 0x39, 0x3d, 0x4b, 0x29, 0x54, 0x55, 0x20, 0xa1, 0xf0,
-  0xd0, 0x12, 0x9e, 0x00, 0xa6, 0xd9, 0x82, 0x69, 0xde, 0xdc, 0xce, 0xaf, 0xe8, 0x7f, 0x77, 0x6f,
-  0x53, 0x8f, 0x60, 0xd2, 0xca, 0xd6, 0x24, 0x1b, 0xec, 0x49, 0x70, 0x0b, 0xb1, 0x17, 0x9b, 0x68,
-  0x90, 0x4b, 0x43, 0xc8, 0x0f, 0x6d, 0x2f, 0x21, 0x50, 0x04, 0xdb, 0x34, 0xd1, 0xf4, 0x28, 0x4c,
-  0x28, 0x7e, 0xb2, 0xf7, 0xac, 0xff, 0xfd, 0xbf, 0x8c, 0x34, 0x14, 0x9a, 0x6c, 0xc6, 0x37, 0x61,
-  0xf7, 0x68, 0x42, 0xf8, 0x1a, 0x59, 0x9f, 0x3c, 0xcb, 0xe9, 0xbf, 0x2b, 0xcf, 0x7b, 0x52, 0x22,
-  0x38, 0xe1, 0x42, 0x05, 0xf6, 0xf6, 0xe0, 0x4b, 0x5b, 0xd8, 0x56, 0x36, 0xe1, 0x08, 0x1d, 0x19,
-  0x9f, 0x1c, 0x5d, 0xe6, 0xe2, 0x0c, 0x43, 0xac, 0xcf, 0xfd, 0xad, 0x54, 0x1b, 0x2c, 0xaf, 0x65,
-  0xc6, 0xf0, 0x5f, 0x04, 0x2e, 0x26, 0x4b, 0xbb, 0xfd, 0x52, 0xda, 0xbd, 0x74, 0xfc, 0x9a, 0xb4,
-  0xdb, 0x5c, 0x55, 0x7e, 0x52, 0xf9, 0xcc, 0x11, 0xe4, 0x09, 0x4b, 0x99, 0xab, 0x60, 0x6e, 0xb3,
-  0x54, 0xb9, 0xcd, 0xd2, 0xa8, 0x35, 0x20, 0x2b, 0xae, 0x2f, 0xe0, 0x55, 0x1d, 0xbe, 0xba, 0x30,
-  0xa8, 0x68, 0xac, 0x12, 0xa3, 0xa5, 0x4a, 0x8c, 0x44, 0x1f, 0x2f, 0xe7, 0x35, 0xab, 0x5c, 0x00,
-  0xc1, 0x93, 0x9a, 0x47, 0x4e, 0x3d, 0x76, 0x06, 0xfe, 0xd1, 0x14, 0x3f, 0xbc, 0x00, 0x58, 0xc2,
-  0x1f, 0xc5, 0x14, 0xb9, 0xa1, 0x1f, 0x46, 0x0e, 0xf9, 0x69, 0x3a, 0x9d, 0x92, 0x41, 0x9a, 0x05,
-  0xa5, 0x0d, 0xb3, 0x55, 0xd2, 0xac, 0x7d, 0xcb, 0xce, 0xad, 0x04, 0x6c, 0xa2, 0x5b, 0x25, 0x74,
-  0x4b, 0xb9, 0x12, 0xe0, 0x97, 0x56, 0x02, 0xfc, 0xb5, 0x95, 0x00, 0xb7, 0x66, 0x25, 0x00, 0xe7,
-  0xef, 0xdf, 0x59, 0x0a, 0x70, 0x37, 0x2c, 0x05, 0xfc, 0x00, 0xb9, 0xf8, 0x91, 0xc9, 0x05, 0xa6,
-  0xb3, 0x30, 0x3c, 0x6f, 0xcb, 0xf9, 0x21, 0x68, 0xba, 0x05, 0x2a, 0x5f, 0x4a, 0x6b, 0x6f, 0x15,
-  0x17, 0x6e, 0x15, 0x17, 0x6e, 0x15, 0x17, 0x6e, 0x15, 0x17, 0x6e, 0x73, 0x69, 0xed, 0x6d, 0x65,
-  0x5a, 0xbb, 0xa8, 0xec, 0xe9, 0xb5, 0x69, 0xed, 0x62, 0x53, 0x5a, 0x2b, 0xd8, 0xff, 0xa3, 0xc4,
-  0xfe, 0xec, 0xcd, 0x3a, 0x8b, 0xb2, 0x6f, 0x88, 0xcd, 0x78, 0x7e, 0x76, 0xc5, 0x32, 0x04, 0xb0,
-  0x96, 0xe5, 0x96, 0x21, 0x72, 0x33, 0x68, 0xec, 0x97, 0xe5, 0x0a, 0xbc, 0x33, 0xe9, 0x97, 0x5e,
-  0xaf, 0xad, 0x6c, 0x6c, 0x42, 0x49, 0xc2, 0x88, 0x06, 0x33, 0x34, 0x1c, 0x5c, 0x44, 0x9f, 0x9f,
-  0x99, 0x1f, 0x33, 0xce, 0xad, 0x69, 0x55, 0x0b, 0xa4, 0x75, 0x90, 0x5f, 0xba, 0x87, 0xcc, 0x2c,
-  0x5b, 0xb8, 0xff, 0xba, 0xfa, 0x06, 0x76, 0x87, 0x5b, 0x29, 0x3f, 0x46, 0x85, 0x91, 0x9e, 0x2b,
-  0x94, 0xa6, 0x4b, 0xbe, 0x04, 0xb3, 0x85, 0xa9, 0x0e, 0x58, 0x9e, 0x3c, 0x26, 0x73, 0x0a, 0x91,
-  0x81, 0xfe, 0x90, 0xf5, 0x5a, 0xc2, 0x63, 0x18, 0xcd, 0xe9, 0x28, 0xc4, 0x60, 0xc8, 0x79, 0x68,
-  0x4e, 0x0d, 0x73, 0x3a, 0x8a, 0xe0, 0x47, 0xe4, 0xc0, 0xe3, 0xdf, 0xd3, 0xde, 0x21, 0xfa, 0x2b,
-  0x3d, 0x6e, 0x42, 0x4b, 0x60, 0xbc, 0xe8, 0x07, 0xad, 0x2a, 0x2e, 0x80, 0x1f, 0xc9, 0xcd, 0x1a,
-  0x19, 0x1e, 0x2c, 0x4b, 0xef, 0x1d, 0x27, 0xde, 0x27, 0xc0, 0x2f, 0x9d, 0x34, 0xe3, 0x26, 0xd1,
-  0x96, 0xf3, 0x87, 0xd8, 0x73, 0xa9, 0xaf, 0xac, 0xfa, 0xc2, 0x2a, 0x64, 0x3a, 0xd4, 0x14, 0x3b,
-  0x26, 0xb4, 0x83, 0xa1, 0xfe, 0xaf, 0x90, 0xfa, 0x4b, 0x37, 0x34, 0xa6, 0x99, 0x13, 0x1e, 0x53,
-  0xf7, 0x66, 0x16, 0x85, 0xab, 0x60, 0xe2, 0x7c, 0x47, 0x33, 0x4e, 0xa3, 0xd6, 0x2c, 0xa2, 0x13,
-  0x0f, 0x57, 0xf3, 0xdf, 0x59, 0x13, 0x36, 0x33, 0xb5, 0x9f, 0x1f, 0xc5, 0xda, 0xc1, 0x5b, 0x6b,
-  0x5f, 0x3c, 0xbc, 0x83, 0x28, 0x9d, 0xcf, 0x7e, 0x6e, 0x06, 0x5d, 0xd7, 0x25, 0xcf, 0x9a, 0xa5,
-  0x80, 0x9f, 0x7f, 0x31, 0xb5, 0x9f, 0x76, 0x77, 0x77, 0xb3, 0xdf, 0x1a, 0xf4, 0xff, 0x8b, 0xf1,
-  0x5d, 0xce, 0x06, 0x9b, 0xd4, 0xa5, 0x04, 0xd1, 0xe8, 0x8c, 0x26, 0x73, 0xb4, 0x46, 0x3a, 0xb7,
-  0xa3, 0xe6, 0x9e, 0x65, 0x19, 0x4f, 0x4f, 0xa2, 0xe7, 0x3d, 0xab, 0xda, 0x3f, 0x56, 0xe0, 0x13,
-  0xe2, 0xa8, 0xb0, 0xd1, 0xfb, 0x0a, 0x6c, 0xb6, 0xb5, 0x3e, 0x10, 0xe9, 0xe6, 0x20, 0xd1, 0x8c,
-  0xc3, 0xa0, 0xc0, 0xcc, 0xac, 0xff, 0x3d, 0xeb, 0x17, 0x5c, 0x85, 0x07, 0x74, 0x6d, 0x5c, 0x39,
-  0xd1, 0x16, 0x6c, 0x11, 0x46, 0x0f, 0xa4, 0x99, 0xad, 0xb0, 0xec, 0x7f, 0xd7, 0xf4, 0xe1, 0x78,
-  0xf4, 0xfe, 0xf2, 0xf2, 0xfc, 0xb2, 0xaf, 0x7d, 0xe6, 0x2b, 0x25, 0x21, 0xf8, 0x63, 0x60, 0x06,
-  0xcf, 0x3e, 0x0f, 0xb7, 0x86, 0x9d, 0xf1, 0xc8, 0xf8, 0x0e, 0x21, 0xba, 0xd1, 0x07, 0x7c, 0x96,
-  0x58, 0x81, 0x59, 0x02, 0x84, 0x74, 0xe0, 0xdc, 0x29, 0xce, 0x1c, 0x4e, 0xbb, 0xcb, 0x3c, 0x5f,
-  0xd7, 0x01, 0x6d, 0x33, 0xfe, 0x55, 0x64, 0x37, 0x46, 0xa7, 0x07, 0xa3, 0xe8, 0x74, 0x07, 0x33,
-  0x67, 0x36, 0xea, 0xed, 0x67, 0x50, 0x33, 0xa3, 0x3f, 0xe3, 0x4d, 0x1f, 0x70, 0xbd, 0xe8, 0x14,
-  0x92, 0x73, 0xa7, 0xb4, 0x32, 0x61, 0x9e, 0x38, 0xf9, 0x94, 0x2a, 0x5b, 0xb1, 0x98, 0x0d, 0xed,
-  0xb6, 0xd5, 0xdd, 0xde, 0xde, 0x3a, 0x85, 0xff, 0x4e, 0xf6, 0x01, 0xc5, 0xfb, 0xab, 0x0b, 0xad,
-  0xf7, 0x07, 0x2e, 0x36, 0x6a, 0x77, 0x5e, 0x32, 0xd7, 0xec, 0x03, 0xed, 0xf3, 0xd5, 0xa1, 0x16,
-  0xaf, 0x96, 0x4b, 0xff, 0x81, 0xf4, 0xf5, 0x87, 0xa6, 0x73, 0xba, 0x4f, 0xec, 0xee, 0x1f, 0x1a,
-  0xe9, 0x9f, 0xec, 0x93, 0x2f, 0x57, 0xdd, 0x3d, 0xbb, 0xa7, 0x89, 0xdf, 0x04, 0x1a, 0x12, 0x13,
-  0x20, 0x66, 0xf8, 0x0f, 0x39, 0x90, 0xad, 0x70, 0x21, 0x2d, 0xe0, 0x21, 0x01, 0xae, 0x34, 0xe1,
-  0xb0, 0x89, 0x88, 0x00, 0xe6, 0xf5, 0x83, 0xb5, 0xc5, 0x68, 0xcd, 0xb1, 0x43, 0x74, 0xbe, 0x4a,
-  0x15, 0xc6, 0x89, 0xc6, 0xa6, 0x53, 0x40, 0x13, 0x9b, 0xda, 0xff, 0x24, 0x83, 0x71, 0xd3, 0x99,
-  0x3b, 0xf3, 0x02, 0x27, 0xe6, 0x46, 0x7f, 0x6e, 0x8e, 0x79, 0xc7, 0x5e, 0xac, 0xb1, 0x20, 0x5c,
-  0xcd, 0xe6, 0xc6, 0x70, 0x1c, 0x8d, 0xb2, 0xb5, 0xa0, 0xc2, 0xf4, 0x3e, 0x14, 0x96, 0x88, 0xb2,
-  0xf7, 0x27, 0xa8, 0x6f, 0x63, 0xf1, 0xf1, 0x87, 0x90, 0x89, 0xa2, 0xb8, 0xee, 0x49, 0x4e, 0x9e,
-  0x5c, 0xcb, 0xe4, 0x94, 0x28, 0xc9, 0xcc, 0x6d, 0x9d, 0xd1, 0x38, 0x79, 0x1f, 0x4c, 0xe4, 0xca,
-  0x1e, 0x1b, 0xda, 0x6a, 0xb5, 0xce, 0x1a, 0xdc, 0xbe, 0xb4, 0xde, 0x70, 0x05, 0x82, 0xc5, 0x5a,
-  0xe0, 0x46, 0x32, 0x13, 0xd2, 0x7c, 0x79, 0x89, 0x62, 0xbd, 0xc9, 0x40, 0x2c, 0xf9, 0xbd, 0x6c,
-  0xaa, 0x4a, 0x0d, 0x25, 0xa5, 0x01, 0xcf, 0xa1, 0x02, 0x91, 0x43, 0x41, 0xea, 0x6d, 0x98, 0x5e,
-  0xfc, 0x89, 0x7e, 0xd2, 0x6f, 0x8d, 0x7d, 0xab, 0x7f, 0x9b, 0x0d, 0x15, 0x92, 0x5a, 0x9c, 0xd4,
-  0x74, 0x9b, 0x50, 0x6c, 0x5b, 0xac, 0x75, 0x77, 0xa4, 0xf6, 0x74, 0x74, 0xe2, 0x5d, 0x5d, 0xe3,
-  0xd2, 0xa1, 0x93, 0xa4, 0xb1, 0xdb, 0x54, 0xdf, 0xd2, 0x21, 0xcd, 0x02, 0xb7, 0x45, 0x47, 0x18,
-  0x49, 0x1d, 0x36, 0x71, 0xeb, 0xe6, 0xe9, 0xa9, 0x25, 0x5e, 0x82, 0x44, 0x53, 0xe9, 0x53, 0x3d,
-  0x91, 0xf4, 0x41, 0x84, 0x48, 0xb8, 0x1f, 0x45, 0x00, 0xb5, 0x5c, 0xfd, 0x7d, 0x38, 0xf1, 0x6e,
-  0x35, 0xbe, 0x79, 0xe4, 0xf0, 0x4e, 0x46, 0x7f, 0x06, 0xc3, 0x79, 0xa4, 0xde, 0xc4, 0x0b, 0x1f,
-  0xdf, 0xfc, 0xfc, 0x48, 0x9b, 0xf6, 0x73, 0x1f, 0x3e, 0x89, 0x50, 0x43, 0x13, 0xfb, 0xdb, 0xa7,
-  0xd7, 0xf0, 0xe1, 0x99, 0x68, 0x10, 0xa8, 0xcc, 0xd1, 0x2c, 0x38, 0xe4, 0xf3, 0x89, 0x9e, 0x44,
-  0xc0, 0x0e, 0x32, 0x82, 0x2f, 0x82, 0x2c, 0x9c, 0xe8, 0x37, 0xc3, 0x70, 0xc9, 0x87, 0x2d, 0x13,
-  0xd4, 0x6e, 0x97, 0x68, 0x2a, 0xe4, 0x1d, 0x71, 0x75, 0xb8, 0x1f, 0x76, 0x04, 0xc8, 0x68, 0x0d,
-  0x74, 0xc7, 0x22, 0xa3, 0xab, 0x7f, 0xbc, 0xdd, 0xb3, 0xbb, 0xda, 0xe5, 0xc7, 0xc3, 0x2f, 0xb5,
-  0x60, 0x36, 0x19, 0x5d, 0x9f, 0xd9, 0x7b, 0xf6, 0x6e, 0x1d, 0x44, 0x77, 0x97, 0x40, 0x92, 0x69,
-  0xdd, 0xfc, 0xfe, 0x3f, 0x6a, 0x21, 0x7a, 0x02, 0x47, 0xf7, 0x5d, 0x2d, 0xc4, 0x5b, 0x32, 0xfa,
-  0x7c, 0x74, 0xb5, 0xf7, 0xce, 0xda, 0xa9, 0x05, 0x79, 0xa7, 0x40, 0x76, 0x37, 0x12, 0xdc, 0x83,
-  0x71, 0xe1, 0xc8, 0x2d, 0xbb, 0x16, 0x02, 0x86, 0x74, 0x70, 0x71, 0x60, 0x5b, 0xdd, 0x5a, 0x88,
-  0x2e, 0x19, 0x9d, 0x5e, 0x1c, 0xef, 0xed, 0x59, 0x6f, 0x6b, 0x41, 0x76, 0x39, 0xc8, 0xdb, 0xbd,
-  0x7a, 0x8a, 0x7b, 0x3b, 0x64, 0x74, 0xf1, 0x6e, 0xcf, 0xae, 0x05, 0xb0, 0xdf, 0x09, 0x52, 0x6d,
-  0x5b, 0xfb, 0x32, 0xf7, 0x12, 0x56, 0x07, 0xb7, 0x0b, 0x43, 0x3a, 0x0f, 0x3a, 0xe7, 0xd3, 0x69,
-  0x2d, 0x04, 0x0c, 0xe9, 0xe2, 0xcb, 0xd9, 0x0b, 0x68, 0xba, 0x02, 0xe8, 0xe8, 0xe8, 0xba, 0x16,
-  0x64, 0x47, 0x80, 0x00, 0x83, 0x6b, 0x41, 0x76, 0x53, 0x90, 0xda, 0x39, 0xd8, 0xed, 0xa5, 0x30,
-  0xcd, 0x7c, 0x6f, 0x7f, 0xde, 0xef, 0xb8, 0x5b, 0xad, 0xd6, 0x1a, 0xf0, 0xdb, 0x0c, 0xf8, 0x38,
-  0x07, 0xdd, 0x6a, 0x01, 0x38, 0x7b, 0xf3, 0x0c, 0xca, 0x51, 0x6c, 0xb0, 0x07, 0xec, 0x38, 0x3e,
-  0xbe, 0xc0, 0x06, 0x9a, 0x1e, 0xb0, 0xe4, 0x2e, 0x8c, 0x6e, 0x8c, 0xac, 0x8f, 0xa0, 0xb2, 0x97,
-  0x3d, 0xe0, 0xd0, 0x7b, 0xbb, 0xbd, 0x63, 0x57, 0x37, 0x13, 0x9d, 0x95, 0xbb, 0x02, 0x96, 0x1d,
-  0x44, 0x49, 0xeb, 0x13, 0x4b, 0x6a, 0xbb, 0x5b, 0x6f, 0xb2, 0x97, 0x52, 0xf7, 0xa5, 0x1a, 0xbe,
-  0x23, 0x34, 0x74, 0x84, 0xde, 0x00, 0x7e, 0xa2, 0x9d, 0xf0, 0x26, 0x0e, 0x71, 0x43, 0xa1, 0xf4,
-  0xdc, 0xbc, 0x3b, 0x44, 0xda, 0xf7, 0xbe, 0x8c, 0x36, 0x46, 0x47, 0x18, 0x4e, 0x68, 0xe7, 0xd1,
-  0x84, 0x45, 0x25, 0x7b, 0x71, 0x74, 0xce, 0x9b, 0x96, 0x89, 0x01, 0x4e, 0x7d, 0xbc, 0x3c, 0xac,
-  0x27, 0x16, 0x98, 0x92, 0x9f, 0xea, 0xd2, 0x77, 0x18, 0xfe, 0xe1, 0xe5, 0xc7, 0xfa, 0xef, 0x20,
-  0x2e, 0x97, 0x87, 0x1b, 0xbe, 0x83, 0xac, 0x1c, 0x7e, 0xbc, 0xac, 0xff, 0x0e, 0x72, 0xf2, 0xf1,
-  0xf0, 0xb2, 0x92, 0x39, 0x1d, 0xe0, 0x4b, 0x9e, 0x3d, 0x13, 0x6f, 0x86, 0x83, 0xbc, 0x2b, 0x31,
-  0x88, 0xfb, 0xba, 0xd1, 0xd5, 0x1d, 0x5d, 0xf6, 0xb5, 0x22, 0x5b, 0xbe, 0x48, 0xb6, 0x94, 0x99,
-  0xf2, 0x09, 0xda, 0xd4, 0x6a, 0x25, 0x28, 0xa5, 0xb6, 0xad, 0xd5, 0x2a, 0x40, 0x57, 0x7c, 0xff,
-  0x58, 0x6b, 0x31, 0xc5, 0xf7, 0x6c, 0x54, 0x2f, 0x8e, 0xc9, 0xaf, 0x19, 0xd3, 0x91, 0x1f, 0xba,
-  0x37, 0xeb, 0x83, 0xba, 0xba, 0xa8, 0x1b, 0xd4, 0x95, 0x1f, 0xde, 0xb1, 0x38, 0xd9, 0x30, 0x2e,
-  0x84, 0xd8, 0x30, 0xac, 0x4f, 0x61, 0xb4, 0xa0, 0xfe, 0x86, 0x71, 0x7d, 0xa0, 0xf5, 0xe8, 0x77,
-  0xc5, 0xe7, 0x02, 0x01, 0x55, 0x03, 0xc7, 0x3f, 0xf1, 0x92, 0x06, 0x9c, 0x01, 0xcb, 0x78, 0x22,
-  0x46, 0x23, 0xd6, 0x79, 0xa0, 0x01, 0x7c, 0x19, 0x69, 0x43, 0xb1, 0x71, 0x8c, 0xa5, 0x39, 0x0e,
-  0x09, 0x56, 0x8b, 0x31, 0x8b, 0x88, 0x72, 0x8d, 0x57, 0x42, 0x4b, 0xb0, 0xb5, 0x1f, 0x8b, 0x67,
-  0xe9, 0x53, 0x7d, 0x4d, 0xa4, 0x63, 0x44, 0xc3, 0x95, 0x04, 0xe0, 0x08, 0x86, 0xc8, 0xa8, 0xf9,
-  0xef, 0x6c, 0xa2, 0xa8, 0xfc, 0xf9, 0x51, 0xc5, 0x42, 0xd4, 0xe0, 0x0e, 0x96, 0xf7, 0x04, 0xfe,
-  0x38, 0x97, 0xc8, 0x21, 0xd2, 0x6f, 0x0e, 0xba, 0xdb, 0x01, 0xee, 0x81, 0x0d, 0x88, 0xa6, 0x16,
-  0x83, 0xb5, 0xce, 0x68, 0x3b, 0x18, 0xc7, 0xcb, 0x41, 0x79, 0x0e, 0xdd, 0x5a, 0xc5, 0x3d, 0xe5,
-  0x71, 0x45, 0x7f, 0xe3, 0xa0, 0x8e, 0x8a, 0x03, 0x91, 0x23, 0xb0, 0xe5, 0x08, 0x78, 0xd4, 0x7e,
-  0x71, 0xf8, 0x4c, 0xb2, 0xa9, 0xcc, 0x48, 0x4a, 0x87, 0x80, 0xb4, 0x12, 0xa0, 0x50, 0x30, 0x5b,
-  0x1a, 0x97, 0x4e, 0x89, 0xe3, 0x96, 0xe4, 0x38, 0x5f, 0xa4, 0x97, 0x0c, 0xdf, 0x44, 0x9a, 0x25,
-  0x48, 0x4b, 0xfb, 0x53, 0x01, 0xcc, 0x5a, 0x74, 0x62, 0x0c, 0x20, 0x4a, 0xff, 0xbc, 0x9c, 0xe8,
-  0xc9, 0xdc, 0x8b, 0x81, 0x67, 0x9d, 0x62, 0xaf, 0xb6, 0xec, 0xf5, 0x15, 0x1d, 0xda, 0x05, 0x5e,
-  0xfc, 0xcd, 0x7e, 0xba, 0xaf, 0xef, 0xa7, 0xfb, 0xef, 0xf4, 0xb3, 0xf3, 0xfa, 0x7e, 0x76, 0xfe,
-  0x9d, 0x7e, 0x76, 0x5f, 0xdf, 0xcf, 0xee, 0xdf, 0xef, 0x67, 0x4d, 0x86, 0xa3, 0x5a, 0x19, 0x46,
-  0x69, 0xca, 0xa8, 0x82, 0xa4, 0x48, 0x50, 0xa5, 0x16, 0x79, 0x25, 0x75, 0x6b, 0x32, 0xce, 0xd7,
-  0x58, 0xc7, 0xe1, 0xbd, 0xa2, 0xf0, 0xe8, 0x0f, 0x35, 0x96, 0x6a, 0x33, 0x18, 0x6f, 0xec, 0xfe,
-  0xea, 0xc6, 0x5b, 0x6a, 0x53, 0x2f, 0x82, 0xd4, 0x0b, 0x03, 0xfc, 0x8d, 0xfa, 0x74, 0x75, 0x2a,
-  0x78, 0x51, 0xb0, 0x03, 0x90, 0x74, 0x92, 0xcc, 0x5a, 0xae, 0xe9, 0x4d, 0x2d, 0x51, 0xd3, 0x8d,
-  0x44, 0x41, 0x48, 0xa6, 0x5d, 0xb2, 0x69, 0xc4, 0xe2, 0x4c, 0xc1, 0x39, 0x87, 0xa6, 0x82, 0x80,
-  0x6a, 0x46, 0x5c, 0x7e, 0xd8, 0xcc, 0x08, 0xba, 0xb1, 0xcf, 0x83, 0x55, 0x12, 0xb6, 0x5c, 0xea,
-  0xbb, 0x2b, 0x9f, 0x26, 0x4c, 0xbb, 0xc3, 0x90, 0x0f, 0x0b, 0x75, 0x21, 0x65, 0xf4, 0xb5, 0x69,
-  0x14, 0x2e, 0x30, 0xf4, 0xe8, 0x8b, 0x19, 0xcb, 0x3b, 0x8e, 0x83, 0x2f, 0x55, 0x8e, 0xc3, 0xda,
-  0xe4, 0x0b, 0xed, 0xd1, 0x61, 0xe4, 0xcd, 0xe6, 0x09, 0x8b, 0x6a, 0x00, 0xba, 0xa3, 0x03, 0xd7,
-  0xc5, 0x42, 0xc0, 0x3a, 0x0c, 0x3b, 0xa3, 0xe3, 0x55, 0xad, 0x4b, 0xd9, 0x1d, 0x9d, 0xd1, 0xfb,
-  0xb2, 0xb7, 0x10, 0x26, 0x36, 0x65, 0x0e, 0xff, 0xfb, 0x7d, 0xe0, 0x41, 0x52, 0x1c, 0xb3, 0x28,
-  0x39, 0x98, 0xfc, 0xa0, 0x2e, 0xa4, 0x71, 0x98, 0x1d, 0xeb, 0x64, 0xcc, 0x20, 0x21, 0x67, 0x2c,
-  0x98, 0x10, 0xd3, 0x37, 0x9e, 0x65, 0x8a, 0xa6, 0x27, 0x5f, 0x5b, 0x2d, 0xfa, 0xad, 0x1d, 0xb1,
-  0x45, 0x78, 0xcb, 0x74, 0xc3, 0x84, 0x5f, 0x72, 0x15, 0xae, 0x59, 0xca, 0x9f, 0xe9, 0x30, 0xcd,
-  0xf1, 0x5a, 0x76, 0xf5, 0xe2, 0x4e, 0xab, 0xdc, 0x68, 0x54, 0x5e, 0x07, 0x0a, 0x9e, 0x9e, 0x78,
-  0xc9, 0x44, 0x21, 0x17, 0x3d, 0x3a, 0x3f, 0xd3, 0x81, 0xc9, 0x90, 0x8c, 0xe2, 0xa6, 0xb4, 0x95,
-  0xd5, 0xa4, 0xd5, 0xe5, 0xa3, 0x6e, 0xb8, 0xf8, 0x0b, 0x5e, 0x46, 0x0f, 0xd0, 0x67, 0x3e, 0x23,
-  0x85, 0xa4, 0x0f, 0x97, 0x4a, 0x65, 0xde, 0x59, 0xc8, 0x2e, 0xb3, 0x26, 0x9b, 0x72, 0x4c, 0x4d,
-  0xb8, 0xd8, 0x4d, 0x6a, 0xf3, 0xcf, 0x9c, 0x6f, 0xbd, 0x7f, 0x95, 0x6f, 0x7d, 0xdb, 0xeb, 0xed,
-  0xf4, 0x72, 0xce, 0x95, 0x3d, 0xaf, 0x29, 0x56, 0xce, 0x79, 0x3a, 0x84, 0xa4, 0xde, 0xf3, 0x15,
-  0x3e, 0xf1, 0x9f, 0x47, 0x39, 0x62, 0xdc, 0x8d, 0xfe, 0x71, 0x9d, 0x8a, 0xe0, 0xb9, 0xd0, 0xeb,
-  0xba, 0xaa, 0x4b, 0x85, 0xfb, 0x5b, 0x71, 0x36, 0xa7, 0x42, 0x06, 0xe8, 0x92, 0xbe, 0xff, 0xff,
-  0x62, 0x6e, 0xa5, 0x6c, 0xdc, 0x76, 0x48, 0xb5, 0x93, 0xfb, 0xc4, 0x42, 0xc2, 0x3c, 0x16, 0xf3,
-  0xc5, 0xa9, 0x8d, 0x7a, 0xe8, 0x49, 0x55, 0xbb, 0x0f, 0x49, 0x93, 0xaa, 0x55, 0xf0, 0xc4, 0x1c,
-  0x27, 0x01, 0x2a, 0x03, 0xc8, 0xa2, 0xac, 0x63, 0xca, 0xf4, 0x04, 0xf4, 0x14, 0x3f, 0x65, 0xa5,
-  0x4c, 0xaf, 0x50, 0x0e, 0xd0, 0xa8, 0xb4, 0x4a, 0xd0, 0xda, 0x72, 0x70, 0xe3, 0x53, 0x67, 0x5f,
-  0x83, 0x96, 0x9d, 0x53, 0x7b, 0xd9, 0x25, 0xbc, 0x14, 0x5d, 0x1a, 0xf9, 0x2e, 0x63, 0x96, 0x70,
-  0xe5, 0x34, 0x1e, 0xd1, 0x62, 0xac, 0x95, 0xdc, 0xcb, 0x42, 0x0a, 0xac, 0x27, 0x61, 0xb8, 0xd6,
-  0xfa, 0x2a, 0x92, 0x0c, 0x96, 0x76, 0x3d, 0x90, 0x5d, 0x17, 0x4a, 0x83, 0xc5, 0x2b, 0xe8, 0x30,
-  0xe5, 0x29, 0x18, 0x88, 0x72, 0x3d, 0xd8, 0xb0, 0x48, 0x4b, 0xb5, 0x49, 0xc2, 0xd6, 0xd0, 0x59,
-  0xb9, 0x75, 0xd9, 0x30, 0x15, 0xec, 0xd1, 0x61, 0x12, 0x88, 0xda, 0x64, 0x65, 0x89, 0x38, 0x36,
-  0x20, 0x2d, 0xce, 0xaf, 0x3a, 0x9a, 0x1e, 0x2f, 0x15, 0x6d, 0x5e, 0xf1, 0x5d, 0xa2, 0x36, 0x3a,
-  0x95, 0xa3, 0x39, 0x8d, 0x8e, 0xc2, 0x09, 0xd3, 0x71, 0xf9, 0xd0, 0xda, 0xdf, 0xdd, 0xeb, 0xf7,
-  0x7a, 0x46, 0x13, 0xf8, 0x44, 0x9b, 0xce, 0xf7, 0xc3, 0x55, 0x92, 0x84, 0xbc, 0x24, 0xf1, 0x59,
-  0x14, 0x7f, 0x6c, 0x52, 0xec, 0x9f, 0x1f, 0xbd, 0xf5, 0xa5, 0x2d, 0x23, 0x55, 0xed, 0xfb, 0xb8,
-  0xa8, 0xc7, 0xa3, 0xef, 0x58, 0x43, 0xf2, 0x5d, 0xba, 0x84, 0x82, 0x3f, 0xfb, 0xf9, 0x91, 0x1c,
-  0xbe, 0x7f, 0x15, 0x8d, 0x29, 0x9a, 0x92, 0xa6, 0x02, 0xc9, 0x96, 0x83, 0x5b, 0xc8, 0x6a, 0xd1,
-  0x0c, 0xab, 0x56, 0x9e, 0x47, 0xc7, 0x72, 0x93, 0x26, 0x55, 0x92, 0xca, 0xe6, 0x5d, 0x6c, 0xde,
-  0xad, 0x68, 0x7e, 0xb1, 0x8a, 0xe7, 0x63, 0xce, 0x92, 0xcd, 0x08, 0x76, 0x10, 0xc1, 0x4e, 0x0d,
-  0x02, 0xcd, 0x93, 0x7b, 0xea, 0x9b, 0x71, 0xec, 0x22, 0x8e, 0xdd, 0x0a, 0x1c, 0x57, 0xbc, 0x4e,
-  0x6f, 0x73, 0xe3, 0x1e, 0x36, 0xee, 0x55, 0x11, 0x70, 0x72, 0xa9, 0xc5, 0x2c, 0x88, 0xc3, 0x68,
-  0x33, 0x82, 0xb7, 0x88, 0xe0, 0x6d, 0x05, 0x82, 0xeb, 0x70, 0xf5, 0x52, 0xe7, 0xbf, 0x61, 0xdb,
-  0xdf, 0x2a, 0xda, 0x1e, 0x04, 0xd4, 0x0f, 0x67, 0x9b, 0x1b, 0xef, 0x61, 0xe3, 0xbd, 0xda, 0xc6,
-  0x35, 0xcc, 0x23, 0xa9, 0xa9, 0x23, 0x02, 0x29, 0x0f, 0x69, 0xa5, 0x23, 0x80, 0x38, 0x06, 0xc6,
-  0xdb, 0xd7, 0x96, 0xa1, 0x17, 0x40, 0xc4, 0x33, 0xe0, 0x32, 0xca, 0xab, 0x6e, 0x08, 0x9e, 0x56,
-  0x79, 0x83, 0x72, 0xfb, 0xc6, 0x50, 0x3e, 0x6c, 0xfb, 0xa7, 0xfb, 0xee, 0x6f, 0x76, 0x6f, 0xa0,
-  0x02, 0x73, 0x30, 0x99, 0x72, 0x6b, 0x69, 0x5d, 0x99, 0x9c, 0x5c, 0xa5, 0x5a, 0x32, 0xf3, 0xaf,
-  0x3c, 0x34, 0x01, 0x7a, 0xe1, 0x08, 0x10, 0x33, 0x9e, 0x9e, 0xf4, 0xe2, 0x21, 0xa0, 0xf5, 0x62,
-  0xcf, 0xf4, 0xdc, 0xc8, 0x23, 0x1a, 0x26, 0x61, 0x28, 0xb7, 0x6c, 0x8c, 0x2b, 0x06, 0xe0, 0xce,
-  0x36, 0x2f, 0x6f, 0x2b, 0x3b, 0x19, 0x60, 0x59, 0x42, 0x79, 0x8b, 0x91, 0x1b, 0x48, 0xe3, 0x6f,
-  0xac, 0xed, 0x07, 0xc5, 0x25, 0xfa, 0xad, 0x8a, 0x6d, 0xcb, 0x40, 0xe1, 0x43, 0xb3, 0x8c, 0x85,
-  0xa1, 0xf9, 0x04, 0x3b, 0xf8, 0x86, 0x4b, 0xf3, 0x72, 0xef, 0x31, 0xb6, 0x08, 0x00, 0x59, 0x65,
-  0x24, 0xb8, 0x97, 0x58, 0x8f, 0xc3, 0xe2, 0x38, 0x04, 0xc7, 0x63, 0x2f, 0x57, 0x39, 0xca, 0x4c,
-  0xc5, 0xe4, 0x8c, 0x79, 0xab, 0x25, 0x9e, 0x6a, 0xf9, 0xe0, 0xf9, 0x78, 0xba, 0x48, 0x56, 0x1f,
-  0x07, 0xec, 0x4e, 0xfb, 0xe7, 0xd9, 0xe9, 0xef, 0x49, 0xb2, 0xbc, 0x84, 0x58, 0x81, 0xc5, 0xc9,
-  0x20, 0xa8, 0x3f, 0xc1, 0x93, 0x3b, 0x1e, 0x92, 0x1d, 0x5e, 0xc1, 0x54, 0x0a, 0x4c, 0x7e, 0xbc,
-  0x0c, 0xc1, 0x23, 0x5e, 0xb3, 0xfb, 0xc4, 0xe4, 0x6f, 0x80, 0xcc, 0x64, 0x15, 0x63, 0x39, 0x0b,
-  0x0c, 0xd2, 0x00, 0x4f, 0x55, 0x7f, 0x0c, 0x27, 0xc3, 0xcb, 0xf2, 0x88, 0xb1, 0x88, 0x9a, 0xba,
-  0x37, 0xe6, 0x96, 0x42, 0x20, 0x0e, 0x75, 0x5d, 0x9c, 0xc3, 0x6c, 0x9a, 0xa4, 0x23, 0x86, 0x23,
-  0xf7, 0xad, 0x12, 0x3e, 0x92, 0x0f, 0x61, 0xb4, 0xc0, 0xfa, 0x3d, 0xb5, 0x5d, 0x92, 0xc8, 0xd3,
-  0x49, 0x3a, 0xc1, 0x12, 0x6e, 0x59, 0x53, 0xcc, 0xab, 0xb9, 0xf1, 0x5c, 0x4f, 0x0c, 0xec, 0xc3,
-  0xa3, 0x3d, 0x41, 0x3b, 0x46, 0x98, 0xc4, 0x30, 0x2b, 0xaa, 0xbd, 0xb7, 0xd6, 0xce, 0x5e, 0x1d,
-  0x4d, 0x67, 0x29, 0xf7, 0xcc, 0x64, 0x40, 0xd4, 0x47, 0x02, 0x5a, 0x08, 0x66, 0x1e, 0xbc, 0xa4,
-  0x3c, 0x31, 0x86, 0x7c, 0xbe, 0x64, 0x14, 0x02, 0xa8, 0x7d, 0x18, 0x09, 0xef, 0x6f, 0x9f, 0xa5,
-  0xfd, 0xee, 0xeb, 0xe8, 0xb9, 0x53, 0x2a, 0x74, 0x49, 0x7f, 0xda, 0x06, 0x8b, 0xdd, 0xb0, 0x3b,
-  0x27, 0xcf, 0x1a, 0x51, 0xd8, 0xc9, 0xda, 0x20, 0x00, 0x20, 0x94, 0xc8, 0xf3, 0x95, 0x9f, 0xc8,
-  0xe1, 0xf3, 0x33, 0x08, 0x5c, 0x78, 0xf4, 0x80, 0x6f, 0xc3, 0x24, 0xed, 0xf9, 0x1d, 0xdf, 0xe8,
-  0xc2, 0x07, 0x90, 0xfd, 0x49, 0xa6, 0x33, 0x58, 0x12, 0x4a, 0xc1, 0x37, 0x80, 0xd7, 0x6a, 0x1a,
-  0x6a, 0xab, 0x08, 0xa4, 0x79, 0xa0, 0x40, 0x31, 0xb8, 0x49, 0x2b, 0x3d, 0xa4, 0xa7, 0x74, 0x46,
-  0x8f, 0x0a, 0xd4, 0x16, 0x71, 0x41, 0x86, 0x8a, 0x61, 0x71, 0x88, 0xd2, 0x2f, 0x44, 0x5a, 0xa5,
-  0x35, 0xdf, 0x79, 0x3a, 0x8a, 0xfe, 0xec, 0x7b, 0xae, 0xa4, 0x8d, 0x37, 0xfd, 0x4a, 0xbf, 0x0d,
-  0x6a, 0xf7, 0xc2, 0x82, 0x02, 0x34, 0x32, 0xd9, 0xac, 0xdd, 0xa3, 0x2b, 0xc2, 0x72, 0x4d, 0x31,
-  0x5f, 0x53, 0x40, 0x2c, 0xa2, 0xa8, 0x6a, 0xd0, 0xa3, 0xf3, 0x75, 0xd0, 0x10, 0xc3, 0x62, 0xf3,
-  0x35, 0x65, 0xc6, 0x48, 0x04, 0x64, 0xec, 0xd5, 0xb0, 0x97, 0x1f, 0x14, 0x6c, 0xaa, 0xb5, 0x30,
-  0xa7, 0xd3, 0x1a, 0x2a, 0xfe, 0xa8, 0x02, 0xbe, 0x7d, 0x36, 0x9e, 0xd5, 0x14, 0x43, 0x30, 0x84,
-  0xb5, 0x10, 0x2a, 0xa4, 0xc3, 0x93, 0x5f, 0xe2, 0x6d, 0xa1, 0x66, 0x47, 0x65, 0x63, 0x92, 0x39,
-  0x62, 0xdc, 0x72, 0x48, 0x5c, 0xcd, 0x78, 0x2b, 0xb0, 0xde, 0x2a, 0xc9, 0x52, 0xbf, 0x07, 0x07,
-  0x51, 0x44, 0x1f, 0xda, 0x5e, 0xcc, 0xff, 0xea, 0x3c, 0x11, 0x35, 0x54, 0x15, 0x68, 0xc9, 0xda,
-  0x13, 0x88, 0x4d, 0xbd, 0x7a, 0x31, 0xc2, 0x00, 0x0c, 0xbb, 0xc5, 0xb9, 0x47, 0x25, 0xe4, 0xd3,
-  0x8a, 0xa5, 0x42, 0x95, 0x63, 0xbf, 0x06, 0xeb, 0x9d, 0xb1, 0xd4, 0x6b, 0x27, 0xc9, 0x33, 0xa7,
-  0xca, 0x8b, 0xea, 0x2a, 0x49, 0x4f, 0x2e, 0xf3, 0x2d, 0x24, 0x30, 0xf6, 0x56, 0xdd, 0xc1, 0xc9,
-  0x75, 0x15, 0x38, 0xa7, 0x49, 0xf0, 0x23, 0x62, 0x10, 0x56, 0xd6, 0x75, 0x76, 0x79, 0x5a, 0x6a,
-  0xcd, 0xe1, 0xeb, 0xfb, 0xbb, 0x3c, 0x23, 0x85, 0xa9, 0xcc, 0xb5, 0x01, 0x97, 0xad, 0x32, 0x03,
-  0x13, 0x55, 0x9c, 0x4e, 0x0e, 0x62, 0x34, 0xaa, 0xa0, 0xd5, 0x46, 0x5f, 0x1e, 0x42, 0xbc, 0xf0,
-  0x19, 0x56, 0xe8, 0xcb, 0x38, 0x90, 0x6a, 0xa8, 0xfb, 0xfc, 0xa4, 0xa2, 0x58, 0x19, 0xda, 0x22,
-  0x29, 0xe4, 0x35, 0x58, 0x62, 0x6d, 0x1c, 0x85, 0x77, 0x90, 0xab, 0x68, 0x93, 0x90, 0xc5, 0x78,
-  0x82, 0x0a, 0x4b, 0x00, 0xc2, 0x08, 0xc2, 0xd2, 0x39, 0xd3, 0xbe, 0x73, 0x13, 0xf4, 0x5d, 0x5b,
-  0x46, 0x60, 0x5c, 0xc1, 0xa3, 0x60, 0x98, 0xcf, 0x31, 0xf1, 0xc8, 0x35, 0xc6, 0x03, 0x25, 0x2c,
-  0xab, 0xfb, 0xcd, 0xd0, 0x32, 0x01, 0x75, 0x70, 0x71, 0xa2, 0x79, 0x79, 0xa4, 0x7c, 0x29, 0x56,
-  0x4b, 0xf2, 0xdd, 0x3e, 0x80, 0xa9, 0xca, 0x9f, 0x8f, 0x2d, 0x1e, 0xd0, 0xe4, 0x46, 0x8d, 0x39,
-  0x5f, 0x71, 0xca, 0x4c, 0x64, 0xe5, 0xb7, 0x41, 0x5e, 0xa2, 0x4a, 0xd5, 0x68, 0x6f, 0x44, 0x15,
-  0x62, 0x21, 0xa4, 0xfe, 0xf6, 0x26, 0xab, 0x4b, 0x0b, 0x78, 0x5d, 0x1a, 0x2f, 0xb4, 0x0a, 0x78,
-  0x9d, 0x17, 0x48, 0x55, 0x9a, 0xc5, 0x24, 0x22, 0x8b, 0x01, 0x23, 0xcf, 0xe4, 0x8c, 0x60, 0x21,
-  0x9a, 0x42, 0xe3, 0x80, 0x09, 0xe7, 0x93, 0xbe, 0xbd, 0xcd, 0x60, 0x1e, 0x5c, 0x7f, 0x05, 0x89,
-  0x07, 0xe8, 0x16, 0xc7, 0xa2, 0x08, 0x4d, 0xfd, 0x73, 0xa2, 0x8a, 0xda, 0xa9, 0x03, 0x02, 0xad,
-  0x46, 0x24, 0xc1, 0x4d, 0x2b, 0x33, 0x91, 0x58, 0xce, 0x07, 0xd1, 0x49, 0xae, 0xd0, 0x4f, 0x84,
-  0x20, 0xfc, 0x74, 0x11, 0x2f, 0xc5, 0x4b, 0xfb, 0x82, 0x39, 0x56, 0xf5, 0x64, 0x03, 0x71, 0x0c,
-  0x02, 0xd7, 0x72, 0xf0, 0xa4, 0xe7, 0x2a, 0xc0, 0x43, 0x6f, 0x18, 0xdc, 0x35, 0x03, 0x79, 0xf2,
-  0x1a, 0x9a, 0x4d, 0xd8, 0xfd, 0xf9, 0x14, 0x5a, 0x8d, 0x1c, 0x6b, 0x7b, 0x3b, 0xd8, 0x92, 0xcb,
-  0x3e, 0x10, 0xe1, 0xf1, 0x23, 0x72, 0xc4, 0xc8, 0xce, 0x63, 0xe7, 0xfb, 0x50, 0x30, 0xfa, 0x65,
-  0xe7, 0xdc, 0x20, 0xe2, 0x24, 0x84, 0x87, 0x83, 0x38, 0xe7, 0x41, 0xa2, 0x4e, 0xcd, 0xc4, 0x04,
-  0x1f, 0x12, 0x38, 0x78, 0x1e, 0xc6, 0x4b, 0x8b, 0x47, 0x21, 0xd2, 0xe8, 0xa7, 0x3d, 0xe7, 0x91,
-  0x79, 0xb9, 0x72, 0x2e, 0x70, 0xd5, 0xcf, 0x7f, 0xb7, 0x8c, 0x50, 0x2e, 0xc9, 0x4a, 0xfd, 0xaf,
-  0x6c, 0xdb, 0x86, 0x08, 0x4e, 0x88, 0x64, 0x3b, 0xce, 0x55, 0xa0, 0x16, 0xd0, 0x60, 0x01, 0x9e,
-  0xc3, 0xd2, 0x23, 0x65, 0xb2, 0x36, 0x11, 0x39, 0x03, 0xd6, 0x0e, 0x9d, 0x3a, 0x18, 0x46, 0x7c,
-  0xa9, 0x60, 0x0a, 0x67, 0x71, 0x53, 0x1a, 0xa4, 0x93, 0xcd, 0xd5, 0x31, 0xe6, 0x9a, 0x1a, 0x83,
-  0x4a, 0x4c, 0x72, 0xae, 0x98, 0x98, 0x7a, 0x0a, 0x71, 0xeb, 0xe0, 0xff, 0xc9, 0x38, 0x18, 0x4a,
-  0xd0, 0xb0, 0xdb, 0xeb, 0xa5, 0x27, 0x2f, 0xb3, 0xa1, 0xc8, 0x59, 0x7c, 0x05, 0xef, 0x53, 0x6d,
-  0xf0, 0x51, 0x1b, 0x3c, 0xc3, 0xe7, 0x27, 0x5b, 0x84, 0x75, 0xc7, 0xfc, 0x51, 0xf7, 0xdb, 0x22,
-  0x5b, 0x88, 0x8b, 0x27, 0x30, 0x78, 0x13, 0x87, 0x66, 0x93, 0x9f, 0x9e, 0xb6, 0x50, 0x4f, 0xfc,
-  0x68, 0x6a, 0xfa, 0x2c, 0x69, 0x7b, 0x7a, 0xf2, 0x51, 0x48, 0x5a, 0xf6, 0x96, 0x23, 0x3f, 0xed,
-  0x03, 0x3c, 0xd6, 0xd3, 0xa9, 0xdf, 0x66, 0xd6, 0x7c, 0x4d, 0x9a, 0x6c, 0xc3, 0xd4, 0x6b, 0xf0,
-  0x15, 0x84, 0xce, 0x14, 0x08, 0x51, 0xa8, 0x21, 0x30, 0xf7, 0xf7, 0x09, 0x84, 0x29, 0xa4, 0x9f,
-  0x18, 0x95, 0x0a, 0x50, 0x3a, 0x2d, 0x22, 0xd0, 0x29, 0x04, 0x52, 0x2b, 0x8c, 0xbe, 0x24, 0x52,
-  0xa9, 0x5e, 0x41, 0x5c, 0xf2, 0x1a, 0x9f, 0xca, 0x4c, 0xf9, 0x14, 0x3e, 0xe7, 0x3a, 0x70, 0x3c,
-  0x10, 0xe7, 0xa7, 0x31, 0xf0, 0xc5, 0x28, 0x58, 0x27, 0x62, 0x22, 0xd4, 0xe1, 0xfd, 0x9a, 0xd3,
-  0xff, 0x3c, 0x8a, 0xdb, 0xde, 0x26, 0x27, 0x9f, 0x2e, 0x3e, 0x5f, 0x4b, 0xeb, 0x44, 0x67, 0xf8,
-  0x1d, 0x08, 0xe6, 0x47, 0xf5, 0x33, 0x93, 0xf5, 0xf4, 0x54, 0xb2, 0x62, 0xa9, 0xc9, 0x92, 0x96,
-  0x6a, 0x20, 0x4c, 0xd3, 0x5a, 0xe8, 0x06, 0x04, 0xa9, 0xc3, 0xfd, 0xb1, 0x8a, 0xe0, 0x9a, 0x4d,
-  0x9a, 0x79, 0xff, 0xec, 0x33, 0x46, 0x69, 0xe2, 0xa2, 0x80, 0x2d, 0x79, 0x10, 0x07, 0x88, 0xe3,
-  0xa8, 0xf3, 0x2f, 0xf8, 0x48, 0xf3, 0x2f, 0x78, 0x62, 0x99, 0x7b, 0x11, 0x14, 0x6f, 0x14, 0x10,
-  0xaf, 0x95, 0x0c, 0x18, 0xcf, 0xaa, 0xd2, 0x69, 0xed, 0xde, 0x01, 0x54, 0xbb, 0x16, 0x80, 0x10,
-  0x15, 0xb1, 0xe7, 0x3f, 0xaa, 0x65, 0x14, 0xf0, 0x20, 0xf9, 0xfd, 0x1d, 0x7e, 0x7d, 0x01, 0x4c,
-  0x37, 0x30, 0x56, 0xf2, 0x57, 0x9d, 0x5e, 0x17, 0xd7, 0x15, 0x60, 0x3c, 0x62, 0x06, 0x69, 0x8f,
-  0x2b, 0xdf, 0x2f, 0xcc, 0xb0, 0x34, 0x87, 0x72, 0xa1, 0x08, 0x26, 0x03, 0x21, 0xd0, 0x28, 0xca,
-  0xba, 0x31, 0x79, 0x84, 0xac, 0x34, 0xed, 0x42, 0x7b, 0x60, 0x7e, 0x69, 0xba, 0xec, 0x47, 0x85,
-  0x2c, 0x61, 0xc8, 0x93, 0xbf, 0x2f, 0x81, 0x66, 0xca, 0x18, 0xc0, 0x6c, 0x04, 0x10, 0x48, 0xbb,
-  0xf8, 0xe1, 0x53, 0x38, 0xc9, 0x66, 0x83, 0x3b, 0x8b, 0xfc, 0x07, 0xc8, 0x1c, 0x33, 0x9d, 0xc8,
-  0x99, 0x23, 0x6e, 0xe8, 0x8a, 0xa5, 0xfe, 0x41, 0xca, 0xcf, 0x5c, 0xfa, 0x7d, 0x95, 0x7a, 0x5d,
-  0x99, 0xaa, 0xf8, 0xa1, 0xcb, 0x0f, 0xa9, 0xf2, 0x6a, 0x6b, 0xf4, 0xeb, 0x7d, 0x82, 0xa8, 0xf9,
-  0x2d, 0x1b, 0x6e, 0xe8, 0x1b, 0xfc, 0xe2, 0x0d, 0xcb, 0xd4, 0xf9, 0xf5, 0x1d, 0x0e, 0x42, 0xfb,
-  0x57, 0x60, 0x59, 0xe8, 0x8c, 0xa1, 0xe8, 0x9e, 0x24, 0x6c, 0x81, 0x19, 0xa2, 0x7b, 0xb2, 0x04,
-  0xb5, 0x81, 0x14, 0x5e, 0x80, 0x41, 0xeb, 0xc5, 0x12, 0xb8, 0x81, 0x39, 0x8d, 0x76, 0x06, 0x74,
-  0xb7, 0x35, 0x19, 0xb7, 0x30, 0x5c, 0x58, 0xd0, 0xbe, 0x60, 0xd1, 0xe6, 0xc9, 0x05, 0x04, 0x2b,
-  0x66, 0x01, 0x63, 0x5c, 0xc4, 0x68, 0x72, 0x6c, 0x06, 0x58, 0x5e, 0xac, 0x4a, 0x56, 0x19, 0xd0,
-  0x92, 0x26, 0x73, 0x2e, 0x36, 0xc0, 0xd3, 0x76, 0xec, 0x7b, 0x2e, 0xd3, 0x6d, 0x90, 0x0a, 0x60,
-  0x6c, 0xfc, 0xc5, 0x4b, 0xe6, 0x3a, 0xe9, 0x10, 0x63, 0xbf, 0x65, 0xf7, 0x6f, 0x43, 0x6f, 0xa2,
-  0x59, 0x46, 0x3b, 0x5e, 0xfa, 0x5e, 0xc2, 0xdf, 0x0e, 0x54, 0x89, 0xdb, 0xa8, 0x8b, 0xc7, 0xd4,
-  0xd4, 0x5d, 0x22, 0xd9, 0x68, 0x4d, 0x39, 0x5a, 0x31, 0x0a, 0xd6, 0x9e, 0x87, 0x71, 0x82, 0x5d,
-  0x35, 0x81, 0xb9, 0x18, 0xe1, 0xec, 0x83, 0x13, 0x6e, 0x8a, 0x47, 0x2c, 0x1c, 0x6d, 0x02, 0xd2,
-  0x66, 0x02, 0xda, 0x6a, 0x3c, 0xcb, 0xab, 0x39, 0x4a, 0xb7, 0x84, 0x74, 0xe2, 0xf6, 0x8f, 0x78,
-  0x7f, 0xe9, 0x74, 0x09, 0x1e, 0x02, 0xe6, 0xc3, 0xe5, 0xa1, 0x24, 0xde, 0x77, 0xc1, 0x67, 0xc4,
-  0x29, 0x37, 0x01, 0xbb, 0x16, 0x93, 0xfc, 0x52, 0xad, 0x04, 0x49, 0x2f, 0x16, 0x41, 0xd2, 0xf7,
-  0x15, 0xf9, 0x40, 0x04, 0x50, 0xc1, 0x29, 0xe6, 0x34, 0xb1, 0xe7, 0xc6, 0xb0, 0x23, 0x2f, 0x7e,
-  0x19, 0x72, 0xfd, 0x1b, 0xfd, 0x37, 0x6f, 0xc1, 0x83, 0xbe, 0x55, 0x84, 0xee, 0x40, 0x94, 0xe6,
-  0xc6, 0x58, 0xf5, 0x09, 0x80, 0x1c, 0x60, 0xd8, 0x11, 0x37, 0xde, 0xe0, 0xa5, 0x1e, 0x9a, 0x4c,
-  0x3e, 0xc9, 0x15, 0xdf, 0x14, 0x04, 0x19, 0x5d, 0x34, 0xf8, 0xe2, 0x3f, 0x3e, 0xfd, 0x15, 0xa7,
-  0x1b, 0x8c, 0x53, 0xa2, 0x2d, 0x58, 0x32, 0x0f, 0x71, 0x8f, 0x16, 0xd8, 0x04, 0xa0, 0xb9, 0x0d,
-  0x99, 0x24, 0x04, 0xda, 0xee, 0x8a, 0xef, 0xe6, 0xcc, 0x5f, 0x1e, 0x92, 0x51, 0x63, 0x28, 0x16,
-  0x06, 0xe5, 0xca, 0xa8, 0xf8, 0x91, 0x5b, 0x69, 0xfa, 0x1d, 0xbb, 0xdd, 0x1f, 0x76, 0xc4, 0x87,
-  0x74, 0x2f, 0xbf, 0xaa, 0x4d, 0x23, 0x6d, 0x74, 0x88, 0x8d, 0x0e, 0xa9, 0x7b, 0x93, 0xb5, 0x2b,
-  0xb4, 0x90, 0x37, 0x89, 0x8c, 0xae, 0xe8, 0x2d, 0xcb, 0x40, 0xe6, 0x6a, 0x91, 0x7f, 0x38, 0xef,
-  0x8e, 0x1a, 0x28, 0x93, 0xdb, 0x74, 0xb1, 0x1c, 0x68, 0xbf, 0xd3, 0x08, 0x6b, 0x99, 0x31, 0xca,
-  0x4e, 0x56, 0x4b, 0x60, 0x4e, 0x77, 0x74, 0x1d, 0x26, 0xd4, 0x57, 0xdb, 0xae, 0xe9, 0x36, 0xb0,
-  0xef, 0x72, 0x52, 0x65, 0xc9, 0x46, 0xb6, 0x67, 0xed, 0xe2, 0x30, 0xb3, 0x65, 0xb1, 0xa1, 0x37,
-  0xba, 0x64, 0x90, 0x8c, 0x81, 0x89, 0x98, 0x40, 0x90, 0xbc, 0x0c, 0xef, 0x40, 0x07, 0x64, 0x31,
-  0x2e, 0x56, 0xd3, 0x8e, 0xc5, 0x16, 0x63, 0x9c, 0x88, 0xad, 0xcc, 0xfe, 0xb0, 0xe3, 0x89, 0x76,
-  0x63, 0xb9, 0xe5, 0xdc, 0x10, 0x95, 0x22, 0xab, 0xac, 0x37, 0xac, 0x5e, 0x2e, 0x6e, 0x49, 0xf3,
-  0xba, 0x59, 0xb9, 0x71, 0x91, 0xf6, 0xdc, 0x78, 0x1f, 0xa0, 0x9f, 0xd4, 0xe8, 0x2a, 0x09, 0xf1,
-  0x06, 0x10, 0x57, 0xf6, 0x15, 0xb0, 0x38, 0xd6, 0x7c, 0xbc, 0xa8, 0x83, 0x45, 0x2f, 0xec, 0x59,
-  0x1f, 0x1c, 0x32, 0xc9, 0x6a, 0xb9, 0x5a, 0x2d, 0x4f, 0x25, 0x8b, 0x7d, 0x29, 0x7e, 0x68, 0x59,
-  0xf4, 0xaa, 0xb6, 0x70, 0xf1, 0x38, 0x38, 0x6e, 0x6b, 0xe2, 0x45, 0x46, 0xda, 0xd1, 0x2a, 0x42,
-  0x13, 0x9c, 0xf6, 0x21, 0xaf, 0x2f, 0x3a, 0x3b, 0x20, 0x6b, 0x2b, 0xe3, 0x6b, 0x1b, 0x5b, 0xdd,
-  0x5e, 0xb6, 0xc1, 0x66, 0x59, 0xa5, 0xcd, 0xea, 0x74, 0x73, 0x6b, 0xd4, 0xd0, 0x16, 0x07, 0xc5,
-  0xee, 0xb3, 0xa3, 0xae, 0x0a, 0x29, 0xfe, 0xae, 0x29, 0x30, 0x6a, 0x6c, 0xff, 0xf4, 0x6e, 0x6f,
-  0x6f, 0x6f, 0xa0, 0xfd, 0x67, 0xb8, 0x8a, 0x8a, 0x33, 0x03, 0x12, 0x7c, 0x8b, 0xdb, 0x0f, 0xda,
-  0x1c, 0x38, 0xa6, 0xb9, 0x62, 0x20, 0x6d, 0xce, 0xd5, 0xeb, 0x50, 0x03, 0x95, 0x82, 0xef, 0x8c,
-  0x27, 0x52, 0x31, 0x9d, 0x32, 0x91, 0x3e, 0x3d, 0x20, 0x16, 0x2e, 0x35, 0x26, 0x02, 0x2e, 0x85,
-  0xd1, 0x83, 0x18, 0x02, 0xd3, 0x22, 0xf7, 0x46, 0x73, 0x91, 0x5f, 0x31, 0xff, 0xd6, 0x58, 0xac,
-  0xfc, 0xc4, 0x03, 0x08, 0xd9, 0xab, 0x17, 0xfc, 0x60, 0x32, 0x1e, 0xc5, 0xe5, 0xd7, 0x58, 0xa3,
-  0xc1, 0x04, 0xf2, 0xbb, 0x29, 0x34, 0xde, 0xca, 0xb6, 0xa3, 0x40, 0x94, 0x1a, 0x07, 0x6a, 0x32,
-  0xa9, 0x0f, 0x64, 0xf2, 0x59, 0x8c, 0xf3, 0xf3, 0x9a, 0x84, 0xb8, 0x55, 0xf9, 0x00, 0xa3, 0x0f,
-  0x63, 0x7e, 0x9b, 0x00, 0xd2, 0xc8, 0xc1, 0x04, 0xf5, 0xff, 0x60, 0x6c, 0xa9, 0xd1, 0x44, 0xdb,
-  0xf6, 0x93, 0x81, 0x7d, 0xa0, 0x79, 0x53, 0x41, 0x01, 0x96, 0xc8, 0xf3, 0x22, 0xf8, 0x09, 0x30,
-  0xd6, 0x4d, 0x50, 0x36, 0x71, 0x2b, 0x1d, 0x1b, 0x67, 0x55, 0xe8, 0x9c, 0x94, 0xc6, 0x09, 0x1f,
-  0x29, 0xbf, 0xe0, 0x22, 0xbd, 0x84, 0x00, 0x7c, 0x1c, 0x8b, 0x02, 0x50, 0x92, 0x3c, 0x13, 0x4d,
-  0x69, 0xf0, 0x91, 0x42, 0xbc, 0x2c, 0x27, 0x98, 0x09, 0x12, 0x74, 0x29, 0x17, 0x1a, 0x08, 0x3d,
-  0x5e, 0x4d, 0x03, 0x5a, 0xb1, 0x8a, 0xc1, 0x03, 0x28, 0xe5, 0x92, 0x13, 0xb7, 0x44, 0x1b, 0xb2,
-  0x0a, 0x6e, 0x02, 0x88, 0xb5, 0xa4, 0x54, 0x1b, 0x99, 0x72, 0x44, 0x42, 0x67, 0x6f, 0x43, 0x3f,
-  0xc1, 0x5b, 0x76, 0xf4, 0x33, 0x3c, 0x0e, 0x20, 0xe7, 0x89, 0xeb, 0x15, 0xd5, 0x90, 0x38, 0xe0,
-  0x30, 0x80, 0x19, 0x15, 0xf5, 0x00, 0xbc, 0xf4, 0x7e, 0x4d, 0xb6, 0xf1, 0x42, 0x81, 0x52, 0x69,
-  0x19, 0xd6, 0x4d, 0xa4, 0xa9, 0x50, 0xb6, 0xdc, 0x3e, 0x02, 0x9e, 0xc8, 0xb3, 0xf0, 0x9a, 0xde,
-  0xeb, 0x2d, 0x0e, 0x8c, 0x46, 0x6d, 0xe9, 0x58, 0x8f, 0x43, 0xb3, 0xe9, 0xd4, 0x73, 0xf1, 0x60,
-  0x87, 0xa6, 0xef, 0x20, 0xfc, 0xa6, 0xd2, 0xe4, 0x06, 0x56, 0xf1, 0xeb, 0x3b, 0xd6, 0x06, 0x30,
-  0x2c, 0xe8, 0x18, 0xc9, 0x9a, 0x7f, 0xdd, 0xee, 0x6e, 0x80, 0xc4, 0x9a, 0xe0, 0xc6, 0x11, 0x5f,
-  0x71, 0xaf, 0x28, 0x4e, 0x2b, 0x18, 0x12, 0x71, 0xa0, 0xbf, 0x46, 0x5d, 0x04, 0x0a, 0x71, 0xf2,
-  0x42, 0xb1, 0x1a, 0x0f, 0x4d, 0x00, 0x87, 0x53, 0x1d, 0x57, 0xcc, 0x5d, 0x57, 0xf1, 0x72, 0x2d,
-  0x0a, 0xb7, 0x6b, 0x3e, 0xad, 0xd7, 0x6e, 0xa5, 0xdc, 0xaa, 0xf6, 0x27, 0x13, 0x5e, 0xc5, 0x77,
-  0x2f, 0x27, 0x8a, 0x41, 0xbc, 0x82, 0x3f, 0x74, 0x1c, 0x02, 0x11, 0x5c, 0x13, 0xb1, 0x7f, 0x54,
-  0x4b, 0x14, 0xeb, 0x76, 0x2a, 0x38, 0xd2, 0xe4, 0xef, 0x8c, 0x1a, 0x25, 0x43, 0xbf, 0x93, 0xd9,
-  0x11, 0xac, 0x69, 0xe7, 0xb7, 0xaa, 0x89, 0xf3, 0x20, 0x71, 0x5f, 0xb5, 0x2b, 0x56, 0x17, 0x28,
-  0x3f, 0xd3, 0x28, 0xba, 0x26, 0xc4, 0xd0, 0xcc, 0x79, 0xb5, 0x74, 0xf9, 0x14, 0xa3, 0x00, 0x32,
-  0x6a, 0xa6, 0x4e, 0x48, 0xab, 0x71, 0x6d, 0x88, 0xa0, 0x55, 0x81, 0xa0, 0x25, 0x31, 0xb4, 0x72,
-  0x9e, 0x2e, 0xe2, 0x74, 0x9e, 0xf1, 0x43, 0x30, 0xda, 0xe7, 0xbc, 0x1e, 0xf1, 0x81, 0xc0, 0xd4,
-  0x5b, 0xca, 0x1d, 0x69, 0x9d, 0xfc, 0x17, 0x3b, 0xe7, 0xbe, 0x0e, 0x0b, 0x56, 0x94, 0x1f, 0x50,
-  0xd2, 0x1a, 0x95, 0x15, 0x02, 0xad, 0x31, 0x56, 0x65, 0x0e, 0xf8, 0x0d, 0x76, 0x7d, 0xdb, 0xb2,
-  0x96, 0xf7, 0x83, 0x39, 0x43, 0xeb, 0x03, 0x3f, 0xe0, 0x79, 0xcc, 0xd7, 0x13, 0x5b, 0x78, 0x82,
-  0x69, 0x15, 0xf7, 0xbb, 0xf0, 0x4a, 0xd5, 0xf9, 0x34, 0x0a, 0x5d, 0xe4, 0x0e, 0x0c, 0xfd, 0x4d,
-  0x43, 0x0d, 0x92, 0x04, 0xbd, 0x69, 0xd1, 0x0a, 0x86, 0x11, 0x08, 0x6b, 0x37, 0xf6, 0x20, 0xc8,
-  0x03, 0x13, 0x1c, 0x69, 0x3e, 0x9d, 0x69, 0x5e, 0x1c, 0xaf, 0x20, 0x88, 0xc6, 0xee, 0x3e, 0x83,
-  0x09, 0xf4, 0xb9, 0x55, 0x04, 0x15, 0xd7, 0x72, 0xee, 0x54, 0x9d, 0x30, 0x1a, 0x55, 0x1c, 0xfe,
-  0x51, 0x3c, 0x41, 0x23, 0x82, 0xf6, 0x6f, 0x8c, 0xbe, 0x99, 0xdd, 0x03, 0x00, 0xe8, 0xae, 0x5b,
-  0xb0, 0xc7, 0x20, 0x0e, 0x8d, 0xbc, 0x3c, 0x9c, 0xd1, 0x1b, 0x86, 0x86, 0x87, 0xcd, 0x16, 0xca,
-  0x0c, 0x31, 0xc8, 0xa2, 0x25, 0xe2, 0x17, 0x7c, 0xed, 0xd9, 0x15, 0x11, 0x4c, 0x92, 0x6a, 0x36,
-  0x5e, 0xc5, 0xa2, 0xea, 0x04, 0xc6, 0x39, 0x81, 0x40, 0x37, 0xae, 0x6d, 0x9f, 0xb3, 0x61, 0x62,
-  0xf3, 0x87, 0xef, 0xc3, 0xc8, 0x35, 0x46, 0xe9, 0xab, 0x63, 0x4f, 0x78, 0x6a, 0x64, 0xc9, 0xcc,
-  0x0f, 0xc7, 0x22, 0xa0, 0x81, 0x4e, 0xa6, 0xd3, 0x5c, 0x14, 0xd0, 0xa8, 0x26, 0xed, 0xf4, 0xb8,
-  0xb4, 0x63, 0x2d, 0xb4, 0x69, 0x5d, 0x1f, 0x70, 0x7a, 0x1b, 0xa2, 0x9a, 0xdb, 0x0f, 0xa3, 0xbf,
-  0xb8, 0x30, 0xfc, 0xb5, 0x80, 0xcc, 0x07, 0x27, 0x3a, 0x5f, 0x5b, 0xa2, 0xa9, 0x0d, 0xfe, 0x7e,
-  0xae, 0x00, 0x3c, 0xab, 0xb2, 0xa8, 0x63, 0x70, 0xb5, 0xbe, 0xa8, 0xd6, 0x58, 0x4f, 0x50, 0x50,
-  0x1a, 0xbe, 0x1c, 0x5e, 0x50, 0xb8, 0xc6, 0x66, 0x0c, 0x58, 0x53, 0x90, 0x61, 0x50, 0x85, 0x19,
-  0xeb, 0x0a, 0x57, 0x47, 0x9c, 0x1a, 0x09, 0x5f, 0xc2, 0x94, 0x50, 0x72, 0x2f, 0x5d, 0xe3, 0x9b,
-  0xaa, 0xdc, 0x43, 0x42, 0x2e, 0xd9, 0x5a, 0x2d, 0x3b, 0xb8, 0x84, 0xf0, 0x12, 0xdf, 0x4f, 0x2e,
-  0x04, 0x9f, 0xf9, 0x76, 0x32, 0x08, 0x23, 0x16, 0xda, 0x85, 0xfe, 0xa4, 0xa6, 0xbe, 0x20, 0x2b,
-  0x7d, 0x6c, 0x14, 0xac, 0xad, 0x8d, 0x21, 0x94, 0x40, 0x78, 0x7d, 0x9d, 0xb3, 0xaf, 0x88, 0xf9,
-  0xe4, 0x72, 0x53, 0xc5, 0x02, 0x47, 0xd3, 0xb2, 0x11, 0x21, 0x22, 0xda, 0xdd, 0x4b, 0x09, 0xbb,
-  0xdc, 0x54, 0xc2, 0xb0, 0xe6, 0x69, 0x4f, 0xae, 0xcb, 0xd2, 0xd3, 0x28, 0x57, 0x0d, 0x5d, 0x82,
-  0x09, 0x4b, 0x98, 0x36, 0x59, 0x2f, 0x3e, 0x28, 0xd7, 0x0f, 0x75, 0x77, 0x5b, 0x37, 0xec, 0xa1,
-  0x70, 0x4a, 0xa3, 0x51, 0xae, 0x22, 0x92, 0x50, 0xfc, 0xe4, 0x5c, 0xfd, 0x91, 0x8f, 0x1d, 0x3c,
-  0xbd, 0xc3, 0x01, 0xc7, 0xf0, 0xbb, 0x16, 0x1f, 0x1e, 0xf2, 0x29, 0xf7, 0x5a, 0x2e, 0x2d, 0xea,
-  0xda, 0x2f, 0x92, 0xf6, 0x96, 0x8c, 0xde, 0xca, 0x0e, 0x79, 0xce, 0x52, 0x8d, 0xeb, 0x37, 0x32,
-  0x7a, 0xc7, 0xa1, 0xa2, 0x1c, 0x2b, 0x1a, 0xa5, 0x32, 0x80, 0x11, 0xdf, 0x02, 0x88, 0x38, 0xeb,
-  0x2a, 0x7c, 0x7b, 0xc5, 0x06, 0xbf, 0xdc, 0xdf, 0xcf, 0x25, 0x50, 0x6f, 0x70, 0x7f, 0x9f, 0xef,
-  0x9c, 0xbc, 0xa9, 0xdf, 0xdd, 0x6f, 0x1c, 0xf0, 0xb8, 0x18, 0xe4, 0x45, 0x4c, 0x24, 0x86, 0x96,
-  0x0b, 0xea, 0x05, 0xa9, 0xb1, 0xc3, 0x6b, 0xce, 0x5e, 0xb4, 0x70, 0xe7, 0x59, 0xba, 0x20, 0xf2,
-  0x4a, 0x7e, 0xa6, 0xaf, 0xda, 0xe8, 0xa7, 0x9b, 0x1b, 0x6b, 0x58, 0xf9, 0xcd, 0x8c, 0x12, 0x23,
-  0xdf, 0xdd, 0xd5, 0x1a, 0xd4, 0x75, 0xd9, 0x12, 0x02, 0x88, 0x36, 0x47, 0x57, 0x63, 0x25, 0x72,
-  0xaa, 0x9a, 0x1b, 0x7b, 0x6e, 0x6f, 0x9c, 0x74, 0xbc, 0x48, 0x60, 0x00, 0x46, 0x7c, 0xe6, 0xef,
-  0xab, 0xd4, 0x9e, 0x6a, 0x0d, 0x50, 0xc4, 0xa9, 0x53, 0x79, 0xc9, 0x28, 0xe7, 0xed, 0x94, 0x82,
-  0xb5, 0x86, 0xc7, 0x69, 0x04, 0xe1, 0xc5, 0xa4, 0x03, 0xa1, 0x10, 0xdf, 0xb7, 0x75, 0xc8, 0x5f,
-  0x30, 0xe5, 0xc1, 0x0d, 0x41, 0xad, 0x83, 0xaf, 0xe1, 0xb0, 0x43, 0x05, 0x6f, 0x2f, 0x71, 0x07,
-  0xe8, 0x55, 0x8a, 0xb8, 0xa6, 0x87, 0x97, 0xa7, 0x65, 0x3d, 0x6c, 0xe4, 0x14, 0x51, 0x13, 0x37,
-  0x53, 0x6c, 0x9e, 0x96, 0xcb, 0x33, 0xa2, 0x52, 0xcd, 0x1a, 0x51, 0x29, 0x4a, 0x0a, 0x6e, 0x7b,
-  0x6d, 0x90, 0x94, 0xb2, 0x5d, 0x84, 0xc8, 0x4a, 0x5e, 0x99, 0x16, 0xf3, 0x30, 0xeb, 0x1a, 0xd7,
-  0xa5, 0xb8, 0xd7, 0xc5, 0xf5, 0xb6, 0x29, 0xe6, 0x08, 0x22, 0x6f, 0x00, 0xb3, 0xc8, 0xb7, 0x31,
-  0x5f, 0xb2, 0x8b, 0x87, 0x52, 0x8e, 0x24, 0xd6, 0x5c, 0xfe, 0xb3, 0x16, 0x87, 0x1e, 0x41, 0x1c,
-  0xda, 0xa8, 0xb4, 0x92, 0x8b, 0xaa, 0x90, 0x34, 0x0b, 0x3d, 0x75, 0xab, 0x05, 0x6f, 0x0c, 0x95,
-  0x6b, 0x1c, 0xc8, 0xa4, 0x10, 0x89, 0x03, 0x1f, 0x92, 0xef, 0xe2, 0xf0, 0xa2, 0x26, 0x9b, 0x2d,
-  0xf7, 0x60, 0x15, 0x52, 0x57, 0x88, 0x63, 0xc7, 0x61, 0x08, 0xc9, 0x80, 0x85, 0x39, 0x62, 0xac,
-  0x82, 0xda, 0x38, 0xed, 0x14, 0x5d, 0xf5, 0x47, 0xba, 0x58, 0x50, 0xcd, 0x0d, 0xa3, 0x48, 0xe6,
-  0x87, 0x18, 0x53, 0x70, 0xe7, 0xfa, 0x12, 0x8f, 0x3e, 0x42, 0x04, 0xab, 0xe9, 0x71, 0x12, 0x85,
-  0x90, 0x05, 0xa1, 0x19, 0x49, 0xd7, 0x20, 0x78, 0x07, 0x8d, 0x5a, 0xec, 0x15, 0xcc, 0xac, 0xe9,
-  0x01, 0x17, 0x74, 0x34, 0x3d, 0x80, 0x31, 0xac, 0x63, 0xcf, 0x90, 0x73, 0x4b, 0xb5, 0x36, 0x2b,
-  0x1f, 0xff, 0xa8, 0x67, 0x59, 0x83, 0x2f, 0xd3, 0xa2, 0x97, 0x63, 0x11, 0xf0, 0xac, 0xbd, 0xb7,
-  0x56, 0xec, 0xba, 0x83, 0xd6, 0x82, 0x2d, 0x81, 0xad, 0x6d, 0x7b, 0xcd, 0x97, 0xf1, 0x61, 0x1d,
-  0x66, 0xa9, 0x30, 0xa8, 0x61, 0x92, 0xe3, 0x93, 0x9c, 0xae, 0x0f, 0x2f, 0x4c, 0x97, 0x5d, 0xc8,
-  0x51, 0x32, 0x89, 0xf8, 0x05, 0xc5, 0xf8, 0x3a, 0xa2, 0x41, 0xec, 0xf1, 0x3d, 0x12, 0x2e, 0xc9,
-  0x47, 0x51, 0x18, 0xc7, 0x53, 0x3a, 0x61, 0x2f, 0xb0, 0xea, 0xfa, 0x83, 0x10, 0xd8, 0x46, 0x86,
-  0x40, 0xc3, 0xbb, 0x57, 0xd7, 0x88, 0xbb, 0x3e, 0xae, 0x21, 0xee, 0xde, 0x2f, 0x57, 0x1e, 0xe3,
-  0x2d, 0xd3, 0x0d, 0x6d, 0x11, 0x23, 0x5e, 0xb9, 0xd2, 0x73, 0x41, 0x7d, 0x96, 0x80, 0x0f, 0x4d,
-  0x32, 0x32, 0x5f, 0x20, 0xec, 0x42, 0x12, 0x86, 0xd9, 0xd5, 0x25, 0x0d, 0x26, 0x10, 0x77, 0x1e,
-  0x3d, 0xb8, 0x3e, 0xc3, 0x7c, 0x29, 0x45, 0x57, 0x45, 0xe9, 0xc5, 0xcb, 0x6c, 0x6c, 0xa4, 0x7c,
-  0x1c, 0x69, 0xb1, 0xb0, 0x0c, 0xc0, 0x41, 0xc0, 0x35, 0xd1, 0x7c, 0x9c, 0x24, 0xce, 0x41, 0xa5,
-  0xc2, 0xc7, 0xf2, 0x3e, 0xdd, 0xf5, 0x7e, 0x4e, 0x5f, 0x52, 0x60, 0xbb, 0x5a, 0x81, 0xe1, 0x1b,
-  0x67, 0xb8, 0xc2, 0x7f, 0xcd, 0x4d, 0x70, 0xbd, 0xa5, 0xb8, 0x3e, 0x7c, 0x59, 0x8d, 0x1b, 0x15,
-  0x1d, 0x61, 0x27, 0xb8, 0xc8, 0xbd, 0x7e, 0x4e, 0xed, 0xfa, 0x4b, 0xd5, 0x19, 0xb5, 0x2f, 0xd4,
-  0x4b, 0xf8, 0xda, 0x0e, 0xd8, 0x91, 0xc6, 0x86, 0x08, 0xe7, 0x03, 0x88, 0xd4, 0x86, 0x93, 0x6a,
-  0xf8, 0x59, 0xe3, 0xd1, 0x74, 0x6d, 0x68, 0x00, 0x71, 0xcd, 0xd5, 0x2a, 0x88, 0xbc, 0xb8, 0x2a,
-  0x2c, 0x00, 0xbe, 0xf3, 0xa3, 0xb2, 0x78, 0xfd, 0x24, 0x24, 0x8c, 0xe8, 0xbf, 0xf9, 0x64, 0x34,
-  0xc4, 0xdb, 0x43, 0x0a, 0x6e, 0xca, 0x65, 0x39, 0xc3, 0xf0, 0xd2, 0xd1, 0x96, 0xa3, 0xeb, 0xb5,
-  0x75, 0xc0, 0x3b, 0x5c, 0x05, 0xfd, 0x28, 0xf2, 0x8c, 0x50, 0x86, 0xfa, 0xdc, 0xba, 0x54, 0x1d,
-  0xdf, 0xa8, 0x3c, 0xad, 0x91, 0xb1, 0xaf, 0x91, 0x5f, 0xf0, 0x38, 0x7e, 0x21, 0x3c, 0x7c, 0xf9,
-  0x74, 0x63, 0xe3, 0x85, 0x43, 0x1d, 0xc8, 0xe0, 0x17, 0x8e, 0x75, 0x20, 0x77, 0xf1, 0x60, 0x47,
-  0x63, 0xc3, 0x69, 0xc0, 0xca, 0xb3, 0x1d, 0x3c, 0xbd, 0x4b, 0x07, 0x0f, 0x6c, 0xcb, 0x4e, 0xac,
-  0xa4, 0x6e, 0xa5, 0x86, 0xc5, 0x97, 0x82, 0xc3, 0xd8, 0x06, 0x32, 0x1b, 0x50, 0xee, 0x5b, 0x48,
-  0x4d, 0x7d, 0x30, 0xb9, 0x90, 0x5a, 0xad, 0xfb, 0x82, 0x72, 0x46, 0x50, 0x97, 0x10, 0x1c, 0x1d,
-  0xe6, 0x95, 0xe6, 0x97, 0xdc, 0xf2, 0xc8, 0xc1, 0xe4, 0x16, 0x85, 0x60, 0xc2, 0x05, 0x43, 0x59,
-  0x82, 0x5c, 0x87, 0x85, 0xe9, 0xba, 0x38, 0xac, 0x92, 0xf6, 0xc6, 0x29, 0xbf, 0xd0, 0x44, 0xd3,
-  0xef, 0x22, 0xba, 0xc4, 0xc5, 0x9a, 0x45, 0x78, 0x0b, 0x8d, 0x8d, 0x0d, 0x93, 0xa3, 0x5a, 0x50,
-  0xff, 0x8e, 0x3e, 0xc4, 0x1a, 0x36, 0x34, 0x36, 0x05, 0xf9, 0x0a, 0x3e, 0xc0, 0xa3, 0x58, 0x6b,
-  0xe0, 0xe5, 0x39, 0x6b, 0xa0, 0x68, 0x54, 0x78, 0xac, 0xca, 0x79, 0x92, 0x16, 0x23, 0x12, 0xe7,
-  0x9b, 0x70, 0x05, 0x93, 0xbd, 0x92, 0xcf, 0xca, 0x24, 0xd9, 0xdd, 0x94, 0xcf, 0x1f, 0x2e, 0xf3,
-  0x7c, 0xfe, 0x70, 0x71, 0x55, 0x9f, 0x3d, 0xba, 0x53, 0x9e, 0x2a, 0xe3, 0x1d, 0xe3, 0x5a, 0xc2,
-  0x16, 0x4b, 0x3f, 0xdf, 0x71, 0x75, 0x08, 0xdc, 0xfd, 0xbf, 0x89, 0x81, 0xd3, 0x34, 0x57, 0x55,
-  0x37, 0xa6, 0x45, 0x90, 0x5d, 0x4c, 0xd0, 0x78, 0xc8, 0x53, 0x9d, 0xf6, 0x8e, 0x5e, 0xd8, 0xc5,
-  0x29, 0x6f, 0xc8, 0x34, 0x5e, 0xb3, 0x23, 0xd3, 0xc1, 0x4d, 0xa6, 0x8c, 0x0f, 0xe2, 0x22, 0x74,
-  0xd5, 0x6b, 0x07, 0xb7, 0xa7, 0x70, 0xaf, 0x0a, 0xff, 0x3f, 0x1b, 0xfe, 0x0f, 0xea, 0x81, 0x78,
-  0x0d, 0xc3, 0x61, 0x00, 0x00
+  0x44, 0x41, 0x12, 0x63, 0x8a, 0xd4, 0x90, 0x94, 0x1d, 0xaf, 0xed, 0x7d, 0xa6, 0x7d, 0x86, 0x7d,
+  0xb2, 0xad, 0xc2, 0x85, 0x17, 0x91, 0x94, 0xdd, 0x3b, 0xdf, 0xfe, 0xd9, 0x39, 0xa7, 0x63, 0x8a,
+  0x04, 0xaa, 0x0a, 0x85, 0xba, 0x02, 0x05, 0xcc, 0x70, 0xeb, 0xe4, 0xe2, 0xf8, 0xe6, 0x3f, 0x2f,
+  0xdf, 0x69, 0xf3, 0x64, 0xe1, 0x8f, 0x86, 0xf8, 0xaf, 0xe6, 0xd3, 0x60, 0xe6, 0x10, 0x16, 0x10,
+  0xf8, 0xcd, 0xe8, 0x64, 0x34, 0x5c, 0xb0, 0x84, 0x6a, 0xee, 0x9c, 0x46, 0x31, 0x4b, 0x1c, 0xb2,
+  0x4a, 0xa6, 0xad, 0x3d, 0x22, 0xdf, 0x36, 0x02, 0xba, 0x60, 0x0e, 0xb9, 0xf3, 0xd8, 0xfd, 0x32,
+  0x8c, 0x12, 0xa2, 0xb9, 0x61, 0x90, 0xb0, 0x00, 0x9a, 0xdd, 0x7b, 0x93, 0x64, 0xee, 0xf4, 0x2c,
+  0x2b, 0x6d, 0xba, 0xf6, 0x69, 0xc2, 0xee, 0x3c, 0x97, 0xb5, 0xf8, 0x0f, 0xd3, 0x0b, 0xbc, 0xc4,
+  0xa3, 0x7e, 0x2b, 0x76, 0xa9, 0xcf, 0x1c, 0xdb, 0x5c, 0xd0, 0x1f, 0xde, 0x62, 0xb5, 0x48, 0x7f,
+  0xaf, 0x62, 0x16, 0xf1, 0x1f, 0x74, 0x0c, 0xbf, 0x83, 0x90, 0x94, 0x30, 0x8f, 0x86, 0x89, 0x97,
+  0xf8, 0x6c, 0x74, 0xf6, 0xee, 0x44, 0xbb, 0x66, 0x49, 0xe2, 0x05, 0xb3, 0x78, 0xd8, 0x11, 0xef,
+  0x86, 0xb1, 0x1b, 0x79, 0xcb, 0x64, 0xd4, 0xb8, 0xa3, 0x91, 0x36, 0x71, 0x26, 0xa1, 0xbb, 0x5a,
+  0x00, 0x25, 0xa6, 0x4f, 0x97, 0x11, 0xbb, 0x73, 0x7a, 0x3d, 0xc4, 0x77, 0x24, 0xd0, 0xfe, 0xe1,
+  0x58, 0xf8, 0xe7, 0xdc, 0xd9, 0x65, 0x3b, 0xf8, 0x70, 0x79, 0xe4, 0xec, 0x5a, 0xfb, 0x6f, 0xf1,
+  0xf1, 0xcc, 0xb1, 0x77, 0x76, 0xf8, 0xcb, 0xb3, 0xf1, 0xbf, 0x56, 0x61, 0xe2, 0x58, 0x83, 0x49,
+  0x7b, 0xb5, 0xf8, 0x6b, 0xe9, 0x7c, 0xf9, 0x6a, 0x4e, 0xda, 0x51, 0x7c, 0x37, 0x91, 0x4f, 0xe1,
+  0x5f, 0xb3, 0xa5, 0x17, 0x8a, 0x1f, 0xd0, 0x5c, 0xfc, 0xea, 0x59, 0x03, 0xc4, 0xef, 0x87, 0xae,
+  0xb7, 0x34, 0x13, 0x6f, 0xc1, 0xc2, 0x55, 0x62, 0xba, 0xab, 0x38, 0x09, 0x17, 0xd7, 0x09, 0x8d,
+  0x92, 0xd8, 0xd9, 0xb2, 0xcd, 0x98, 0x3f, 0x9d, 0x78, 0x51, 0xf2, 0x80, 0xdd, 0xa1, 0xf3, 0xf1,
+  0xc5, 0xc5, 0x1d, 0x8b, 0x22, 0x6f, 0xc2, 0x62, 0xa7, 0x67, 0x42, 0x6f, 0x6c, 0x06, 0x7f, 0x96,
+  0x51, 0x98, 0x84, 0x0e, 0x99, 0x27, 0xc9, 0xb2, 0x4f, 0x06, 0xd3, 0x55, 0xe0, 0x26, 0x5e, 0x18,
+  0x68, 0xbf, 0xeb, 0xc6, 0xe3, 0xbd, 0x17, 0x4c, 0xc2, 0xfb, 0x76, 0xb8, 0x64, 0x81, 0xce, 0x1b,
+  0xc4, 0xfd, 0x4e, 0xe7, 0x36, 0x08, 0xdb, 0xf7, 0x3e, 0x9b, 0xb4, 0x67, 0xac, 0x33, 0x65, 0x34,
+  0x59, 0x45, 0x2c, 0xee, 0xc4, 0x92, 0x53, 0x9d, 0x9f, 0xe0, 0x4b, 0x4b, 0xfd, 0x22, 0xc6, 0x73,
+  0x0a, 0xef, 0x68, 0x0d, 0xde, 0x8c, 0x25, 0x9f, 0xae, 0xce, 0x74, 0xd2, 0xc9, 0x1a, 0x9b, 0xe4,
+  0xaf, 0x98, 0xf9, 0xd3, 0x7c, 0xaf, 0xd9, 0xe9, 0x44, 0x67, 0xc6, 0x63, 0xc4, 0x00, 0x4d, 0xa0,
+  0x21, 0xce, 0xe4, 0x9d, 0xcf, 0x90, 0xe9, 0x47, 0x0f, 0xfc, 0x53, 0xd6, 0x34, 0x9c, 0x4e, 0xb1,
+  0x69, 0xbe, 0x4d, 0x7c, 0xf4, 0xf0, 0x11, 0x66, 0x17, 0x5e, 0x7f, 0xb1, 0xbe, 0xb6, 0xef, 0xa8,
+  0xbf, 0x62, 0x4e, 0xcb, 0xce, 0xba, 0xf8, 0x21, 0x9d, 0xfc, 0xc7, 0xb5, 0xce, 0xcc, 0xc0, 0xd9,
+  0xb2, 0x8c, 0x47, 0x9f, 0x25, 0x5a, 0xe2, 0x4c, 0xda, 0x6e, 0x04, 0xc3, 0x62, 0x12, 0x86, 0x4e,
+  0xc4, 0xa4, 0x13, 0x63, 0x90, 0xb4, 0x81, 0xd6, 0xc3, 0x24, 0x89, 0xbc, 0xf1, 0x2a, 0x61, 0xf0,
+  0x21, 0x72, 0x89, 0xc9, 0x0c, 0x73, 0xfd, 0x7d, 0xf2, 0xb0, 0x64, 0xc4, 0x24, 0x09, 0xfb, 0x91,
+  0x74, 0xbe, 0xd3, 0x3b, 0xaa, 0x00, 0x94, 0x1a, 0xd2, 0xf8, 0x21, 0x00, 0x10, 0x81, 0x01, 0xd3,
+  0x3b, 0x0e, 0x27, 0x0f, 0x6d, 0xba, 0x04, 0xd6, 0x4c, 0x8e, 0xe7, 0x9e, 0x3f, 0xd1, 0x13, 0x6c,
+  0x4f, 0x27, 0x93, 0x77, 0x77, 0x40, 0xc5, 0x99, 0x17, 0x83, 0xcc, 0xb3, 0x48, 0x27, 0x48, 0x33,
+  0x31, 0x75, 0xc3, 0x19, 0x3d, 0x7e, 0x60, 0xc9, 0x1f, 0xba, 0x61, 0xba, 0x73, 0xe6, 0xde, 0x5e,
+  0x7b, 0xf0, 0x84, 0xd0, 0x8f, 0xce, 0x74, 0x04, 0x77, 0x3d, 0xad, 0xe8, 0x1b, 0xaf, 0xc6, 0x0b,
+  0x2f, 0x21, 0x66, 0x12, 0x3d, 0x5c, 0xf3, 0x47, 0xc3, 0x6c, 0xd9, 0x8e, 0x23, 0x84, 0x0f, 0x58,
+  0xb4, 0xbd, 0x2d, 0x1e, 0xdb, 0xf1, 0xdc, 0x9b, 0x26, 0x00, 0x67, 0xe9, 0x05, 0x27, 0x51, 0xb8,
+  0x84, 0x49, 0x0b, 0x62, 0xdd, 0x78, 0xae, 0xa6, 0x08, 0x84, 0x2a, 0x8c, 0x80, 0x11, 0x40, 0x11,
+  0xa8, 0x66, 0x1c, 0xfa, 0xac, 0xed, 0x87, 0x33, 0x9d, 0xbc, 0xc3, 0xf7, 0x9a, 0x64, 0x33, 0xcc,
+  0xb0, 0x36, 0xf5, 0x7c, 0xc6, 0x19, 0x06, 0xba, 0x18, 0x01, 0x63, 0xcf, 0xe4, 0xfb, 0x70, 0x8a,
+  0xea, 0x3e, 0xf5, 0x66, 0xab, 0x88, 0xf2, 0x79, 0x11, 0x0c, 0xd3, 0xa6, 0xd4, 0x43, 0x39, 0xfb,
+  0x33, 0x38, 0x0d, 0xdc, 0x70, 0xb1, 0x84, 0xe9, 0x61, 0xda, 0x92, 0xce, 0x98, 0x36, 0xa1, 0x09,
+  0xdd, 0x02, 0x31, 0xc9, 0xcd, 0x7e, 0x3c, 0x0f, 0xef, 0x6f, 0x42, 0x1a, 0x27, 0x62, 0x36, 0x6d,
+  0xe3, 0x11, 0x75, 0x24, 0x71, 0x50, 0x80, 0x48, 0x82, 0x1f, 0xf8, 0x04, 0x7a, 0x01, 0x90, 0xfc,
+  0xfb, 0xcd, 0xf9, 0x99, 0xc3, 0x60, 0x2c, 0xae, 0x4f, 0xe3, 0x18, 0x25, 0xc4, 0x09, 0x0e, 0xe4,
+  0x30, 0xfa, 0x04, 0x21, 0x11, 0xd3, 0xf5, 0x19, 0x8d, 0x6e, 0x84, 0x72, 0xe9, 0x52, 0xc9, 0xf8,
+  0x04, 0x26, 0x0f, 0x30, 0x3e, 0x1a, 0x78, 0x0b, 0x4e, 0xaa, 0x43, 0x82, 0x30, 0x80, 0x41, 0xc9,
+  0x16, 0x0e, 0xcc, 0x80, 0xea, 0xa4, 0x2b, 0xda, 0x40, 0xf0, 0xf3, 0xa8, 0x72, 0xcf, 0xed, 0x88,
+  0x2d, 0x7d, 0xea, 0xa2, 0x28, 0x71, 0xa4, 0x04, 0xc7, 0x64, 0x76, 0xf7, 0x2d, 0x2b, 0x37, 0xb2,
+  0xf1, 0x99, 0x07, 0x33, 0x15, 0xe3, 0xb8, 0xcc, 0xc4, 0xa4, 0xa6, 0x67, 0x3c, 0x72, 0x2b, 0xc3,
+  0x84, 0x95, 0x09, 0x84, 0x95, 0xa1, 0xd2, 0xc6, 0x24, 0xc2, 0xc0, 0x78, 0x59, 0x7f, 0x77, 0x1e,
+  0x9d, 0x9e, 0xe4, 0x94, 0xe8, 0x1a, 0xc4, 0x2f, 0x98, 0xb5, 0xa7, 0x51, 0xb8, 0x38, 0x06, 0x5b,
+  0x7c, 0x1c, 0x4e, 0x98, 0xae, 0xb3, 0xa1, 0x6d, 0x1d, 0xec, 0xee, 0xf5, 0x7b, 0x3d, 0xa3, 0x99,
+  0x57, 0x2a, 0x10, 0x80, 0xf8, 0xe2, 0x1f, 0xba, 0xe0, 0x26, 0x73, 0xb8, 0x5c, 0xfd, 0x6b, 0xc5,
+  0x40, 0x7e, 0x98, 0xcf, 0xdc, 0x24, 0x8c, 0x0e, 0x7d, 0x5f, 0x27, 0x3f, 0x2d, 0xce, 0x8e, 0x35,
+  0x2f, 0x58, 0xae, 0x92, 0x2f, 0x68, 0x4d, 0xff, 0xbb, 0x73, 0xf6, 0x15, 0xb8, 0x3d, 0x0d, 0x23,
+  0xdd, 0x03, 0xdb, 0xe6, 0x0d, 0x41, 0x20, 0x58, 0x30, 0x4b, 0xe6, 0x03, 0xaf, 0xd9, 0x14, 0xa0,
+  0x02, 0x87, 0x7d, 0xf1, 0xbe, 0xb6, 0xb1, 0x75, 0x1b, 0xa4, 0x32, 0xe6, 0x34, 0xe9, 0x96, 0xd9,
+  0x35, 0x06, 0xde, 0x14, 0x24, 0xc3, 0x22, 0x8e, 0x13, 0x3c, 0x3d, 0x91, 0x33, 0x5b, 0x3d, 0x74,
+  0xd5, 0xc3, 0x0e, 0x3e, 0xa8, 0xe9, 0xad, 0x82, 0x22, 0x60, 0x2c, 0xd1, 0xcd, 0x9c, 0x82, 0xfe,
+  0x56, 0x19, 0x04, 0x72, 0x76, 0x43, 0x9a, 0x49, 0x66, 0x15, 0x4c, 0xdb, 0x32, 0x46, 0xce, 0x9e,
+  0x65, 0xa0, 0x6f, 0xf1, 0x82, 0x15, 0x7b, 0x06, 0x08, 0xaf, 0x20, 0x03, 0x1f, 0x76, 0x39, 0x3d,
+  0xdb, 0xdb, 0x84, 0x6c, 0x09, 0x72, 0x38, 0x44, 0xf8, 0xdd, 0xb2, 0x0b, 0x6f, 0x04, 0xc9, 0xd4,
+  0x11, 0x06, 0xbe, 0x0d, 0x98, 0x5c, 0x8a, 0xd4, 0xa1, 0xc2, 0x71, 0x8a, 0x6b, 0x98, 0x1b, 0xf3,
+  0x1f, 0x6d, 0x98, 0x09, 0x62, 0xb4, 0x81, 0xa7, 0xef, 0xa8, 0x3b, 0xd7, 0x51, 0xd9, 0x98, 0x80,
+  0x3b, 0x6a, 0xd9, 0xdb, 0xdb, 0xb4, 0xbd, 0x5c, 0xc5, 0xf3, 0x6c, 0xd0, 0xf2, 0x9b, 0x81, 0xf2,
+  0x44, 0xdb, 0x71, 0x08, 0x63, 0x0e, 0x9c, 0x51, 0xe0, 0x38, 0x59, 0x8b, 0x8c, 0x30, 0xc3, 0x90,
+  0xa2, 0x21, 0xf4, 0xf2, 0xdb, 0x75, 0x18, 0x45, 0x0f, 0x26, 0x9f, 0x7b, 0xed, 0xe7, 0xc7, 0xff,
+  0xb8, 0xbe, 0xf8, 0xd8, 0x16, 0xac, 0xf5, 0xa6, 0x0f, 0x3a, 0x35, 0x9e, 0x35, 0x97, 0x06, 0x6f,
+  0x12, 0x6d, 0xcc, 0x34, 0x70, 0xa7, 0x93, 0xf6, 0x37, 0xc3, 0xcc, 0x80, 0x39, 0x84, 0x88, 0x5f,
+  0x53, 0x70, 0x8e, 0x60, 0x33, 0xcc, 0x2d, 0x1b, 0xc7, 0xd6, 0xf9, 0x75, 0x4b, 0x0f, 0x16, 0x9a,
+  0xe3, 0x68, 0xe4, 0xf4, 0x8a, 0x68, 0x4f, 0x4f, 0x5a, 0xb0, 0x70, 0x1c, 0x72, 0x74, 0x43, 0x0c,
+  0x6d, 0x7b, 0xfb, 0xd7, 0x4e, 0xea, 0xeb, 0xfe, 0x4b, 0x69, 0x4d, 0xa1, 0x02, 0xcd, 0x34, 0x62,
+  0x42, 0x44, 0xc1, 0x22, 0xf9, 0x0f, 0x2f, 0x13, 0x8d, 0xd2, 0xfb, 0xdd, 0xf1, 0x9a, 0xf6, 0xe0,
+  0x7b, 0x26, 0xbf, 0xdf, 0x95, 0xfc, 0xfa, 0x30, 0xb1, 0xdf, 0x5f, 0x90, 0x5f, 0x5f, 0x09, 0x8e,
+  0xaf, 0x04, 0xc7, 0x57, 0x82, 0xe3, 0x2b, 0xc1, 0xf1, 0x8d, 0x47, 0xde, 0x1e, 0x1e, 0x1d, 0xbf,
+  0x00, 0xc9, 0x36, 0x04, 0xa6, 0xb0, 0x12, 0xd3, 0x6b, 0x65, 0x3c, 0x7c, 0x41, 0xc6, 0x85, 0xd0,
+  0x7e, 0x4f, 0x85, 0x36, 0xc7, 0x93, 0xdc, 0xfb, 0x35, 0x9e, 0x5f, 0x7a, 0x01, 0x37, 0xd8, 0xbe,
+  0xe7, 0xa2, 0x14, 0x24, 0xf7, 0x8c, 0x05, 0xc0, 0xfc, 0x54, 0x17, 0x9f, 0x3b, 0xf8, 0x43, 0x12,
+  0xfd, 0xbc, 0xc5, 0x59, 0xfd, 0xbd, 0xc0, 0xea, 0xef, 0x79, 0x56, 0x3f, 0xc3, 0xff, 0x04, 0x82,
+  0x2d, 0x2b, 0xb3, 0x3c, 0xa9, 0x8f, 0x42, 0xd3, 0xa5, 0xb4, 0x03, 0x0d, 0x7f, 0x0e, 0x4e, 0x1b,
+  0xc3, 0x2e, 0x18, 0xf2, 0x09, 0x9b, 0xd2, 0x95, 0x8f, 0x0e, 0x6b, 0x4b, 0x19, 0x2c, 0x45, 0x32,
+  0x30, 0x2d, 0x09, 0x97, 0x97, 0xe0, 0xc4, 0xe8, 0x8c, 0x0a, 0x6b, 0x2c, 0x45, 0x92, 0x87, 0x5e,
+  0x23, 0x1b, 0x6c, 0xad, 0xb4, 0x48, 0xe4, 0x26, 0x0c, 0xb5, 0x05, 0x0d, 0x1e, 0x34, 0x88, 0xfd,
+  0x62, 0x0d, 0x04, 0x40, 0x5b, 0x30, 0x2d, 0x09, 0xb5, 0x39, 0x0d, 0x26, 0x3e, 0xdb, 0x22, 0x03,
+  0xb4, 0xb4, 0x43, 0x9b, 0xed, 0x6e, 0x6f, 0xeb, 0x41, 0xd3, 0x21, 0x7f, 0x06, 0x7f, 0x82, 0xf9,
+  0x0c, 0x62, 0x08, 0xa9, 0x22, 0x50, 0x05, 0x74, 0x65, 0x34, 0xd0, 0xde, 0x5d, 0x5f, 0xee, 0x74,
+  0xdb, 0x44, 0x79, 0xb9, 0xc0, 0x78, 0xe6, 0xa4, 0x73, 0x2f, 0xfd, 0x07, 0xf5, 0xbd, 0x89, 0x97,
+  0x3c, 0xe8, 0x06, 0xba, 0x5a, 0x78, 0x2b, 0x3c, 0xb2, 0x9e, 0xb3, 0xb8, 0x2c, 0xe0, 0x2e, 0x5c,
+  0x1a, 0x5c, 0xee, 0xbe, 0x30, 0x56, 0x05, 0xdd, 0xe7, 0x10, 0xd8, 0x64, 0xc0, 0x3b, 0x9e, 0x1d,
+  0x4a, 0x3e, 0xb0, 0x03, 0x11, 0x7d, 0xf6, 0x2d, 0x53, 0x35, 0x86, 0xb6, 0xc2, 0x4d, 0x4d, 0xbc,
+  0x18, 0xfc, 0xcb, 0x03, 0xb4, 0x21, 0x5e, 0xe0, 0x7b, 0xe0, 0xa8, 0xfa, 0xd2, 0x5f, 0xf1, 0xa6,
+  0xcb, 0x78, 0xd5, 0x7d, 0x45, 0xdb, 0x02, 0xbe, 0x91, 0xb5, 0xbd, 0x9d, 0x86, 0x19, 0x9f, 0x4e,
+  0x8b, 0x94, 0x9f, 0x1d, 0x16, 0x3d, 0xc5, 0xd9, 0x21, 0x18, 0x2f, 0xd1, 0x6f, 0x9d, 0x6a, 0x41,
+  0xc1, 0xd9, 0x21, 0xa0, 0x2d, 0x91, 0xd0, 0xb3, 0x9c, 0x0a, 0x32, 0x8a, 0xc8, 0x14, 0x0d, 0x8f,
+  0xf1, 0xbd, 0x97, 0x80, 0x41, 0xac, 0x60, 0x14, 0xc4, 0x74, 0xe6, 0x3a, 0x19, 0x00, 0xdb, 0xcc,
+  0x69, 0x4d, 0x8e, 0x24, 0x50, 0x37, 0x97, 0xc6, 0x4c, 0xb3, 0xfa, 0x95, 0xa0, 0x6c, 0x53, 0x4e,
+  0xcc, 0x60, 0x0c, 0xd1, 0xe1, 0xed, 0x80, 0xb7, 0xdd, 0xb1, 0xfa, 0x25, 0x04, 0x3b, 0x56, 0xa1,
+  0x45, 0xaf, 0xa2, 0x45, 0x2f, 0xdf, 0xa2, 0x57, 0xd1, 0xa2, 0x57, 0x68, 0xd1, 0xad, 0x6a, 0xd2,
+  0x4d, 0xdb, 0x4c, 0x84, 0xf0, 0xf7, 0x37, 0x30, 0x54, 0xb1, 0xf2, 0x99, 0xb7, 0x59, 0xd8, 0xd0,
+  0x20, 0x0b, 0x84, 0x50, 0xa8, 0x73, 0x01, 0x37, 0x4b, 0xce, 0xd9, 0x02, 0x83, 0x0d, 0x15, 0x0f,
+  0xbf, 0x60, 0x64, 0x8e, 0x49, 0x33, 0xc8, 0x8c, 0x0c, 0xc4, 0x58, 0xcd, 0x17, 0x7a, 0x5c, 0x9f,
+  0xad, 0xf5, 0x40, 0x34, 0x14, 0xe2, 0x84, 0x34, 0xc8, 0xc7, 0xa1, 0x9e, 0x28, 0xd6, 0x83, 0xae,
+  0x51, 0x67, 0xe7, 0x57, 0x08, 0xbe, 0xd8, 0x70, 0xa7, 0x7b, 0xa0, 0x77, 0xdf, 0x82, 0xc5, 0xda,
+  0xde, 0xee, 0xee, 0xc3, 0x9f, 0xa7, 0x27, 0x3d, 0xf9, 0xd5, 0xe9, 0x1a, 0x66, 0xa6, 0x98, 0x3b,
+  0x18, 0xce, 0x56, 0xd1, 0x69, 0x15, 0xb0, 0x1e, 0xb0, 0x51, 0x77, 0xef, 0xa0, 0x6b, 0xfd, 0x9a,
+  0x34, 0x69, 0xdf, 0xee, 0xf1, 0x3f, 0x08, 0x64, 0xe4, 0x00, 0x14, 0xf1, 0x71, 0x8f, 0xbf, 0x7c,
+  0xcb, 0xff, 0xe5, 0x2f, 0x76, 0xf9, 0xe3, 0x0e, 0xfe, 0x6b, 0xc0, 0x9b, 0x1d, 0x70, 0xbb, 0x6c,
+  0xb8, 0xbb, 0x77, 0xd0, 0x13, 0xef, 0x32, 0x1e, 0x82, 0xa4, 0x32, 0x1e, 0x82, 0xe2, 0xc8, 0x30,
+  0x18, 0x35, 0x13, 0xfc, 0x07, 0xc7, 0x28, 0x64, 0x6b, 0xb1, 0xbc, 0xa7, 0x51, 0x00, 0xf6, 0xa2,
+  0x34, 0x53, 0x7c, 0xf0, 0xe7, 0x4a, 0xd7, 0x7e, 0xeb, 0x5a, 0x56, 0x49, 0x0f, 0x60, 0xe6, 0x1d,
+  0xa7, 0x20, 0xba, 0xd2, 0x02, 0x38, 0x76, 0xb7, 0x5f, 0xd2, 0x55, 0x5d, 0x7e, 0x2b, 0xca, 0xba,
+  0xb9, 0x29, 0x90, 0x13, 0x01, 0x87, 0x8a, 0xe4, 0x6e, 0xbe, 0xe6, 0xc2, 0x0e, 0x0f, 0xc2, 0x0e,
+  0xe1, 0xfe, 0xbc, 0xb2, 0x47, 0x32, 0xc3, 0x6c, 0xe6, 0x3d, 0x35, 0xb9, 0xe8, 0x46, 0x85, 0xb1,
+  0xb1, 0x26, 0xa4, 0xe9, 0xe7, 0x05, 0x2f, 0x44, 0x6f, 0xb4, 0xbd, 0x1d, 0x0e, 0xf7, 0xdf, 0x1e,
+  0x90, 0xd3, 0x4b, 0x0d, 0x32, 0x0b, 0x48, 0x25, 0xe3, 0x3e, 0xe9, 0x87, 0xa3, 0xdd, 0xfd, 0x03,
+  0x72, 0x02, 0xc6, 0x5e, 0xfb, 0x70, 0x79, 0x7a, 0x21, 0xde, 0xd8, 0x07, 0x04, 0x7f, 0xe0, 0x77,
+  0x22, 0xde, 0x4a, 0x2b, 0x66, 0x97, 0x01, 0xef, 0xee, 0x23, 0xdc, 0xb7, 0xbb, 0x07, 0xe4, 0xd8,
+  0xbf, 0x55, 0x30, 0xc0, 0x63, 0xd0, 0xa6, 0x23, 0x05, 0x3c, 0x34, 0x7d, 0xc8, 0x9c, 0x1c, 0x7b,
+  0xe0, 0x0e, 0x7b, 0x03, 0x57, 0xb9, 0xf5, 0xb8, 0x46, 0x78, 0x48, 0xd3, 0x05, 0x14, 0x20, 0x3d,
+  0x83, 0x18, 0x58, 0x9a, 0x23, 0x7c, 0x7b, 0xdb, 0x1d, 0xee, 0x3e, 0x3d, 0x09, 0x8c, 0x90, 0x4a,
+  0xb9, 0xfc, 0xd9, 0xc6, 0x8f, 0x3d, 0x68, 0xe2, 0x36, 0x77, 0xad, 0x61, 0x78, 0xa0, 0xc7, 0x35,
+  0x0a, 0x69, 0xc6, 0x90, 0x02, 0xfc, 0x6b, 0xe5, 0x45, 0xdc, 0x5a, 0x19, 0xfd, 0x72, 0x43, 0x31,
+  0xe7, 0xf9, 0x66, 0x90, 0xdb, 0xa7, 0x2e, 0x10, 0xe2, 0x3b, 0xd0, 0x05, 0xc1, 0xe0, 0x68, 0xca,
+  0xd9, 0xa0, 0x2c, 0x56, 0xc5, 0xbb, 0xa7, 0xa7, 0x1d, 0x20, 0x31, 0x34, 0x43, 0x2e, 0xbb, 0x21,
+  0xc8, 0x2e, 0xf4, 0xad, 0xd5, 0x6a, 0x3f, 0x97, 0x34, 0x43, 0x30, 0x62, 0xe6, 0x01, 0x42, 0xec,
+  0x0a, 0xce, 0xff, 0xd6, 0xe1, 0xf0, 0x0e, 0x30, 0x19, 0xdd, 0xb2, 0xfb, 0x3c, 0x27, 0x7d, 0x36,
+  0x93, 0x27, 0x27, 0x80, 0x29, 0xb0, 0x7f, 0x43, 0x14, 0xdd, 0x2e, 0x32, 0xa4, 0xbb, 0x87, 0xcf,
+  0x3b, 0xfc, 0x79, 0x97, 0x73, 0x6e, 0x17, 0x38, 0xb7, 0xbb, 0xb3, 0xe5, 0x84, 0x4f, 0x4f, 0x7b,
+  0x7b, 0x0e, 0xff, 0xb3, 0x8f, 0xa4, 0x71, 0x24, 0x6e, 0xc8, 0x91, 0x14, 0x39, 0x91, 0x63, 0x3a,
+  0x82, 0x71, 0x24, 0x9c, 0xbd, 0x03, 0xc1, 0xa2, 0x7e, 0xca, 0x52, 0x0e, 0x62, 0xe2, 0xcd, 0x00,
+  0x46, 0x93, 0xdc, 0x93, 0x32, 0x1c, 0x45, 0x4d, 0x49, 0xb3, 0xf2, 0x84, 0x56, 0xf3, 0xe5, 0xf3,
+  0x45, 0x91, 0x2f, 0x96, 0x51, 0x44, 0xe7, 0x56, 0xa0, 0x7b, 0x25, 0xa5, 0x11, 0xd9, 0x30, 0xe2,
+  0xcd, 0x5d, 0x63, 0xf2, 0x5f, 0xc3, 0xac, 0x69, 0x15, 0x1c, 0xfb, 0x6d, 0x36, 0x77, 0x4e, 0xcf,
+  0x52, 0x7a, 0x55, 0x15, 0x4f, 0x28, 0x38, 0xb4, 0x04, 0x27, 0x80, 0xd9, 0xb6, 0x60, 0xb6, 0x37,
+  0xf7, 0xf3, 0x2b, 0xf0, 0xef, 0xee, 0x6d, 0xc2, 0x08, 0x96, 0xad, 0x6c, 0x54, 0xb2, 0xc1, 0x9e,
+  0x06, 0x77, 0x10, 0x82, 0xb1, 0x89, 0x06, 0xf9, 0x38, 0x44, 0xfe, 0xd0, 0xf7, 0x0a, 0xe2, 0x45,
+  0x30, 0x51, 0x13, 0x4d, 0x8f, 0xc2, 0x84, 0xe2, 0x27, 0x7b, 0xcf, 0xfa, 0xdf, 0xff, 0xcb, 0x48,
+  0x23, 0xa2, 0xc9, 0x66, 0x78, 0x13, 0xf6, 0x03, 0x2d, 0x09, 0x5f, 0x67, 0xeb, 0x93, 0x67, 0x39,
+  0xfd, 0xf7, 0xe5, 0x79, 0x4f, 0x4a, 0x04, 0x27, 0x5c, 0xa8, 0xc0, 0xec, 0x1e, 0x7e, 0x6e, 0x0b,
+  0x13, 0xcb, 0x26, 0x1c, 0xa0, 0x23, 0xc3, 0x94, 0xe3, 0xab, 0x5c, 0xb8, 0x61, 0x88, 0x35, 0xbe,
+  0xbf, 0x95, 0x71, 0x83, 0x01, 0xb6, 0xcc, 0x18, 0xfe, 0x8b, 0xc0, 0xd3, 0x64, 0xd9, 0xb7, 0x5f,
+  0xca, 0xbe, 0x97, 0x8e, 0x5f, 0x93, 0x7d, 0x9b, 0xab, 0xca, 0x4f, 0x2a, 0xad, 0x39, 0x86, 0x74,
+  0x61, 0x29, 0x53, 0x16, 0x4c, 0x71, 0x96, 0x2a, 0xc5, 0x59, 0x1a, 0xb5, 0x76, 0x64, 0xc5, 0xf5,
+  0x05, 0x9c, 0xab, 0xc3, 0x57, 0x28, 0x06, 0x15, 0x9d, 0x55, 0x7e, 0xb4, 0x54, 0xf9, 0x91, 0xc0,
+  0xf1, 0x72, 0x7a, 0xb3, 0xca, 0xc5, 0x11, 0x3c, 0xb7, 0x79, 0xe4, 0xd4, 0x23, 0x32, 0x70, 0x93,
+  0xa6, 0xf8, 0xe1, 0x05, 0xc0, 0x12, 0xfe, 0x28, 0xa6, 0xc8, 0x0d, 0xfd, 0x30, 0x72, 0xc8, 0x4f,
+  0xd3, 0xe9, 0x94, 0x0c, 0xd2, 0x64, 0x28, 0xed, 0x98, 0xad, 0xb4, 0x66, 0xfd, 0x5b, 0x76, 0x6e,
+  0x41, 0x60, 0x13, 0xdd, 0x2a, 0xaf, 0x5b, 0xca, 0x05, 0x01, 0xbf, 0xb4, 0x20, 0xe0, 0xaf, 0x2d,
+  0x08, 0xb8, 0x35, 0x0b, 0x02, 0x38, 0x7f, 0xff, 0xce, 0x8a, 0x80, 0xbb, 0x61, 0x45, 0xe0, 0x3b,
+  0xc8, 0xc5, 0xf7, 0x4c, 0x2e, 0x30, 0xab, 0x85, 0xe1, 0x79, 0x5b, 0xce, 0x77, 0x41, 0xd3, 0x1d,
+  0x50, 0xf9, 0x52, 0x76, 0x7b, 0xa7, 0xb8, 0x70, 0xa7, 0xb8, 0x70, 0xa7, 0xb8, 0x70, 0xa7, 0xb8,
+  0x70, 0x97, 0xcb, 0x6e, 0xef, 0x2a, 0xb3, 0xdb, 0x45, 0x25, 0xa6, 0xd7, 0x66, 0xb7, 0x8b, 0x4d,
+  0xd9, 0xad, 0x60, 0xff, 0xf7, 0x12, 0xfb, 0xb3, 0x37, 0xeb, 0x2c, 0xca, 0xbe, 0x21, 0x34, 0xe3,
+  0xf9, 0xd9, 0x15, 0xab, 0x11, 0xc0, 0x5a, 0x96, 0x5b, 0x8d, 0xc8, 0xcd, 0xa0, 0x71, 0x50, 0x96,
+  0x2b, 0x70, 0xd2, 0xa4, 0x5f, 0x7a, 0xbd, 0xb6, 0xc0, 0xb1, 0x09, 0x24, 0x09, 0x23, 0x1a, 0xcc,
+  0xd0, 0x70, 0x70, 0x11, 0x7d, 0x7e, 0x66, 0x7e, 0xcc, 0x38, 0xb7, 0xa6, 0x55, 0x3d, 0x90, 0xd6,
+  0x41, 0x7e, 0xf9, 0x1f, 0x12, 0xb4, 0x6c, 0xf1, 0xff, 0xcb, 0xea, 0x2b, 0xd8, 0x1d, 0x6e, 0xa5,
+  0xfc, 0x18, 0x15, 0x46, 0x7a, 0xae, 0x50, 0x9a, 0x2e, 0xf9, 0x12, 0xcc, 0x16, 0x66, 0x3c, 0x60,
+  0x79, 0xf2, 0x90, 0xcc, 0x29, 0x04, 0x08, 0xfa, 0x43, 0x86, 0xb5, 0x04, 0xc7, 0x30, 0x9a, 0xd3,
+  0x51, 0x88, 0x31, 0x91, 0xf3, 0xd0, 0x9c, 0x1a, 0xe6, 0x74, 0x14, 0xc1, 0x8f, 0xc8, 0x81, 0xc7,
+  0xbf, 0xa7, 0xbd, 0x43, 0xf4, 0x57, 0x7a, 0xdc, 0x84, 0x9e, 0xc0, 0x78, 0x81, 0x07, 0xad, 0x2a,
+  0x2e, 0xa2, 0x1f, 0xcb, 0x0d, 0x1f, 0x19, 0x1e, 0x2c, 0x4b, 0xef, 0x1d, 0x27, 0x3e, 0x20, 0xc0,
+  0x2f, 0x9d, 0x34, 0xe3, 0x26, 0xd1, 0x96, 0xf3, 0x87, 0xd8, 0x73, 0xa9, 0xaf, 0xac, 0xfa, 0xc2,
+  0x2a, 0x24, 0x3c, 0xd4, 0x14, 0xbb, 0x2e, 0xb4, 0x83, 0x11, 0xff, 0xaf, 0xb6, 0x25, 0x33, 0xe7,
+  0xc9, 0x98, 0x66, 0x4e, 0x78, 0x4c, 0xdd, 0xdb, 0x59, 0x14, 0xae, 0x82, 0x89, 0xf3, 0x0d, 0xcd,
+  0x38, 0x8d, 0x5a, 0xb3, 0x88, 0x4e, 0x3c, 0xdc, 0x11, 0xd8, 0xb7, 0x26, 0x6c, 0x66, 0x6a, 0x3f,
+  0x3f, 0x8a, 0x25, 0x84, 0xb7, 0xd6, 0x81, 0x78, 0xd8, 0x87, 0x60, 0x9d, 0xcf, 0x7e, 0x6e, 0x06,
+  0x5d, 0xd7, 0x25, 0xcf, 0x9a, 0xa5, 0x1a, 0x3f, 0xff, 0x62, 0x6a, 0x3f, 0xed, 0xee, 0xee, 0x66,
+  0xbf, 0x35, 0xc0, 0xff, 0x8b, 0xf1, 0x4d, 0xce, 0x06, 0x9b, 0xd4, 0x65, 0x06, 0xd1, 0xe8, 0x9c,
+  0x26, 0x73, 0xb4, 0x46, 0x3a, 0xb7, 0xa3, 0xe6, 0x9e, 0x65, 0x19, 0x4f, 0x4f, 0x02, 0xf3, 0x9e,
+  0x55, 0xed, 0x1f, 0x2b, 0xe0, 0x09, 0x71, 0x54, 0xd0, 0xe8, 0x8f, 0x0a, 0x68, 0xb6, 0xb5, 0x3e,
+  0x10, 0xe9, 0xe6, 0x20, 0xdf, 0x8c, 0xc3, 0xa0, 0xc0, 0xcc, 0x0c, 0xff, 0x9e, 0xf5, 0x0b, 0xae,
+  0xe4, 0x03, 0xb8, 0x36, 0x2e, 0xa0, 0x68, 0x0b, 0xb6, 0x08, 0xa3, 0x07, 0xd2, 0xcc, 0x16, 0x5a,
+  0x0e, 0xbe, 0x69, 0xfa, 0x70, 0x3c, 0x7a, 0x77, 0x75, 0x75, 0x71, 0xd5, 0xd7, 0x3e, 0xf1, 0x05,
+  0x93, 0x10, 0xfc, 0x31, 0x30, 0x83, 0x27, 0xa1, 0x47, 0x5b, 0xc3, 0xce, 0x78, 0x64, 0x7c, 0x83,
+  0x48, 0xdd, 0xe8, 0x03, 0x3c, 0x4b, 0x2c, 0xc4, 0x2c, 0xa1, 0x85, 0x74, 0xe0, 0xdc, 0x29, 0xce,
+  0x1c, 0x4e, 0xbb, 0xcb, 0x3c, 0x5f, 0xd7, 0x01, 0x6c, 0x33, 0xfe, 0x55, 0x24, 0x39, 0x46, 0xa7,
+  0x07, 0xa3, 0xe8, 0x74, 0x07, 0x33, 0x67, 0x36, 0xea, 0x1d, 0x64, 0xad, 0x66, 0x46, 0x7f, 0xc6,
+  0xbb, 0x3e, 0xe0, 0xb2, 0xd1, 0x19, 0xe4, 0xe8, 0x4e, 0x69, 0x81, 0xc2, 0x3c, 0x75, 0xf2, 0x99,
+  0x55, 0xb6, 0x70, 0x31, 0x1b, 0xda, 0x6d, 0xab, 0xbb, 0xbd, 0xbd, 0x75, 0x06, 0xff, 0x9d, 0x1e,
+  0x00, 0x88, 0x77, 0xd7, 0x97, 0x5a, 0xef, 0x0f, 0x5c, 0x73, 0xd4, 0xee, 0xbd, 0x64, 0xae, 0xd9,
+  0x87, 0xda, 0xa7, 0xeb, 0x23, 0x2d, 0x5e, 0x2d, 0x97, 0xfe, 0x03, 0xe9, 0xeb, 0x0f, 0x4d, 0xe7,
+  0xec, 0x80, 0xd8, 0xdd, 0x3f, 0x34, 0xd2, 0x3f, 0x3d, 0x20, 0x9f, 0xaf, 0xbb, 0x7b, 0x76, 0x4f,
+  0x13, 0xbf, 0x09, 0x74, 0x24, 0x26, 0xb4, 0x98, 0xe1, 0x3f, 0xe4, 0x50, 0xf6, 0xc2, 0xf5, 0xb4,
+  0x80, 0x87, 0x04, 0xb8, 0xe0, 0x84, 0xc3, 0x26, 0x22, 0x02, 0x98, 0xd7, 0x0f, 0xd6, 0x16, 0xa3,
+  0x35, 0xc7, 0x0e, 0xd1, 0xf9, 0x62, 0x55, 0x18, 0x27, 0x1a, 0x9b, 0x4e, 0x01, 0x4c, 0x6c, 0x6a,
+  0xff, 0x93, 0x0c, 0xc6, 0x4d, 0x67, 0xee, 0xcc, 0x0b, 0x9c, 0x98, 0x1b, 0xfd, 0xb9, 0x39, 0xe6,
+  0x88, 0xbd, 0x58, 0x63, 0x41, 0xb8, 0x9a, 0xcd, 0x8d, 0xe1, 0x38, 0x1a, 0x65, 0x4b, 0x42, 0x85,
+  0xe9, 0x7d, 0x28, 0xac, 0x14, 0x65, 0xef, 0x4f, 0x51, 0xdf, 0xc6, 0xe2, 0xe3, 0x77, 0x21, 0x13,
+  0x45, 0x71, 0xdd, 0x93, 0x9c, 0x3c, 0xbd, 0x91, 0x39, 0x2a, 0x51, 0x92, 0x99, 0xdb, 0x7e, 0xa3,
+  0x71, 0xf2, 0x2e, 0x98, 0xc8, 0x05, 0x3e, 0x36, 0xb4, 0xd5, 0xa2, 0x9d, 0xd8, 0xe0, 0x0c, 0x1c,
+  0xb9, 0x75, 0xd1, 0xc2, 0x68, 0xe8, 0xa5, 0x75, 0x88, 0xeb, 0xe2, 0xaa, 0x42, 0xf3, 0x6f, 0x2e,
+  0x5b, 0x88, 0xed, 0x84, 0x97, 0x6d, 0x56, 0xa1, 0x93, 0x24, 0x37, 0xe1, 0xf9, 0x54, 0x22, 0xf2,
+  0x29, 0x48, 0xc3, 0x0d, 0xd3, 0x8b, 0x3f, 0xd2, 0x8f, 0xfa, 0x9d, 0x71, 0x60, 0xf5, 0xef, 0xb2,
+  0xf1, 0x42, 0x82, 0x8b, 0x33, 0x9b, 0xee, 0x37, 0x0a, 0x9c, 0x6b, 0xa8, 0x8e, 0xd5, 0xe6, 0x90,
+  0x4e, 0xbc, 0xeb, 0x1b, 0x5c, 0x46, 0x74, 0x92, 0x34, 0x80, 0x9b, 0xea, 0x5b, 0x3a, 0xa4, 0x5c,
+  0xe0, 0xbb, 0xe8, 0x08, 0xc3, 0xa9, 0xa3, 0x26, 0xee, 0x01, 0x3d, 0x3d, 0xb5, 0xc4, 0x4b, 0x10,
+  0x6b, 0x2a, 0x1d, 0xab, 0x27, 0x12, 0x40, 0x08, 0x13, 0x09, 0x77, 0xa6, 0xd8, 0x40, 0xe5, 0xb8,
+  0x82, 0xad, 0xd4, 0x30, 0x7d, 0xe7, 0xdb, 0x70, 0xe2, 0xdd, 0x69, 0x7c, 0x43, 0xca, 0xe1, 0xf8,
+  0x46, 0x7f, 0x06, 0xc3, 0x79, 0xa4, 0xde, 0xc4, 0x0b, 0x1f, 0xdf, 0xfc, 0xfc, 0x48, 0x9b, 0xf6,
+  0x73, 0x1f, 0x3e, 0x89, 0xd0, 0x43, 0x13, 0x7b, 0xe6, 0x67, 0x37, 0x3f, 0x3f, 0xc6, 0xcf, 0x44,
+  0x83, 0xc0, 0x65, 0x8e, 0x66, 0xc2, 0x21, 0x9f, 0x4e, 0xf5, 0x24, 0x02, 0xce, 0x90, 0x11, 0x74,
+  0x11, 0x14, 0xe2, 0xc4, 0xbf, 0x19, 0x86, 0x4b, 0xce, 0x01, 0x99, 0xb7, 0x76, 0xbb, 0x44, 0x53,
+  0x21, 0xf0, 0x88, 0xab, 0xc7, 0x8f, 0x61, 0x47, 0x34, 0x19, 0xad, 0x35, 0xdd, 0xb1, 0xc8, 0xe8,
+  0xfa, 0x1f, 0x6f, 0xf7, 0xec, 0xae, 0x76, 0xf5, 0xe1, 0xe8, 0x73, 0x6d, 0x33, 0x9b, 0x8c, 0x6e,
+  0xce, 0xed, 0x3d, 0x7b, 0xb7, 0xae, 0x45, 0x77, 0x97, 0x40, 0xee, 0x69, 0xdd, 0xfe, 0xfe, 0x3f,
+  0x6a, 0x5b, 0xf4, 0x04, 0x8c, 0xee, 0x7e, 0x6d, 0x8b, 0xb7, 0x64, 0xf4, 0xe9, 0xf8, 0x7a, 0x6f,
+  0xdf, 0xda, 0xa9, 0x6d, 0xb2, 0xaf, 0x9a, 0xec, 0x6e, 0x24, 0xb8, 0x07, 0xe3, 0xc2, 0x91, 0x5b,
+  0x76, 0x6d, 0x0b, 0x18, 0xd2, 0xe1, 0xe5, 0xa1, 0x6d, 0x75, 0x6b, 0x5b, 0x74, 0xc9, 0xe8, 0xec,
+  0xf2, 0x64, 0x6f, 0xcf, 0x7a, 0x5b, 0xdb, 0x64, 0x97, 0x37, 0x79, 0xbb, 0x57, 0x4f, 0x71, 0x6f,
+  0x87, 0x8c, 0x2e, 0xf7, 0xf7, 0xec, 0xda, 0x06, 0xf6, 0xbe, 0x20, 0xd5, 0xb6, 0xb5, 0xcf, 0x73,
+  0x2f, 0x61, 0x75, 0xed, 0x76, 0x61, 0x48, 0x17, 0x41, 0xe7, 0x62, 0x3a, 0xad, 0x6d, 0x01, 0x43,
+  0xba, 0xfc, 0x7c, 0xfe, 0x02, 0x98, 0xae, 0x68, 0x74, 0x7c, 0x7c, 0x53, 0xdb, 0x64, 0x47, 0x34,
+  0x01, 0x06, 0xd7, 0x36, 0xd9, 0x4d, 0x9b, 0xd4, 0xce, 0xc1, 0x6e, 0x2f, 0x6d, 0xd3, 0xcc, 0x63,
+  0xfb, 0xf3, 0xc7, 0x8e, 0xbb, 0xd5, 0x6a, 0xad, 0x35, 0x7e, 0x9b, 0x35, 0x3e, 0xc9, 0xb5, 0x6e,
+  0xb5, 0xa0, 0x39, 0x7b, 0xf3, 0x0c, 0xca, 0x51, 0xec, 0xb0, 0x07, 0xec, 0x38, 0x39, 0xb9, 0xc4,
+  0x0e, 0x9a, 0x1e, 0xb0, 0xe4, 0x3e, 0x8c, 0x6e, 0x8d, 0x0c, 0x47, 0x50, 0x89, 0x65, 0x0f, 0x38,
+  0xf4, 0xce, 0x6e, 0xef, 0xd8, 0xd5, 0xdd, 0x04, 0xb2, 0x32, 0x2a, 0x60, 0xd9, 0x61, 0x94, 0xb4,
+  0x3e, 0xb2, 0xa4, 0x16, 0xdd, 0x7a, 0x97, 0xbd, 0x94, 0xba, 0xcf, 0xaf, 0x6a, 0x0f, 0x2c, 0xff,
+  0x8c, 0x6e, 0x7d, 0xc2, 0xfc, 0x84, 0xbe, 0x1a, 0xcb, 0xfe, 0x7a, 0xaf, 0x1a, 0x64, 0x1d, 0x61,
+  0x0e, 0x46, 0xe8, 0x8a, 0xe0, 0x27, 0x1a, 0x25, 0x6f, 0xe2, 0x10, 0x37, 0x14, 0x16, 0x86, 0xfb,
+  0x16, 0x87, 0x48, 0xe7, 0xd2, 0x97, 0xa1, 0xce, 0xe8, 0x18, 0x63, 0x19, 0xed, 0x22, 0x9a, 0xb0,
+  0xa8, 0x64, 0x9c, 0x8e, 0x2f, 0x78, 0xd7, 0x32, 0x4d, 0x30, 0x2d, 0x1f, 0xae, 0x8e, 0xea, 0x69,
+  0x86, 0x19, 0xc8, 0xcb, 0x55, 0xe9, 0x3b, 0xf0, 0xfa, 0xe8, 0xea, 0x43, 0xfd, 0x77, 0x60, 0xd4,
+  0xd5, 0xd1, 0x86, 0xef, 0x20, 0x98, 0x47, 0x1f, 0xae, 0xea, 0xbf, 0x83, 0x50, 0x7e, 0x38, 0xba,
+  0xaa, 0x64, 0x4e, 0x07, 0xf8, 0x92, 0x67, 0xcf, 0xc4, 0x9b, 0xe1, 0x20, 0xef, 0x4b, 0x0c, 0xe2,
+  0x8e, 0x76, 0x74, 0x7d, 0x4f, 0x97, 0x7d, 0xad, 0xc8, 0x96, 0xcf, 0x92, 0x2d, 0x65, 0xa6, 0x7c,
+  0x84, 0x3e, 0xb5, 0x26, 0x00, 0xa6, 0x51, 0xdb, 0xd6, 0x6a, 0xb5, 0xad, 0x2b, 0xbe, 0x7f, 0xa8,
+  0x35, 0xcf, 0xe2, 0x7b, 0x36, 0xaa, 0x17, 0xc7, 0xe4, 0xd7, 0x8c, 0xe9, 0xd8, 0x0f, 0xdd, 0xdb,
+  0xf5, 0x41, 0x5d, 0x5f, 0xd6, 0x0d, 0xea, 0xda, 0x0f, 0xef, 0x59, 0x9c, 0x6c, 0x18, 0x17, 0xb6,
+  0xd8, 0x30, 0xac, 0x8f, 0x61, 0xb4, 0xa0, 0xfe, 0x86, 0x71, 0xbd, 0xa7, 0xf5, 0xe0, 0x77, 0xc5,
+  0xe7, 0x02, 0x01, 0x55, 0x03, 0xc7, 0x3f, 0xf1, 0x92, 0x06, 0x9c, 0x01, 0xcb, 0x78, 0x22, 0x46,
+  0x23, 0x16, 0x99, 0xa0, 0x03, 0x7c, 0x19, 0x69, 0x43, 0xb1, 0x79, 0x8d, 0xb5, 0x45, 0x0e, 0x09,
+  0x56, 0x8b, 0x31, 0x8b, 0x88, 0xf2, 0xc3, 0xd7, 0x42, 0x4b, 0xb0, 0xb7, 0x1f, 0x8b, 0x67, 0xe9,
+  0xc0, 0x7d, 0x4d, 0xe4, 0x82, 0x44, 0xc3, 0x65, 0x0c, 0xe0, 0x08, 0xc6, 0xe7, 0x68, 0x66, 0xf6,
+  0x6d, 0xa2, 0xa8, 0xfc, 0xf9, 0x51, 0x05, 0x62, 0xd4, 0xe0, 0xde, 0x9c, 0x63, 0x02, 0xe7, 0x9f,
+  0xcb, 0x22, 0xdf, 0x20, 0xd4, 0x37, 0x5f, 0x1d, 0xf4, 0xee, 0x03, 0xdc, 0x89, 0x1b, 0x10, 0x4d,
+  0x2d, 0x49, 0x6b, 0x9d, 0xd1, 0x76, 0x30, 0x8e, 0x97, 0x83, 0xf2, 0x2c, 0xba, 0xb5, 0xaa, 0x7b,
+  0xc6, 0x23, 0x9a, 0xfe, 0xc6, 0x61, 0x1d, 0x17, 0x87, 0x22, 0xc7, 0x60, 0xcb, 0x31, 0xf0, 0xa4,
+  0xe1, 0xf2, 0xe8, 0x99, 0x64, 0x93, 0x99, 0x91, 0x94, 0x0e, 0x02, 0x69, 0x25, 0x40, 0xa1, 0x60,
+  0xb7, 0x34, 0x2f, 0x9d, 0x12, 0xcf, 0x2d, 0xc9, 0x73, 0xbe, 0x55, 0x20, 0x59, 0xbe, 0x89, 0x34,
+  0x4b, 0x90, 0x96, 0xe2, 0x53, 0xf1, 0xd2, 0x5a, 0x30, 0x64, 0x0c, 0x20, 0x49, 0xf8, 0xb4, 0x9c,
+  0xe8, 0xc9, 0xdc, 0x8b, 0x81, 0x67, 0x9d, 0x22, 0x56, 0x5b, 0x62, 0x7d, 0x05, 0x42, 0xbb, 0xc0,
+  0x8b, 0xbf, 0x89, 0xa7, 0xfb, 0x7a, 0x3c, 0xdd, 0x7f, 0x07, 0xcf, 0xce, 0xeb, 0xf1, 0xec, 0xfc,
+  0x3b, 0x78, 0x76, 0x5f, 0x8f, 0x67, 0xf7, 0xef, 0xe3, 0x59, 0x93, 0xe1, 0xa8, 0x56, 0x86, 0x51,
+  0x9a, 0x32, 0xaa, 0x20, 0x27, 0x13, 0x54, 0xa9, 0x35, 0x66, 0x49, 0xdd, 0x9a, 0x8c, 0xf3, 0x25,
+  0xde, 0x71, 0xf8, 0x43, 0x51, 0x78, 0xfc, 0x87, 0x1a, 0x4b, 0xb5, 0x21, 0x8c, 0x37, 0xa2, 0xbf,
+  0xbe, 0xf5, 0x96, 0xda, 0xd4, 0x8b, 0x20, 0xf3, 0xc3, 0xd4, 0x62, 0xa3, 0x3e, 0x5d, 0x9f, 0x09,
+  0x5e, 0x14, 0x2c, 0x01, 0xe4, 0xbc, 0x24, 0xb3, 0x97, 0x6b, 0x7a, 0x53, 0x4b, 0xd4, 0x74, 0x23,
+  0x51, 0x10, 0x01, 0x6a, 0x57, 0x6c, 0x1a, 0xb1, 0x38, 0x53, 0x70, 0xce, 0xa1, 0xa9, 0x20, 0xa0,
+  0x9a, 0x11, 0x57, 0xef, 0x37, 0x33, 0x82, 0x6e, 0xc4, 0x79, 0xb8, 0x4a, 0xc2, 0x96, 0x4b, 0x7d,
+  0x77, 0xe5, 0xd3, 0x84, 0x69, 0xf7, 0x18, 0x61, 0x62, 0xad, 0x31, 0x64, 0xac, 0xbe, 0x86, 0xb5,
+  0x6e, 0x18, 0x7c, 0xf4, 0xc5, 0x8c, 0xe5, 0x5d, 0xc7, 0xe1, 0xe7, 0x2a, 0xd7, 0x61, 0x6d, 0xf2,
+  0x86, 0xf6, 0xe8, 0x28, 0xf2, 0x66, 0xf3, 0x84, 0x45, 0x35, 0x0d, 0xba, 0xa3, 0x43, 0xd7, 0xc5,
+  0x5a, 0xc6, 0x3a, 0x08, 0x3b, 0xa3, 0x93, 0x55, 0xad, 0x53, 0xd9, 0x1d, 0x9d, 0xd3, 0x1f, 0x65,
+  0x7f, 0x21, 0x4c, 0x6c, 0xca, 0x1c, 0xfe, 0xf7, 0xdb, 0xc0, 0x83, 0x9c, 0x3c, 0x66, 0x51, 0x72,
+  0x38, 0xf9, 0x4e, 0x5d, 0x48, 0x20, 0x31, 0x39, 0xd7, 0xc9, 0x98, 0x4d, 0xc3, 0x88, 0xb1, 0x60,
+  0x42, 0x4c, 0xdf, 0x78, 0x96, 0xc9, 0xa1, 0x9e, 0x7c, 0x69, 0xb5, 0xe8, 0xd7, 0x76, 0xc4, 0x16,
+  0xe1, 0x1d, 0xd3, 0x0d, 0x13, 0x7e, 0xc9, 0x45, 0xc0, 0x66, 0x29, 0x7d, 0xa7, 0xc3, 0x34, 0xbb,
+  0x6c, 0xd9, 0xd5, 0x6b, 0x4b, 0xad, 0x72, 0xa7, 0x51, 0x79, 0x19, 0x2a, 0x78, 0x7a, 0xe2, 0x85,
+  0x1b, 0x85, 0x2c, 0xf8, 0xf8, 0xe2, 0x5c, 0x07, 0x26, 0x43, 0x1a, 0x8c, 0x5b, 0xe3, 0x56, 0x56,
+  0x19, 0x57, 0x97, 0x09, 0xbb, 0xe1, 0xe2, 0x2f, 0x78, 0x19, 0x3d, 0x00, 0xce, 0x7c, 0x2e, 0x0c,
+  0x39, 0x26, 0xae, 0xd4, 0xca, 0x8c, 0xb7, 0x90, 0xcc, 0x66, 0x5d, 0x36, 0xa5, 0xb4, 0x9a, 0x70,
+  0xb2, 0x9b, 0xd4, 0xe6, 0x9f, 0xe0, 0x5d, 0xa9, 0xf4, 0xae, 0x3f, 0x62, 0xf1, 0xbc, 0xd9, 0xbb,
+  0xbe, 0xed, 0xf5, 0x76, 0x7a, 0x39, 0xf7, 0xca, 0x9e, 0xd7, 0x14, 0x2b, 0xe7, 0x3c, 0x1d, 0x42,
+  0x52, 0xef, 0xf9, 0x0a, 0x9f, 0xf8, 0xcf, 0xe3, 0x1c, 0x31, 0x6e, 0x91, 0x98, 0x35, 0xff, 0xb8,
+  0x4e, 0x45, 0xf0, 0x5c, 0xc0, 0xba, 0xae, 0xea, 0x52, 0xe1, 0xfe, 0x56, 0xa4, 0xcd, 0xa9, 0x08,
+  0x05, 0x15, 0x92, 0xbe, 0x0b, 0xfe, 0xeb, 0xff, 0xa7, 0xa8, 0x5b, 0x29, 0x1b, 0xb7, 0x1d, 0x52,
+  0xed, 0xe4, 0x36, 0xb5, 0x90, 0x30, 0x8f, 0xc5, 0x7c, 0x6d, 0x6c, 0xa3, 0x1e, 0x7a, 0x52, 0xd5,
+  0x7e, 0x84, 0xa4, 0x49, 0xd5, 0x22, 0x7c, 0x62, 0x8e, 0x93, 0x00, 0x95, 0x01, 0x64, 0x51, 0x56,
+  0x53, 0x65, 0x7a, 0x02, 0x7a, 0x8a, 0x9f, 0xb2, 0x82, 0xaa, 0x57, 0x28, 0x07, 0x68, 0x54, 0x5a,
+  0xab, 0x68, 0x6d, 0x39, 0xb8, 0xef, 0xaa, 0xb3, 0x2f, 0x41, 0xcb, 0xce, 0xa9, 0xbd, 0x44, 0x09,
+  0x2f, 0x05, 0x4a, 0x23, 0x8f, 0x32, 0x66, 0x09, 0x57, 0x4e, 0xe3, 0x11, 0x2d, 0xc6, 0xda, 0xa9,
+  0x01, 0x59, 0xce, 0x81, 0x55, 0x2d, 0x0c, 0x97, 0x7a, 0x5f, 0x45, 0x92, 0xc1, 0x52, 0xd4, 0x03,
+  0x89, 0xba, 0x50, 0xdd, 0x2c, 0x5e, 0x01, 0xc2, 0x94, 0xa7, 0x60, 0x20, 0xca, 0x55, 0x69, 0xc3,
+  0x22, 0x2d, 0xd5, 0x26, 0x09, 0x7b, 0x03, 0xb2, 0x72, 0xef, 0xb2, 0x61, 0x2a, 0xd8, 0xa3, 0xa3,
+  0x24, 0x10, 0xe5, 0xd5, 0xca, 0x12, 0x71, 0x68, 0x40, 0x5a, 0x9c, 0x5f, 0xf4, 0x34, 0x3d, 0x5e,
+  0xb0, 0xda, 0x7c, 0x45, 0x01, 0xf5, 0x80, 0x36, 0x9d, 0x6f, 0x47, 0xab, 0x24, 0x09, 0x79, 0x61,
+  0xe4, 0xb3, 0x28, 0x41, 0xd9, 0xa4, 0xd8, 0x3f, 0x3f, 0x7a, 0xeb, 0x2b, 0x69, 0x46, 0xaa, 0xda,
+  0x3f, 0xe2, 0xa2, 0x1e, 0x8f, 0xbe, 0x61, 0x25, 0xcb, 0x37, 0xe9, 0x12, 0x0a, 0xfe, 0xec, 0xe7,
+  0x47, 0x72, 0xf4, 0xee, 0x55, 0x34, 0xa6, 0x60, 0x4a, 0x9a, 0x0a, 0x24, 0x5b, 0x0e, 0xee, 0x60,
+  0xab, 0x35, 0x3a, 0xac, 0x9d, 0x79, 0x1e, 0x9d, 0xc8, 0x3d, 0xa2, 0x54, 0x49, 0x2a, 0xbb, 0x77,
+  0xb1, 0x7b, 0xb7, 0xa2, 0xfb, 0xe5, 0x2a, 0x9e, 0x8f, 0x39, 0x4b, 0x36, 0x03, 0xd8, 0x41, 0x00,
+  0x3b, 0x35, 0x00, 0x34, 0x4f, 0x6e, 0xe9, 0x6f, 0x86, 0xb1, 0x8b, 0x30, 0x76, 0x2b, 0x60, 0x5c,
+  0xf3, 0x6a, 0xc1, 0xcd, 0x9d, 0x7b, 0xd8, 0xb9, 0x57, 0x45, 0xc0, 0xe9, 0x95, 0x16, 0xb3, 0x20,
+  0x0e, 0xa3, 0xcd, 0x00, 0xde, 0x22, 0x80, 0xb7, 0x15, 0x00, 0x6e, 0xc2, 0xd5, 0x4b, 0xc8, 0x7f,
+  0xc3, 0xbe, 0xbf, 0x55, 0xf4, 0x3d, 0x0c, 0xa8, 0x1f, 0xce, 0x36, 0x77, 0xde, 0xc3, 0xce, 0x7b,
+  0xb5, 0x9d, 0x6b, 0x98, 0x47, 0x52, 0x53, 0x47, 0x04, 0x50, 0x1e, 0xd2, 0x4a, 0x47, 0x00, 0x71,
+  0x0c, 0x8c, 0xb7, 0xaf, 0x2d, 0x43, 0x2f, 0x80, 0x88, 0x67, 0xc0, 0x65, 0x94, 0xd7, 0xfe, 0x10,
+  0x3c, 0x70, 0xf3, 0x06, 0xe5, 0xf6, 0x8d, 0xa1, 0x7c, 0xd8, 0xf6, 0x4f, 0x3f, 0xba, 0xbf, 0xd9,
+  0xbd, 0x81, 0x0a, 0xcc, 0xc1, 0x64, 0xca, 0x9d, 0xad, 0x75, 0x65, 0x72, 0x72, 0xf5, 0x72, 0xc9,
+  0xcc, 0xbf, 0xf6, 0xd0, 0x04, 0xe8, 0x85, 0x53, 0x4c, 0xcc, 0x78, 0x7a, 0xd2, 0x8b, 0xe7, 0x98,
+  0xd6, 0x4b, 0x4e, 0xd3, 0xa3, 0x2f, 0x8f, 0x68, 0x98, 0x84, 0xa1, 0xdc, 0xb2, 0x31, 0xae, 0x18,
+  0x80, 0x3b, 0xdb, 0xbc, 0xb0, 0xae, 0xec, 0x64, 0x80, 0x55, 0x11, 0xe5, 0x1d, 0x4e, 0xb1, 0x48,
+  0x8e, 0x56, 0xd2, 0x78, 0xfd, 0x96, 0x42, 0xae, 0x53, 0xb6, 0x4d, 0xb0, 0xe5, 0xd4, 0x42, 0x4f,
+  0x61, 0xa3, 0x9d, 0xc6, 0x7a, 0xd5, 0x7c, 0xce, 0xad, 0xda, 0x7c, 0xc5, 0xcd, 0x02, 0xb9, 0x25,
+  0x1a, 0x5b, 0x04, 0xda, 0x5a, 0x65, 0x90, 0xb8, 0xc5, 0x59, 0x0f, 0xca, 0xe2, 0x30, 0xc4, 0x4c,
+  0xc4, 0x5e, 0xae, 0xae, 0x95, 0x99, 0x8a, 0xf9, 0x19, 0x53, 0x57, 0x4b, 0x3c, 0xb0, 0xf3, 0xde,
+  0xf3, 0xf1, 0xe0, 0x94, 0xac, 0x8d, 0x0e, 0xd8, 0xbd, 0xf6, 0xcf, 0xf3, 0xb3, 0xdf, 0x93, 0x64,
+  0x79, 0x05, 0x31, 0x04, 0x8b, 0x93, 0x41, 0x50, 0x7f, 0x38, 0x29, 0x77, 0xf2, 0x25, 0x3b, 0x97,
+  0x83, 0x29, 0x16, 0xb8, 0x82, 0x78, 0x19, 0x82, 0xa7, 0xbc, 0x61, 0x3f, 0x12, 0x93, 0xbf, 0x01,
+  0x32, 0x93, 0x55, 0x8c, 0x55, 0x36, 0x30, 0x48, 0x03, 0x3c, 0x58, 0xfd, 0x09, 0xa3, 0x0c, 0x2e,
+  0xcb, 0x03, 0xc6, 0x12, 0x6f, 0xea, 0xde, 0x9a, 0x5b, 0x0a, 0x80, 0x38, 0xaf, 0x76, 0x79, 0x01,
+  0xb3, 0x6c, 0x92, 0x8e, 0x18, 0x0e, 0x51, 0x5b, 0x3c, 0x38, 0x92, 0xf7, 0x61, 0xb4, 0xc0, 0xea,
+  0xc2, 0x74, 0x03, 0x47, 0x1e, 0xbc, 0xd2, 0x09, 0x16, 0x98, 0xcb, 0x8a, 0x67, 0x5e, 0x6b, 0x8e,
+  0x47, 0x96, 0x62, 0x60, 0x1f, 0x9e, 0x5a, 0x0a, 0xda, 0x31, 0xb6, 0x49, 0x0c, 0xb3, 0xa2, 0x16,
+  0x7d, 0x6b, 0xed, 0x58, 0xd9, 0xf1, 0x74, 0x96, 0x72, 0xcf, 0x4c, 0x06, 0x44, 0x7d, 0x24, 0xa0,
+  0x9d, 0x60, 0xfe, 0xc1, 0x7b, 0xca, 0xc3, 0x70, 0xc8, 0xe7, 0x2b, 0x46, 0x21, 0xb0, 0x3a, 0x80,
+  0x91, 0x70, 0x7c, 0x07, 0x2c, 0xc5, 0x7b, 0xa0, 0xa3, 0x47, 0x4f, 0xa9, 0xd0, 0x25, 0xfd, 0x69,
+  0x1f, 0x2c, 0xc5, 0x43, 0x74, 0x4e, 0x9e, 0x35, 0xa2, 0xec, 0x94, 0xb5, 0x41, 0x00, 0x40, 0x4e,
+  0x91, 0xe7, 0x2b, 0x3f, 0x91, 0xc3, 0xe7, 0x27, 0x24, 0xb8, 0xf0, 0x80, 0x64, 0x61, 0x10, 0x9d,
+  0xb4, 0xe7, 0xf7, 0x7c, 0xff, 0x0d, 0x1f, 0x40, 0x27, 0x26, 0x99, 0x2e, 0x61, 0xc1, 0x6a, 0x2e,
+  0x11, 0x00, 0xa7, 0xd6, 0x34, 0xd4, 0x1e, 0x16, 0xee, 0xc9, 0xa9, 0x1e, 0x18, 0xfb, 0xa4, 0x75,
+  0x28, 0xd2, 0x91, 0x3a, 0xa3, 0x47, 0xd5, 0xd4, 0xc6, 0xb0, 0x44, 0x09, 0xf3, 0xa0, 0x08, 0x9c,
+  0x61, 0x15, 0x8b, 0xd2, 0x44, 0x84, 0x5f, 0xa5, 0x5a, 0xdf, 0xce, 0x30, 0xa8, 0x44, 0xcf, 0xf7,
+  0x2d, 0x57, 0x7b, 0xc7, 0xbb, 0x7e, 0xa1, 0x5f, 0x07, 0xaf, 0xd9, 0xab, 0x43, 0x6e, 0x00, 0xdb,
+  0xcd, 0xd7, 0xec, 0x1d, 0x3a, 0x5c, 0xa0, 0xa2, 0xc4, 0x7c, 0xcd, 0xce, 0xa1, 0x88, 0xb7, 0xaa,
+  0x9b, 0x1e, 0x5f, 0xac, 0x37, 0x0d, 0x31, 0x80, 0x36, 0x5f, 0x53, 0x16, 0x8d, 0x44, 0x40, 0x6e,
+  0x5f, 0xdd, 0xf6, 0xea, 0xbd, 0x6a, 0x9b, 0xea, 0x31, 0xcc, 0xf2, 0xb4, 0x86, 0x8a, 0x3f, 0xaa,
+  0x1a, 0xdf, 0x3d, 0x1b, 0xcf, 0x6a, 0xd2, 0x21, 0x6c, 0xc2, 0xa2, 0x0d, 0x15, 0xfc, 0xe1, 0x31,
+  0x37, 0xf1, 0xb6, 0x50, 0x5c, 0xa4, 0xf2, 0x36, 0xc9, 0x1c, 0x31, 0x6e, 0x39, 0x24, 0xae, 0x78,
+  0xbc, 0x17, 0xd8, 0x79, 0x95, 0x8e, 0xa9, 0xdf, 0x83, 0xc3, 0x28, 0xa2, 0x0f, 0x6d, 0x2f, 0xe6,
+  0x7f, 0x75, 0x9e, 0xb2, 0x1a, 0xaa, 0x6a, 0xb5, 0xe4, 0x17, 0x08, 0x44, 0xb1, 0x5e, 0xbd, 0x44,
+  0x61, 0xa8, 0x86, 0x68, 0x71, 0xee, 0x51, 0x2d, 0xf9, 0xb4, 0x62, 0x4d, 0x53, 0xe5, 0xd8, 0x6f,
+  0xc0, 0xce, 0x67, 0x2c, 0xf5, 0xda, 0x49, 0xf2, 0xcc, 0xa9, 0xf2, 0xa2, 0xba, 0xca, 0xd7, 0xd3,
+  0xab, 0x7c, 0x0f, 0xd9, 0x18, 0xb1, 0x55, 0x23, 0x38, 0xbd, 0xa9, 0x6a, 0xce, 0x69, 0x12, 0xfc,
+  0x88, 0x18, 0x04, 0xa0, 0x75, 0xc8, 0xae, 0xce, 0x4a, 0xbd, 0x79, 0xfb, 0x7a, 0x7c, 0x57, 0xe7,
+  0xa4, 0x30, 0x95, 0xb9, 0x3e, 0xe0, 0xdc, 0x55, 0x0e, 0x61, 0xa2, 0xd2, 0xd3, 0xc9, 0x61, 0x8c,
+  0x66, 0x16, 0xbd, 0x4c, 0x5f, 0x9e, 0xb8, 0xbc, 0xf4, 0x19, 0x9e, 0x28, 0x90, 0x11, 0x23, 0xd5,
+  0xd0, 0x1a, 0xf0, 0x63, 0x99, 0x62, 0x0d, 0x69, 0x8b, 0xa4, 0x2d, 0x6f, 0xc0, 0x36, 0x6b, 0xe3,
+  0x28, 0xbc, 0x87, 0xac, 0x46, 0x9b, 0x84, 0x2c, 0xc6, 0x13, 0x5f, 0x58, 0xab, 0x10, 0x46, 0x10,
+  0xc0, 0xce, 0x99, 0xf6, 0x8d, 0x1b, 0xa5, 0x6f, 0xda, 0x32, 0x02, 0x73, 0x0b, 0x3e, 0x06, 0x13,
+  0x02, 0x0e, 0x89, 0xc7, 0xb8, 0x31, 0x1e, 0x80, 0x61, 0x59, 0x9d, 0x72, 0x06, 0x96, 0x89, 0x56,
+  0x87, 0x97, 0xa7, 0x9a, 0x97, 0x07, 0xca, 0x17, 0x6d, 0xb5, 0x24, 0x8f, 0xf6, 0x01, 0x8c, 0x17,
+  0x29, 0x1e, 0x46, 0xcc, 0x9d, 0x46, 0xe5, 0x66, 0x8e, 0x39, 0x5f, 0x70, 0xca, 0x4c, 0x64, 0xe5,
+  0xd7, 0x41, 0x5e, 0xa2, 0x4a, 0x65, 0x73, 0x6f, 0x44, 0xb9, 0x64, 0x21, 0xf8, 0xfe, 0xfa, 0x26,
+  0x2b, 0xa0, 0x0b, 0x78, 0x01, 0x1d, 0xaf, 0x08, 0x0b, 0x78, 0x41, 0x1a, 0x48, 0x55, 0x9a, 0xef,
+  0x24, 0x22, 0xdf, 0x01, 0xb3, 0xcf, 0xe4, 0x8c, 0x60, 0xc5, 0x9c, 0x02, 0xe3, 0x80, 0x51, 0xe7,
+  0x93, 0xbe, 0xbd, 0xcd, 0x60, 0x1e, 0x5c, 0x7f, 0x05, 0x29, 0x0a, 0xe8, 0x16, 0x87, 0xa2, 0x08,
+  0x4d, 0x3d, 0x76, 0xa2, 0x8a, 0xf0, 0xa9, 0x03, 0x02, 0xad, 0x46, 0x24, 0x9b, 0x9b, 0x56, 0x66,
+  0x22, 0xb1, 0xee, 0x10, 0xe2, 0x98, 0x5c, 0x45, 0xa2, 0x08, 0x56, 0xf8, 0x69, 0x28, 0x5e, 0x33,
+  0x98, 0xe2, 0x82, 0x39, 0x56, 0x85, 0x6f, 0x03, 0x71, 0x6c, 0x03, 0x57, 0x7d, 0xf0, 0x58, 0xeb,
+  0x2a, 0xc0, 0x43, 0x7a, 0x18, 0x06, 0x36, 0x03, 0x79, 0xcc, 0x1c, 0xba, 0x4d, 0xd8, 0x8f, 0x8b,
+  0x29, 0xf4, 0x1a, 0x39, 0xd6, 0xf6, 0x76, 0xb0, 0x25, 0x17, 0x88, 0x20, 0x16, 0xe4, 0x47, 0xfa,
+  0x88, 0x91, 0x1d, 0x3e, 0xcf, 0xe3, 0x50, 0x6d, 0xf4, 0xab, 0xce, 0x85, 0x41, 0xc4, 0xc9, 0x0d,
+  0x0f, 0x07, 0x71, 0xc1, 0xc3, 0x49, 0x9d, 0x9a, 0x89, 0x09, 0x26, 0x3e, 0x70, 0xf0, 0xfc, 0x8e,
+  0x97, 0x56, 0xb9, 0x42, 0xec, 0xd1, 0x4f, 0x31, 0xe7, 0x81, 0x79, 0xb9, 0xba, 0x33, 0x70, 0xde,
+  0xcf, 0x7f, 0xb7, 0xde, 0x51, 0x2e, 0xde, 0x4a, 0xfd, 0xaf, 0xec, 0xdb, 0x86, 0x58, 0x4f, 0x88,
+  0x64, 0x3b, 0xce, 0x95, 0xca, 0x16, 0xc0, 0x60, 0xa5, 0xa0, 0xc3, 0xd2, 0x23, 0x70, 0xb2, 0x88,
+  0x12, 0x39, 0x03, 0xd6, 0x0e, 0xdd, 0x3c, 0x18, 0x46, 0x7c, 0xa9, 0xda, 0x14, 0x0e, 0x1e, 0xa7,
+  0x34, 0x48, 0xb7, 0x9b, 0x2b, 0xb8, 0xcc, 0x75, 0x35, 0x06, 0x95, 0x90, 0xe4, 0x5c, 0x31, 0x31,
+  0xf5, 0x14, 0x22, 0xdc, 0xc1, 0xff, 0x93, 0x71, 0x30, 0x94, 0xa0, 0x61, 0xb7, 0xd7, 0x4b, 0x4f,
+  0x8a, 0x66, 0x43, 0x91, 0xb3, 0xf8, 0x0a, 0xde, 0xa7, 0xda, 0xe0, 0xa3, 0x36, 0x78, 0x86, 0xcf,
+  0x4f, 0xe2, 0x08, 0xeb, 0x8e, 0x99, 0xa6, 0xee, 0xb7, 0x45, 0x5e, 0x11, 0x17, 0x4f, 0x8c, 0xf0,
+  0x2e, 0x0e, 0xcd, 0x26, 0x3f, 0x3d, 0x1d, 0xa2, 0x9e, 0xf8, 0x51, 0xda, 0xf4, 0x59, 0xd2, 0xf6,
+  0xf4, 0xe4, 0xa3, 0x90, 0xb4, 0xec, 0x2d, 0x47, 0x7e, 0x3a, 0x80, 0xf6, 0x58, 0xf8, 0xa7, 0x7e,
+  0x9b, 0x59, 0xf7, 0x35, 0x69, 0x82, 0x98, 0x43, 0xaf, 0x81, 0x57, 0x10, 0x3a, 0x53, 0x00, 0x44,
+  0xa1, 0x26, 0x4d, 0xdd, 0x3f, 0x20, 0x10, 0xb1, 0x90, 0x7e, 0x62, 0x54, 0x2a, 0x40, 0xe9, 0x74,
+  0x8b, 0x00, 0xa7, 0x00, 0x48, 0xad, 0x30, 0xfa, 0x92, 0x48, 0xa5, 0x7a, 0x05, 0x71, 0xc9, 0x6b,
+  0x7c, 0x2a, 0x33, 0xe5, 0x2b, 0x07, 0x38, 0xd7, 0x81, 0xe3, 0x81, 0x38, 0x2c, 0x8e, 0xa1, 0x30,
+  0xc6, 0xc5, 0x3a, 0x11, 0x13, 0xa1, 0x6e, 0x2a, 0xa8, 0xb9, 0xea, 0x80, 0xc7, 0x75, 0xdb, 0xdb,
+  0xe4, 0xf4, 0xe3, 0xe5, 0xa7, 0x1b, 0x69, 0x9d, 0xe8, 0x0c, 0xbf, 0x03, 0xc1, 0xfc, 0x5e, 0x82,
+  0xcc, 0x64, 0x3d, 0x3d, 0x95, 0xac, 0x58, 0x6a, 0xb2, 0xa4, 0xa5, 0x1a, 0x08, 0xd3, 0xb4, 0x16,
+  0xba, 0x01, 0x41, 0xea, 0x26, 0x83, 0x58, 0x45, 0x70, 0xcd, 0x26, 0xcd, 0xbc, 0x7f, 0xf6, 0x19,
+  0xa3, 0x34, 0x71, 0x2b, 0xc2, 0x96, 0x3c, 0x38, 0x04, 0xc4, 0x71, 0xd0, 0xf9, 0x17, 0x7c, 0xa4,
+  0xf9, 0x17, 0x3c, 0x05, 0xcd, 0xbd, 0x08, 0x8a, 0xd7, 0x27, 0x88, 0xd7, 0x4a, 0x06, 0x0c, 0x79,
+  0x86, 0x54, 0x5b, 0x6b, 0xc5, 0x43, 0xfa, 0x16, 0x34, 0x21, 0x2a, 0x86, 0xcf, 0x7f, 0x54, 0x0b,
+  0x2e, 0xe0, 0x41, 0xf2, 0x3b, 0x41, 0xfc, 0xae, 0x06, 0x98, 0x6e, 0x60, 0xac, 0xe4, 0xaf, 0x3a,
+  0xaa, 0x2f, 0xee, 0x66, 0xc0, 0x78, 0xc4, 0x0c, 0x52, 0x8c, 0x2b, 0xdf, 0x2f, 0xcc, 0xb0, 0x34,
+  0x87, 0x72, 0x49, 0x09, 0x26, 0x03, 0x5b, 0xa0, 0x51, 0x94, 0x05, 0x6e, 0xf2, 0xc8, 0x5b, 0x69,
+  0xda, 0x85, 0xf6, 0xc0, 0xfc, 0xd2, 0x74, 0x81, 0x90, 0x0a, 0x59, 0xc2, 0x90, 0x27, 0x7f, 0x39,
+  0x04, 0xcd, 0x94, 0x31, 0x80, 0xd9, 0x08, 0x20, 0x90, 0x76, 0xf1, 0xc3, 0xc7, 0x70, 0x92, 0xcd,
+  0x06, 0x77, 0x16, 0xf9, 0x0f, 0x5f, 0x82, 0xec, 0x70, 0x6f, 0xde, 0x1c, 0x71, 0x43, 0x57, 0x3c,
+  0x93, 0x10, 0xa4, 0xfc, 0xcc, 0x25, 0xea, 0xd7, 0xa9, 0xd7, 0x95, 0xc9, 0x8b, 0x1f, 0xba, 0xfc,
+  0x50, 0x2d, 0x2f, 0x0b, 0x47, 0xbf, 0xde, 0x27, 0x08, 0x9a, 0x5f, 0x29, 0xe2, 0x86, 0xbe, 0xc1,
+  0x6f, 0x19, 0xb1, 0x4c, 0x9d, 0xdf, 0x55, 0xe2, 0x60, 0x6b, 0xff, 0x1a, 0x2c, 0x0b, 0x9d, 0x31,
+  0x14, 0xdd, 0xd3, 0x84, 0x2d, 0x30, 0x67, 0x74, 0x4f, 0x97, 0xa0, 0x36, 0x90, 0xec, 0x8b, 0x66,
+  0xd0, 0x7b, 0xb1, 0x04, 0x6e, 0x60, 0x96, 0xa3, 0x9d, 0x03, 0xdd, 0x6d, 0x4d, 0xc6, 0x2d, 0x0c,
+  0x97, 0x20, 0x34, 0x5e, 0x50, 0x72, 0x7a, 0x09, 0xc1, 0x8a, 0x59, 0x80, 0x18, 0x17, 0x21, 0x9a,
+  0x1c, 0x9a, 0x01, 0x96, 0x17, 0xcb, 0xa7, 0x55, 0x4e, 0xb4, 0xa4, 0xc9, 0x9c, 0x8b, 0x0d, 0xf0,
+  0xb4, 0x1d, 0xfb, 0x9e, 0xcb, 0x74, 0x1b, 0xa4, 0x02, 0x18, 0x1b, 0x7f, 0xf6, 0x92, 0xb9, 0x4e,
+  0x3a, 0xc4, 0x38, 0x68, 0xd9, 0xfd, 0xbb, 0xd0, 0x9b, 0x68, 0x96, 0xd1, 0x8e, 0x97, 0xbe, 0x97,
+  0xf0, 0xb7, 0x03, 0x55, 0x86, 0x37, 0xea, 0xe2, 0xb1, 0x3a, 0x75, 0x71, 0x4a, 0x36, 0x5a, 0x53,
+  0x8e, 0x56, 0x8c, 0x82, 0xb5, 0xe7, 0x61, 0x9c, 0x20, 0xaa, 0x26, 0x30, 0x17, 0x23, 0x9c, 0x03,
+  0x70, 0xc2, 0x4d, 0xf1, 0x88, 0x15, 0xae, 0x4d, 0x00, 0xda, 0x4c, 0x40, 0x5b, 0x8d, 0x67, 0x79,
+  0x0f, 0x49, 0xe9, 0x4a, 0x94, 0x4e, 0xdc, 0xfe, 0x1e, 0x1f, 0x2c, 0x9d, 0x2e, 0xc1, 0x43, 0xcb,
+  0x7c, 0xb8, 0x3c, 0x94, 0xc4, 0xcb, 0x3d, 0xf8, 0x8c, 0x38, 0xe5, 0x2e, 0x60, 0xd7, 0x62, 0x92,
+  0x5f, 0xd4, 0x95, 0x4d, 0xd2, 0x0b, 0x20, 0x90, 0xf4, 0x03, 0x45, 0x3e, 0x10, 0x01, 0x54, 0x70,
+  0x8a, 0x39, 0x4d, 0xec, 0xb9, 0x31, 0xec, 0xc8, 0x5b, 0x6e, 0x86, 0x5c, 0xff, 0x46, 0xff, 0xcd,
+  0x5b, 0xf0, 0xa0, 0x6f, 0x15, 0xa1, 0x3b, 0x10, 0x35, 0xc4, 0x31, 0x96, 0xa7, 0x42, 0x43, 0xde,
+  0x60, 0xd8, 0x11, 0xd7, 0xfb, 0xe0, 0x0d, 0x26, 0x9a, 0x4c, 0x47, 0xc9, 0x35, 0xdf, 0x3e, 0x04,
+  0x19, 0x5d, 0x34, 0xf8, 0x36, 0x01, 0x3e, 0xfd, 0x15, 0xa7, 0x5b, 0x91, 0x53, 0xa2, 0x2d, 0x58,
+  0x32, 0x0f, 0x71, 0x37, 0x17, 0xd8, 0x04, 0x4d, 0x73, 0x5b, 0x37, 0x49, 0x08, 0xb4, 0xdd, 0x17,
+  0xdf, 0xcd, 0x99, 0xbf, 0x3c, 0x22, 0xa3, 0xc6, 0x50, 0x2c, 0x21, 0xca, 0x35, 0x54, 0xf1, 0x23,
+  0xb7, 0x26, 0xf5, 0x3b, 0xa2, 0x3d, 0x18, 0x76, 0xc4, 0x87, 0x74, 0xd7, 0xbf, 0xaa, 0x4f, 0x23,
+  0xed, 0x74, 0x84, 0x9d, 0x8e, 0xa8, 0x7b, 0x9b, 0xf5, 0x2b, 0xf4, 0x90, 0xd7, 0xa6, 0x8c, 0xae,
+  0xe9, 0x1d, 0xcb, 0x9a, 0xcc, 0xd5, 0x76, 0xc0, 0x70, 0xde, 0x1d, 0x35, 0x50, 0x26, 0xb7, 0xe9,
+  0x62, 0x39, 0xd0, 0x7e, 0xa7, 0x11, 0x16, 0x5d, 0x63, 0x94, 0x9d, 0xac, 0x96, 0xc0, 0x9c, 0xee,
+  0xe8, 0x26, 0x4c, 0xa8, 0xaf, 0x36, 0x68, 0xd3, 0x0d, 0x63, 0xdf, 0xe5, 0xa4, 0xca, 0xf2, 0x8e,
+  0x6c, 0x77, 0xdb, 0xc5, 0x61, 0x66, 0x0b, 0x68, 0x43, 0x6f, 0x74, 0xc5, 0x20, 0x19, 0x03, 0x13,
+  0x31, 0x81, 0x20, 0x79, 0x19, 0xde, 0x83, 0x0e, 0xc8, 0xaa, 0x61, 0x2c, 0xfb, 0x1d, 0x8b, 0xcd,
+  0xc8, 0x38, 0x11, 0x9b, 0x9e, 0xfd, 0x61, 0xc7, 0x13, 0xfd, 0xc6, 0x72, 0x73, 0xba, 0x21, 0xaa,
+  0x4a, 0x56, 0x19, 0x36, 0x2c, 0xb3, 0x2e, 0x6e, 0x5e, 0xf3, 0x02, 0x5f, 0xb9, 0xc5, 0x91, 0x62,
+  0x6e, 0xbc, 0x0b, 0xd0, 0x4f, 0x6a, 0x74, 0x95, 0x84, 0x78, 0xdd, 0x89, 0x2b, 0x71, 0x05, 0x2c,
+  0x8e, 0x35, 0x1f, 0x6f, 0x25, 0x61, 0xd1, 0x0b, 0xbb, 0xdb, 0x87, 0x47, 0x4c, 0xb2, 0x5a, 0xae,
+  0x6b, 0xcb, 0x53, 0xd4, 0x62, 0x07, 0x8b, 0x1f, 0xb2, 0x16, 0x58, 0xd5, 0x66, 0x2f, 0x1e, 0x5f,
+  0xc7, 0x0d, 0x50, 0xbc, 0xb5, 0x49, 0x3b, 0x5e, 0x45, 0x68, 0x82, 0x53, 0x1c, 0xf2, 0xae, 0xa6,
+  0xf3, 0x43, 0xb2, 0xb6, 0x86, 0xbe, 0xb6, 0x05, 0xd6, 0xed, 0x65, 0x5b, 0x71, 0x96, 0x55, 0xda,
+  0xd6, 0x4e, 0xb7, 0xc1, 0x46, 0x0d, 0x6d, 0x71, 0x58, 0x44, 0x9f, 0x1d, 0xcd, 0x55, 0x40, 0xf1,
+  0x77, 0x4d, 0x31, 0x52, 0x63, 0xfb, 0xa7, 0xfd, 0xbd, 0xbd, 0xbd, 0x81, 0xf6, 0x9f, 0xe1, 0x2a,
+  0x2a, 0xce, 0x0c, 0x48, 0xf0, 0x1d, 0x6e, 0x54, 0x68, 0x73, 0xe0, 0x98, 0xe6, 0x8a, 0x81, 0xb4,
+  0x39, 0x57, 0x6f, 0x42, 0x0d, 0x54, 0x0a, 0xbe, 0x33, 0x9e, 0x48, 0xc5, 0x74, 0xca, 0x44, 0xfa,
+  0xf4, 0x80, 0x50, 0xb8, 0xd4, 0x98, 0xd8, 0x70, 0x29, 0x8c, 0x1e, 0xc4, 0x10, 0x98, 0x16, 0xb9,
+  0xb7, 0x9a, 0x8b, 0xfc, 0x8a, 0xf9, 0xb7, 0xc6, 0x62, 0xe5, 0x27, 0x1e, 0xb4, 0x90, 0x58, 0xbd,
+  0xe0, 0x3b, 0x93, 0xf1, 0x28, 0x2e, 0xd4, 0xc6, 0x1a, 0x0d, 0x26, 0x90, 0xdf, 0x4d, 0xa1, 0xf3,
+  0x56, 0xb6, 0x71, 0x05, 0xa2, 0xd4, 0x38, 0x54, 0x93, 0x49, 0x7d, 0x20, 0x93, 0xcf, 0x62, 0x9c,
+  0x9f, 0xd7, 0x24, 0xc4, 0x4d, 0xcd, 0x07, 0x18, 0x7d, 0x18, 0xf3, 0xdb, 0x0f, 0x90, 0x46, 0xde,
+  0x4c, 0x50, 0xff, 0x0f, 0xc6, 0x96, 0x1a, 0x4d, 0xb4, 0x6d, 0x3f, 0x19, 0xd8, 0x87, 0x9a, 0x37,
+  0x15, 0x14, 0x60, 0x2d, 0x3f, 0xaf, 0xd6, 0x9f, 0x00, 0x63, 0xdd, 0x04, 0x65, 0x13, 0x37, 0xdd,
+  0xb1, 0x73, 0x56, 0x2e, 0xcf, 0x49, 0x69, 0x9c, 0xf2, 0x91, 0xf2, 0x0b, 0x39, 0xd2, 0x4b, 0x13,
+  0xc0, 0xc7, 0xb1, 0x28, 0x00, 0x25, 0xc9, 0x33, 0xd1, 0x94, 0x06, 0x1f, 0x29, 0xc4, 0x9b, 0x81,
+  0x82, 0x99, 0x20, 0x41, 0x97, 0x72, 0xa1, 0x81, 0xd0, 0xe3, 0x3d, 0x3c, 0xa0, 0x15, 0xab, 0x18,
+  0x3c, 0x80, 0x52, 0x2e, 0x39, 0x71, 0x4b, 0xb4, 0x21, 0xab, 0xe0, 0x36, 0x80, 0x58, 0x4b, 0x4a,
+  0xb5, 0x91, 0x29, 0x47, 0x24, 0x74, 0xf6, 0x2e, 0xf4, 0x13, 0xbc, 0x52, 0x48, 0x3f, 0xc7, 0x73,
+  0x0b, 0x72, 0x9e, 0xb8, 0x5e, 0x51, 0x0d, 0x89, 0x03, 0x0e, 0x43, 0x33, 0xa3, 0xa2, 0x72, 0x80,
+  0x9f, 0x11, 0x58, 0x93, 0x6d, 0xbc, 0x00, 0xa1, 0x54, 0x86, 0x86, 0x15, 0x16, 0x69, 0x2a, 0x94,
+  0x2d, 0xcc, 0x8f, 0x80, 0x27, 0xf2, 0xec, 0xbe, 0xa6, 0xf7, 0x7a, 0x8b, 0x43, 0xa3, 0x51, 0x5b,
+  0x66, 0xd6, 0xe3, 0xad, 0xd9, 0x74, 0xea, 0xb9, 0x78, 0x02, 0x45, 0xd3, 0x77, 0xb0, 0xfd, 0xa6,
+  0x9a, 0xe9, 0x06, 0x1e, 0x37, 0xd0, 0x77, 0xac, 0x0d, 0xcd, 0xb0, 0xf4, 0x63, 0x24, 0x0f, 0x27,
+  0xe8, 0x76, 0x77, 0x43, 0x4b, 0x2c, 0x56, 0x6e, 0x1c, 0xf3, 0xb5, 0xf9, 0x8a, 0x42, 0xb6, 0x82,
+  0x21, 0x11, 0x17, 0x10, 0xd4, 0xa8, 0x8b, 0x00, 0x21, 0x8e, 0x88, 0x28, 0x56, 0xe3, 0xe9, 0x0e,
+  0xe0, 0x70, 0xaa, 0xe3, 0x8a, 0xb9, 0xeb, 0x2a, 0x5e, 0xae, 0x5a, 0xe1, 0x76, 0xcd, 0xa7, 0xf5,
+  0xda, 0xad, 0x94, 0x5b, 0x55, 0x09, 0x65, 0xc2, 0xab, 0xf8, 0xee, 0xe5, 0x44, 0x31, 0x88, 0x57,
+  0xf0, 0x87, 0x8e, 0x43, 0x20, 0x82, 0x6b, 0x22, 0xe2, 0x47, 0xb5, 0x44, 0xb1, 0x6e, 0xa7, 0x82,
+  0x23, 0x4d, 0xfe, 0xce, 0xa8, 0x51, 0x32, 0xf4, 0x3b, 0x99, 0x1d, 0xc1, 0xba, 0x7b, 0x7e, 0x85,
+  0x9c, 0x38, 0xb8, 0x12, 0xf7, 0x55, 0xbf, 0x62, 0x1d, 0x82, 0xf2, 0x33, 0x8d, 0xa2, 0x6b, 0x42,
+  0x08, 0xcd, 0x9c, 0x57, 0x4b, 0x57, 0x52, 0x31, 0x0a, 0x20, 0xa3, 0x66, 0xea, 0x84, 0xb4, 0x1a,
+  0xd7, 0x86, 0x00, 0x5a, 0x15, 0x00, 0x5a, 0x12, 0x42, 0x2b, 0xe7, 0xe9, 0x22, 0x4e, 0xe7, 0x39,
+  0x3f, 0xad, 0xa3, 0x7d, 0xca, 0xeb, 0x11, 0x1f, 0x08, 0x4c, 0xbd, 0xa5, 0xdc, 0x91, 0xd6, 0xc9,
+  0x7f, 0xb1, 0x73, 0xee, 0xeb, 0xa8, 0x60, 0x45, 0xf9, 0x49, 0x2a, 0xad, 0x51, 0x59, 0x4b, 0xd0,
+  0x1a, 0x63, 0x05, 0xe7, 0x80, 0x5f, 0xd7, 0xd7, 0xb7, 0x2d, 0x6b, 0xf9, 0x63, 0x30, 0x67, 0x68,
+  0x7d, 0xe0, 0x07, 0x3c, 0x8f, 0xf9, 0x7a, 0x62, 0x0b, 0x8f, 0x5a, 0xad, 0xe2, 0x7e, 0x17, 0x5e,
+  0xa9, 0x8a, 0xa0, 0x46, 0x01, 0x45, 0xee, 0x64, 0xd3, 0xdf, 0x34, 0xd4, 0x20, 0x49, 0x80, 0x4d,
+  0x8b, 0x56, 0x30, 0x8c, 0x40, 0x58, 0xbb, 0xb1, 0x07, 0x41, 0x1e, 0x98, 0xe0, 0x48, 0xf3, 0xe9,
+  0x4c, 0xf3, 0xe2, 0x78, 0x05, 0x41, 0x34, 0xa2, 0xfb, 0x04, 0x26, 0xd0, 0xe7, 0x56, 0x11, 0x54,
+  0x5c, 0xcb, 0xb9, 0x53, 0x75, 0x14, 0x6a, 0x54, 0x71, 0x4a, 0x49, 0xf1, 0x04, 0x8d, 0x08, 0xda,
+  0xbf, 0x31, 0xfa, 0x66, 0xf6, 0x03, 0x1a, 0x80, 0xee, 0xba, 0x05, 0x7b, 0x0c, 0xe2, 0xd0, 0xc8,
+  0xcb, 0xc3, 0x39, 0xbd, 0x65, 0x68, 0x78, 0xd8, 0x6c, 0xa1, 0xcc, 0x10, 0x83, 0x2c, 0x5a, 0x02,
+  0x7e, 0xc1, 0xd7, 0x9e, 0x5f, 0x13, 0xc1, 0x24, 0xa9, 0x66, 0xe3, 0x55, 0x2c, 0xea, 0x53, 0x60,
+  0x9c, 0x13, 0x08, 0x74, 0xe3, 0xda, 0xfe, 0x39, 0x1b, 0x26, 0xb6, 0x83, 0xf8, 0xce, 0x8c, 0x5c,
+  0x63, 0x94, 0xbe, 0x3a, 0xf6, 0x84, 0xa7, 0x46, 0x96, 0xcc, 0xfc, 0x70, 0x2c, 0x02, 0x1a, 0x40,
+  0x32, 0x9d, 0xe6, 0xa2, 0x80, 0x46, 0x35, 0x69, 0x67, 0x27, 0xa5, 0xbd, 0x6d, 0xa1, 0x4d, 0xeb,
+  0xfa, 0x80, 0xd3, 0xdb, 0x10, 0x95, 0xdf, 0x7e, 0x18, 0xfd, 0xc5, 0x85, 0xe1, 0xaf, 0x05, 0x64,
+  0x3e, 0x38, 0xd1, 0xf9, 0x2a, 0x14, 0x4d, 0x95, 0x02, 0xf4, 0x73, 0xc5, 0xe2, 0x59, 0x3d, 0x46,
+  0x1d, 0x83, 0xab, 0xf5, 0x45, 0xf5, 0xc6, 0xca, 0x83, 0x82, 0xd2, 0xf0, 0xe5, 0xf0, 0x82, 0xc2,
+  0x35, 0x36, 0x43, 0xc0, 0xea, 0x83, 0x0c, 0x82, 0x2a, 0xe1, 0x58, 0x57, 0xb8, 0x3a, 0xe2, 0xd4,
+  0x48, 0xf8, 0x12, 0xa6, 0x6c, 0x25, 0x77, 0xdd, 0x35, 0xbe, 0xfd, 0xca, 0x3d, 0x24, 0xe4, 0x92,
+  0xad, 0xd5, 0xb2, 0x83, 0x4b, 0x08, 0x2f, 0xf1, 0xfd, 0xf4, 0x52, 0xf0, 0x99, 0x6f, 0x3c, 0x83,
+  0x30, 0x62, 0x49, 0x5e, 0xe8, 0x4f, 0x6a, 0x2a, 0x11, 0xb2, 0x22, 0xc9, 0x46, 0xc1, 0xda, 0xda,
+  0x18, 0x42, 0x09, 0x80, 0x37, 0x37, 0x39, 0xfb, 0x8a, 0x90, 0x4f, 0xaf, 0x36, 0xd5, 0x36, 0x70,
+  0x30, 0x2d, 0x1b, 0x01, 0x22, 0xa0, 0xdd, 0xbd, 0x94, 0xb0, 0xab, 0x4d, 0xc5, 0x0e, 0x6b, 0x9e,
+  0xf6, 0xf4, 0xa6, 0x2c, 0x3d, 0x8d, 0x72, 0x7d, 0xd1, 0x15, 0x98, 0xb0, 0x84, 0x69, 0x93, 0xf5,
+  0x32, 0x85, 0x72, 0xa5, 0x51, 0x77, 0xb7, 0x75, 0xcb, 0x1e, 0x0a, 0xc7, 0x47, 0x1a, 0xe5, 0x7a,
+  0x23, 0xd9, 0x8a, 0x1f, 0xf1, 0xab, 0x3f, 0x8b, 0xb2, 0x83, 0xc7, 0x8a, 0x78, 0xc3, 0x31, 0xfc,
+  0xae, 0x85, 0x87, 0xa7, 0x8f, 0xca, 0x58, 0xcb, 0x45, 0x48, 0x5d, 0xfb, 0x45, 0xd2, 0xde, 0x92,
+  0xd1, 0x5b, 0x89, 0x90, 0xe7, 0x2c, 0xd5, 0xb0, 0x7e, 0x23, 0xa3, 0x7d, 0xde, 0x2a, 0xca, 0xb1,
+  0xa2, 0x51, 0x2a, 0x18, 0x18, 0xf1, 0x2d, 0x80, 0x88, 0xb3, 0xae, 0xc2, 0xb7, 0x57, 0x94, 0x02,
+  0xc8, 0x4a, 0x80, 0x5c, 0x02, 0xf5, 0x06, 0x2b, 0x01, 0xf8, 0xce, 0xc9, 0x9b, 0xfa, 0x3a, 0x80,
+  0xc6, 0x21, 0x8f, 0x8b, 0x41, 0x5e, 0xc4, 0x44, 0x62, 0x68, 0xb9, 0xa0, 0x5e, 0x90, 0x1a, 0x3b,
+  0xbc, 0x96, 0xed, 0x45, 0x0b, 0x77, 0x91, 0xa5, 0x0b, 0x22, 0xaf, 0xe4, 0x87, 0x0f, 0xab, 0x8d,
+  0x7e, 0xba, 0xb9, 0xb1, 0x06, 0x95, 0x5f, 0x43, 0x29, 0x21, 0xf2, 0xfd, 0x5e, 0xad, 0x41, 0x5d,
+  0x97, 0x2d, 0x21, 0x80, 0x68, 0x73, 0x70, 0x35, 0x56, 0x22, 0xa7, 0xaa, 0xb9, 0xb1, 0xe7, 0x76,
+  0xcb, 0x49, 0xc7, 0x8b, 0x04, 0x04, 0x60, 0xc4, 0x27, 0xfe, 0xbe, 0x4a, 0xed, 0xa9, 0xd6, 0x00,
+  0x45, 0x9c, 0x3a, 0x95, 0x37, 0xaa, 0x72, 0xde, 0x4e, 0x29, 0x58, 0x6b, 0x78, 0x9c, 0x46, 0x10,
+  0x5e, 0x4c, 0x3a, 0x10, 0x0a, 0xf1, 0x9d, 0x5c, 0x87, 0xfc, 0x05, 0x53, 0x1e, 0xdc, 0x12, 0xd4,
+  0x3a, 0xf8, 0x1a, 0x0e, 0x3b, 0x54, 0xf0, 0xf6, 0x0a, 0x77, 0x80, 0x5e, 0xa5, 0x88, 0x6b, 0x7a,
+  0x78, 0x75, 0x56, 0xd6, 0xc3, 0x46, 0x4e, 0x11, 0x35, 0x71, 0x85, 0xc6, 0xe6, 0x69, 0xb9, 0x3a,
+  0x27, 0x2a, 0xd5, 0xac, 0x11, 0x95, 0xa2, 0xa4, 0xe0, 0xb6, 0xd7, 0x06, 0x49, 0x29, 0xdb, 0x45,
+  0x88, 0xac, 0xe4, 0x15, 0x6f, 0x31, 0x0f, 0xb3, 0x6e, 0x70, 0x5d, 0x8a, 0x7b, 0x5d, 0x5c, 0x6f,
+  0x9b, 0x62, 0x8e, 0x20, 0xf2, 0x06, 0x30, 0x8b, 0x7c, 0x1b, 0xf3, 0x25, 0xbb, 0x78, 0x24, 0xe5,
+  0x48, 0x42, 0xcd, 0xe5, 0x3f, 0x6b, 0x71, 0xe8, 0x31, 0xc4, 0xa1, 0x8d, 0x4a, 0x2b, 0xb9, 0xa8,
+  0x0a, 0x49, 0xb3, 0xd0, 0x53, 0xb7, 0x5a, 0xf0, 0xc6, 0x50, 0xb9, 0xc6, 0xa1, 0x4c, 0x0a, 0x91,
+  0x38, 0xf0, 0x21, 0x79, 0x14, 0x47, 0x97, 0x35, 0xd9, 0x6c, 0x19, 0x83, 0x55, 0x48, 0x5d, 0x21,
+  0x8e, 0x1d, 0x87, 0x21, 0x24, 0x03, 0x16, 0xe6, 0x88, 0xb1, 0x0a, 0x6a, 0xe3, 0x14, 0x29, 0xba,
+  0xea, 0x0f, 0x74, 0xb1, 0xa0, 0x9a, 0x1b, 0x46, 0x91, 0xcc, 0x0f, 0x31, 0xa6, 0xe0, 0xce, 0xf5,
+  0x25, 0x1e, 0x7d, 0x80, 0x08, 0x56, 0xd3, 0xe3, 0x24, 0x0a, 0x21, 0x0b, 0x42, 0x33, 0x92, 0xae,
+  0x41, 0x70, 0x04, 0x8d, 0x5a, 0xe8, 0x15, 0xcc, 0xac, 0xc1, 0x80, 0x0b, 0x3a, 0x9a, 0x1e, 0xc0,
+  0x18, 0xd6, 0xa1, 0x67, 0xc0, 0xb9, 0xa5, 0x5a, 0x9b, 0x95, 0x0f, 0x7f, 0xd4, 0xb3, 0xac, 0xc1,
+  0x97, 0x69, 0xd1, 0xcb, 0xb1, 0x08, 0x78, 0xd6, 0xde, 0x5b, 0x2b, 0x8b, 0xdd, 0x41, 0x6b, 0xc1,
+  0x96, 0xc0, 0xd6, 0xb6, 0xbd, 0xe6, 0xcb, 0xf8, 0xb0, 0x8e, 0xb2, 0x54, 0x18, 0xd4, 0x30, 0xc9,
+  0xf1, 0x49, 0x4e, 0xd7, 0xfb, 0x17, 0xa6, 0xcb, 0x2e, 0xe4, 0x28, 0x99, 0x44, 0xfc, 0x82, 0x62,
+  0x7c, 0x13, 0xd1, 0x20, 0xf6, 0xf8, 0x1e, 0x09, 0x97, 0xe4, 0xe3, 0x28, 0x8c, 0xe3, 0x29, 0x9d,
+  0xb0, 0x17, 0x58, 0x75, 0xf3, 0x5e, 0x08, 0x6c, 0x23, 0x03, 0xa0, 0xe1, 0x45, 0xb3, 0x6b, 0xc4,
+  0xdd, 0x9c, 0xd4, 0x10, 0xf7, 0xc3, 0x2f, 0xd7, 0x28, 0xe3, 0x95, 0xda, 0x0d, 0x6d, 0x11, 0x23,
+  0x5c, 0xb9, 0xd2, 0x73, 0x49, 0x7d, 0x96, 0x80, 0x0f, 0x4d, 0x32, 0x32, 0x5f, 0x20, 0xec, 0x52,
+  0x12, 0x86, 0xd9, 0xd5, 0x15, 0x0d, 0x26, 0x10, 0x77, 0x1e, 0x3f, 0xb8, 0x3e, 0xc3, 0x7c, 0x29,
+  0x05, 0x57, 0x45, 0xe9, 0xe5, 0xcb, 0x6c, 0x6c, 0xa4, 0x7c, 0x1c, 0x69, 0xb1, 0xb0, 0x0c, 0xc0,
+  0x41, 0x80, 0x35, 0xd1, 0x7c, 0x9c, 0x24, 0xce, 0x41, 0xa5, 0xc2, 0x27, 0xf2, 0xf2, 0xe0, 0x75,
+  0x3c, 0x67, 0x2f, 0x29, 0xb0, 0x5d, 0xad, 0xc0, 0xf0, 0x8d, 0x33, 0x5c, 0xc1, 0xbf, 0xe1, 0x26,
+  0xb8, 0xde, 0x52, 0xdc, 0x1c, 0xbd, 0xac, 0xc6, 0x8d, 0x0a, 0x44, 0x88, 0x04, 0x17, 0xb9, 0xd7,
+  0xcf, 0xb4, 0xdd, 0x7c, 0xae, 0x3a, 0xcf, 0xf6, 0x99, 0x7a, 0x09, 0x5f, 0xdb, 0x01, 0x3b, 0xd2,
+  0xd8, 0x10, 0xe1, 0xbc, 0x07, 0x91, 0xda, 0x70, 0xaa, 0x0d, 0x3f, 0x6b, 0x3c, 0x9a, 0xae, 0x0d,
+  0x0d, 0x20, 0xae, 0xb9, 0x5e, 0x05, 0x91, 0x17, 0x57, 0x85, 0x05, 0xc0, 0x77, 0x7e, 0x86, 0x17,
+  0xaf, 0xcb, 0x84, 0x84, 0x11, 0xfd, 0x37, 0x9f, 0x8c, 0x86, 0x78, 0x7b, 0x44, 0xc1, 0x4d, 0xb9,
+  0x2c, 0x67, 0x18, 0x5e, 0x3a, 0x04, 0x73, 0x7c, 0xb3, 0xb6, 0x0e, 0x78, 0x8f, 0xab, 0xa0, 0x1f,
+  0x44, 0x9e, 0x11, 0xca, 0x50, 0x9f, 0x5b, 0x97, 0xaa, 0x83, 0x1e, 0x95, 0xe7, 0x3a, 0x32, 0xf6,
+  0x35, 0xf2, 0x0b, 0x1e, 0x27, 0x2f, 0x84, 0x87, 0x2f, 0x9f, 0x84, 0x6c, 0xbc, 0x70, 0xfc, 0x03,
+  0x19, 0xfc, 0xc2, 0x01, 0x10, 0xe4, 0x2e, 0x1e, 0x01, 0x69, 0x6c, 0x38, 0x39, 0x58, 0x79, 0x0a,
+  0x84, 0xa7, 0x77, 0xe9, 0xe0, 0x81, 0x6d, 0xd9, 0xd9, 0x96, 0xd4, 0xad, 0xd4, 0xb0, 0xf8, 0x4a,
+  0x70, 0x18, 0xfb, 0x40, 0x66, 0x03, 0xca, 0x7d, 0x07, 0xa9, 0xa9, 0x0f, 0x26, 0x17, 0x52, 0xab,
+  0x75, 0x5f, 0x50, 0xce, 0x08, 0xea, 0x12, 0x82, 0xe3, 0xa3, 0xbc, 0xd2, 0xfc, 0x92, 0x5b, 0x1e,
+  0x39, 0x9c, 0xdc, 0xa1, 0x10, 0x4c, 0xb8, 0x60, 0x28, 0x4b, 0x90, 0x43, 0x58, 0x98, 0xae, 0xcb,
+  0xa3, 0x2a, 0x69, 0x6f, 0x9c, 0xf1, 0x9b, 0x57, 0x34, 0xfd, 0x3e, 0xa2, 0x4b, 0x5c, 0xac, 0x59,
+  0x84, 0x77, 0xd0, 0xd9, 0xd8, 0x30, 0x39, 0xaa, 0x07, 0xf5, 0xef, 0xe9, 0x43, 0xac, 0x61, 0x47,
+  0x63, 0x53, 0x90, 0xaf, 0xda, 0x07, 0x78, 0x68, 0x6b, 0xad, 0x79, 0x79, 0xce, 0x1a, 0x28, 0x1a,
+  0x15, 0x1e, 0xab, 0x72, 0x9e, 0xa4, 0xc5, 0x88, 0xc4, 0x49, 0x28, 0x5c, 0xc1, 0x64, 0xaf, 0xe4,
+  0xb3, 0x32, 0x49, 0x76, 0x37, 0xe5, 0xf3, 0xfb, 0xab, 0x3c, 0x9f, 0xdf, 0x5f, 0x5e, 0xd7, 0x67,
+  0x8f, 0xee, 0x94, 0xa7, 0xca, 0x78, 0xa1, 0xba, 0x96, 0xb0, 0xc5, 0xd2, 0xcf, 0x23, 0xae, 0x0e,
+  0x81, 0xbb, 0xff, 0x37, 0x31, 0x70, 0x9a, 0xe6, 0xaa, 0x7a, 0xc7, 0xb4, 0x2c, 0xb2, 0x8b, 0x09,
+  0x1a, 0x0f, 0x79, 0xaa, 0xd3, 0xde, 0xd1, 0x0b, 0xbb, 0x38, 0xe5, 0x0d, 0x99, 0xc6, 0x6b, 0x76,
+  0x64, 0x3a, 0xb8, 0xc9, 0x94, 0xf1, 0x41, 0xdc, 0xfa, 0xae, 0xb0, 0x76, 0x70, 0x7b, 0x0a, 0xf7,
+  0xaa, 0xf0, 0xff, 0xa0, 0xe2, 0xff, 0x00, 0xb6, 0x98, 0xd1, 0x27, 0xb0, 0x62, 0x00, 0x00
 };
 
 
@@ -201,6 +201,13 @@ bool deserializeSegment(JsonObject elem, byte it, byte presetId)
   seg.reverse_y  = elem["rY"]  | seg.reverse_y;
   seg.mirror_y   = elem["mY"]  | seg.mirror_y;
   seg.transpose  = elem[F("tp")] | seg.transpose;
+  uint8_t renderScale = elem[F("rs")] | seg.renderScale;
+  renderScale = constrain(renderScale, 0, 2); // 1/1, 1/2 or 1/4 resolution
+  if (renderScale != seg.renderScale) seg.markForReset(); // effect data is sized for the old resolution
+  seg.renderScale = renderScale;
+  #endif
+  seg.beginFrame(); // virtual dimensions depend on mapping, mirroring and transposition set above
+  #ifndef WLED_DISABLE_2D
   if (seg.is2D() && seg.map1D2D == M12_pArc && (reverse != seg.reverse || reverse_y != seg.reverse_y || mirror != seg.mirror || mirror_y != seg.mirror_y)) seg.fill(BLACK); // clear entire segment (in case of Arc 1D to 2D expansion)
   #endif
 
@@ -233,6 +240,7 @@ bool deserializeSegment(JsonObject elem, byte it, byte presetId)
   if (!iarr.isNull()) {
     uint8_t oldMap1D2D = seg.map1D2D;
     seg.map1D2D = M12_Pixels; // no mapping
+    seg.beginFrame();         // virtual length depends on mapping (and options changed above)
 
     // set brightness immediately and disable transition
     transitionDelayTemp = 0;
@@ -278,6 +286,7 @@ bool deserializeSegment(JsonObject elem, byte it, byte presetId)
       }
     }
     seg.map1D2D = oldMap1D2D; // restore mapping
+    seg.beginFrame();
     strip.trigger(); // force segment update
   }
   // send UDP/WS if segment options changed (except selection; will also deselect current preset)
@@ -525,6 +534,7 @@ void serializeSegment(JsonObject& root, Segment& seg, byte id, bool forPreset, b
     root["rY"] = seg.reverse_y;
     root["mY"] = seg.mirror_y;
     root[F("tp")] = seg.transpose;
+    root[F("rs")] = seg.renderScale;
   }
   #endif
   root["o1"]  = seg.check1;
@@ -603,6 +613,20 @@ void serializeInfo(JsonObject root)
   leds[F("pwr")] = strip.currentMilliamps;
   leds["fps"] = strip.getFps();
   leds[F("maxpwr")] = (strip.currentMilliamps)? strip.ablMilliampsMax : 0;
+  if (strip.currentMilliamps) {
+    JsonArray busPwr = leds.createNestedArray(F("bpwr")); // estimated current of each bus
+    for (uint8_t s = 0; s < busses.getNumBusses(); s++) busPwr.add(busses.getBus(s)->getCurrent());
+  }
+  JsonArray netOut; // frame counters of network busses
+  for (uint8_t s = 0; s < busses.getNumBusses(); s++) {
+    const NetOutputStats *stats = busses.getBus(s)->getNetStats();
+    if (!stats) continue;
+    if (netOut.isNull()) netOut = leds.createNestedArray(F("net"));
+    JsonObject net = netOut.createNestedObject();
+    net[F("sent")] = stats->sent;
+    net[F("drop")] = stats->dropped;
+    net[F("late")] = stats->late;
+  }
   leds[F("maxseg")] = strip.getMaxSegments();
   //leds[F("actseg")] = strip.getActiveSegmentsNum();
   //leds[F("seglock")] = false; //might be used in the future to prevent modifications to segment config
@@ -4,6 +4,25 @@
  * Receives client input
  */
 
+// existing bus replaced by a bus submitted from the LED settings page: same type and pins (preferring the
+// same start if several busses share them), so options that are only set in cfg.json (current budget,
+// network output) stay with their bus when busses are reordered, added or removed
+static Bus *findReplacedBus(const BusConfig &bc, bool *taken)
+{
+  int match = -1;
+  for (uint8_t i = 0; i < busses.getNumBusses(); i++) {
+    Bus *b = busses.getBus(i);
+    if (taken[i] || !b || b->getType() != bc.type) continue;
+    uint8_t pins[5];
+    if (memcmp(pins, bc.pins, b->getPins(pins))) continue;
+    if (match < 0 || b->getStart() == bc.start) match = i;
+    if (b->getStart() == bc.start) break;
+  }
+  if (match < 0) return nullptr;
+  taken[match] = true;
+  return busses.getBus(match);
+}
+
 //called upon POST settings form submit
 void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
 {
@@ -94,18 +113,20 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
     useGlobalLedBuffer = request->hasArg(F("LD"));
 
     bool busesChanged = false;
+    bool replaced[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES] = {false}; // existing busses already matched
     for (uint8_t s = 0; s < WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES; s++) {
-      char lp[4] = "L0"; lp[2] = 48+s; lp[3] = 0; //ascii 0-9 //strip data pin
-      char lc[4] = "LC"; lc[2] = 48+s; lc[3] = 0; //strip length
-      char co[4] = "CO"; co[2] = 48+s; co[3] = 0; //strip color order
-      char lt[4] = "LT"; lt[2] = 48+s; lt[3] = 0; //strip type
-      char ls[4] = "LS"; ls[2] = 48+s; ls[3] = 0; //strip start LED
-      char cv[4] = "CV"; cv[2] = 48+s; cv[3] = 0; //strip reverse
-      char sl[4] = "SL"; sl[2] = 48+s; sl[3] = 0; //skip first N LEDs
-      char rf[4] = "RF"; rf[2] = 48+s; rf[3] = 0; //refresh required
-      char aw[4] = "AW"; aw[2] = 48+s; aw[3] = 0; //auto white mode
-      char wo[4] = "WO"; wo[2] = 48+s; wo[3] = 0; //channel swap
-      char sp[4] = "SP"; sp[2] = 48+s; sp[3] = 0; //bus clock speed (DotStar & PWM)
+      int offset = s < 10 ? 48 : 55; // bus index is 0-9,A-Z as in settings_leds.htm
+      char lp[4] = "L0"; lp[2] = offset+s; lp[3] = 0; //ascii 0-9,A-Z //strip data pin
+      char lc[4] = "LC"; lc[2] = offset+s; lc[3] = 0; //strip length
+      char co[4] = "CO"; co[2] = offset+s; co[3] = 0; //strip color order
+      char lt[4] = "LT"; lt[2] = offset+s; lt[3] = 0; //strip type
+      char ls[4] = "LS"; ls[2] = offset+s; ls[3] = 0; //strip start LED
+      char cv[4] = "CV"; cv[2] = offset+s; cv[3] = 0; //strip reverse
+      char sl[4] = "SL"; sl[2] = offset+s; sl[3] = 0; //skip first N LEDs
+      char rf[4] = "RF"; rf[2] = offset+s; rf[3] = 0; //refresh required
+      char aw[4] = "AW"; aw[2] = offset+s; aw[3] = 0; //auto white mode
+      char wo[4] = "WO"; wo[2] = offset+s; wo[3] = 0; //channel swap
+      char sp[4] = "SP"; sp[2] = offset+s; sp[3] = 0; //bus clock speed (DotStar & PWM)
       if (!request->hasArg(lp)) {
         DEBUG_PRINT(F("No data for "));
         DEBUG_PRINTLN(s);
@@ -154,6 +175,10 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
       // this may happen even before this loop is finished so we do "doInitBusses" after the loop
       if (busConfigs[s] != nullptr) delete busConfigs[s];
       busConfigs[s] = new BusConfig(type, pins, start, length, colorOrder | (channelSwap<<4), request->hasArg(cv), skip, awmode, freqHz, useGlobalLedBuffer);
+      if (Bus *oldBus = findReplacedBus(*busConfigs[s], replaced)) {
+        busConfigs[s]->milliAmpsMax = oldBus->getMaxCurrent();
+        if (oldBus->getNetConfig()) busConfigs[s]->net = *oldBus->getNetConfig();
+      }
       busesChanged = true;
     }
     //doInitBusses = busesChanged; // we will do that below to ensure all input data is processed
@@ -245,6 +270,7 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
       gammaCorrectBri = false;
       gammaCorrectCol = false;
     }
+    Segment::invalidatePaletteCache(); // color palettes are gamma corrected
 
     fadeTransition = request->hasArg(F("TF"));
     t = request->arg(F("TD")).toInt();
@@ -803,7 +829,7 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   if (pos > 0) selseg.reverse = req.charAt(pos+3) != '0';
 
   pos = req.indexOf(F("MI=")); //Segment mirror
-  if (pos > 0) selseg.mirror = req.charAt(pos+3) != '0';
+  if (pos > 0) selseg.setOption(SEG_OPTION_MIRROR, req.charAt(pos+3) != '0');
 
   pos = req.indexOf(F("SB=")); //Segment brightness/opacity
   if (pos > 0) {
@@ -1,4 +1,5 @@
 #include "wled.h"
+#include "delta_stream.h"
 
 /*
  * UDP sync notifier / Realtime / Hyperion / TPM2.NET
@@ -158,6 +159,7 @@ void realtimeLock(uint32_t timeoutMs, byte md)
       start = mainseg.start;
       stop  = mainseg.stop;
       mainseg.freeze = true;
+      mainseg.fill(BLACK); // clear render buffer, frozen segment is still composited each frame
     } else {
       start = 0;
       stop  = strip.getLengthTotal();
@@ -210,6 +212,22 @@ void sendTPM2Ack() {
 }
 
 
+// WLED delta stream receiver, format see delta_stream.h
+static void handleDeltaPacket(const uint8_t *udpIn, size_t len)
+{
+  static DeltaDecoder decoder;
+
+  if (len < WLED_DELTA_HEADER_LEN) return;
+  if (udpIn[1] == 0) {
+    realtimeTimeout = 0;
+    return;
+  }
+  realtimeLock(udpIn[1]*1000 +1, REALTIME_MODE_UDP);
+  if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return;
+
+  if (deltaDecodePacket(&decoder, udpIn, len, strip.getLengthTotal(), setRealtimePixel) > 0) strip.show();
+}
+
 void handleNotifications()
 {
   IPAddress localIP;
@@ -504,6 +522,12 @@ void handleNotifications()
     return;
   }
 
+  if (udpIn[0] == WLED_DELTA_PROTOCOL) {
+    realtimeIP = (isSupp) ? notifier2Udp.remoteIP() : notifierUdp.remoteIP();
+    handleDeltaPacket(udpIn, len);
+    return;
+  }
+
   //UDP realtime: 1 warls 2 drgb 3 drgbw
   if (udpIn[0] > 0 && udpIn[0] < 5)
   {
@@ -705,147 +729,273 @@ void sendSysInfoUDP()
 // 1440 channels per packet
 #define DDP_CHANNELS_PER_PACKET 1440 // 480 leds
 
+#define ARTNET_HEADER_LEN   18 // ID, OpCode, version, sequence, physical, Port-Address, length
+#define ARTNET_SYNC_LEN     14
+#define ARTNET_OPCODE_OPSYNC 0x5200
+
+#define E131_HEADER_LEN    126 // root, framing and DMP layer including DMX start code (offsets in ESPAsyncE131.h)
+#define E131_SYNC_LEN       49
+#define E131_VECTOR_ROOT_DATA      0x04
+#define E131_VECTOR_ROOT_EXTENDED  0x08
+#define E131_VECTOR_FRAME_DATA     0x02
+#define E131_VECTOR_FRAME_SYNC     0x01
+
 //
 // Send real time UDP updates to the specified client
 //
-// type   - protocol type (0=DDP, 1=E1.31, 2=ArtNet)
+// type   - protocol type (0=DDP, 1=E1.31, 2=ArtNet, 3=WLED delta stream)
 // client - the IP address to send to
 // length - the number of pixels
 // buffer - a buffer of at least length*4 bytes long
 // isRGBW - true if the buffer contains 4 components per pixel
+// out    - packet buffer, output options, sequence numbers and send progress of the bus (see NetOutput)
+//
+// A frame is started with realtimeBeginFrame() and then sent one packet per realtimeSendPacket() call,
+// so the network output task can interleave destinations. realtimeBroadcast() sends a whole frame at once.
 
-static       size_t sequenceNumber = 0; // this needs to be shared across all outputs
 static const size_t ART_NET_HEADER_SIZE = 12;
 static const byte   ART_NET_HEADER[] PROGMEM = {0x41,0x72,0x74,0x2d,0x4e,0x65,0x74,0x00,0x00,0x50,0x00,0x0e};
 
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW)  {
-  if (!(apActive || interfacesInited) || !client[0] || !length) return 1;  // network not initialised or dummy/unset IP address  031522 ajn added check for ap
+static const byte   ACN_PACKET_ID[] PROGMEM = {0x41,0x53,0x43,0x2d,0x45,0x31,0x2e,0x31,0x37,0x00,0x00,0x00}; // "ASC-E1.17"
 
-  WiFiUDP ddpUdp;
+static WiFiUDP ddpUdp;     // network busses sent from the main loop
+#ifdef WLED_ENABLE_NET_OUTPUT_TASK
+static WiFiUDP netTaskUdp; // network busses sent from the output task (WiFiUDP is not thread safe)
+#endif
 
+// size of the largest packet realtimeBroadcast() assembles for given protocol type
+size_t realtimePacketSize(uint8_t type) {
   switch (type) {
-    case 0: // DDP
-    {
-      // calculate the number of UDP packets we need to send
-      size_t channelCount = length * (isRGBW? 4:3); // 1 channel for every R,G,B value
-      size_t packetCount = ((channelCount-1) / DDP_CHANNELS_PER_PACKET) +1;
+    case 0: return DDP_HEADER_LEN + DDP_CHANNELS_PER_PACKET;
+    case 1: return E131_HEADER_LEN + 512;
+    case 2: return ARTNET_HEADER_LEN + 512;
+    case 3: return UDP_IN_MAXSIZE;
+  }
+  return 0; // sent without packet buffer
+}
 
-      // there are 3 channels per RGB pixel
-      uint32_t channel = 0; // TODO: allow specifying the start channel
-      // the current position in the buffer
-      size_t bufferOffset = 0;
+static inline void putUint16(uint8_t *p, uint16_t v) { p[0] = v >> 8; p[1] = v; }         // network byte order
+static inline void putFlagsLength(uint8_t *p, uint16_t len) { putUint16(p, 0x7000 | len); } // ACN PDU flags & length
+
+// E1.31 root layer, shared by data and sync packets
+static void e131RootLayer(uint8_t *p, uint8_t vector) {
+  memset(p, 0, 38);
+  p[E131_ROOT_PREAMBLE_SIZE+1] = 0x10;
+  memcpy_P(p + E131_ROOT_ID, ACN_PACKET_ID, sizeof(ACN_PACKET_ID));
+  p[E131_ROOT_VECTOR+3] = vector;
+  // CID: fixed UUID prefix followed by MAC so it is unique and stable per device
+  static const byte cidPrefix[] PROGMEM = {0x57,0x4c,0x45,0x44,0x2d,0x45,0x31,0x33,0x31,0x2d};
+  memcpy_P(p + E131_ROOT_CID, cidPrefix, sizeof(cidPrefix));
+  WiFi.macAddress(p + E131_ROOT_CID + sizeof(cidPrefix));
+}
 
-      for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
-        if (sequenceNumber > 15) sequenceNumber = 0;
+// builds the parts of the packet header that do not change between packets
+void realtimePreparePacket(uint8_t type, NetOutput *out) {
+  if (!out || !out->packet) return;
+  uint8_t *p = out->packet;
+  switch (type) {
+    case 1: // E1.31 data packet, lengths, sequence and universe are set per packet
+      e131RootLayer(p, E131_VECTOR_ROOT_DATA);
+      memset(p + E131_FRAME_FLENGTH, 0, E131_HEADER_LEN - E131_FRAME_FLENGTH);
+      p[E131_FRAME_VECTOR+3] = E131_VECTOR_FRAME_DATA;
+      strlcpy((char*)p + E131_FRAME_SOURCE, serverDescription, 64);
+      p[E131_FRAME_PRIORITY] = out->priority;
+      putUint16(p + E131_FRAME_RESERVED, out->syncUniverse); // synchronization address
+      p[E131_DMP_VECTOR] = 0x02;       // set property
+      p[E131_DMP_TYPE]   = 0xA1;       // address & data type
+      putUint16(p + E131_DMP_ADDR_INC, 1);
+      p[E131_DMP_DATA]   = 0x00;       // DMX start code
+      break;
+    case 2: // Art-Net ArtDmx, sequence, Port-Address and length are set per packet
+      memcpy_P(p, ART_NET_HEADER, ART_NET_HEADER_SIZE); // ID, OpCode and protocol version
+      memset(p + ART_NET_HEADER_SIZE, 0, ARTNET_HEADER_LEN - ART_NET_HEADER_SIZE); // physical port 0
+      break;
+  }
+}
 
-        if (!ddpUdp.beginPacket(client, DDP_DEFAULT_PORT)) {  // port defined in ESPAsyncE131.h
-          DEBUG_PRINTLN(F("WiFiUDP.beginPacket returned an error"));
-          return 1; // problem
-        }
+// E1.31 universes are sent to their multicast group or to the client
+static inline IPAddress e131Destination(IPAddress client, uint16_t universe, bool multicast) {
+  return multicast ? IPAddress(239, 255, universe >> 8, universe & 0xFF) : client;
+}
 
-        // the amount of data is AFTER the header in the current packet
-        size_t packetSize = DDP_CHANNELS_PER_PACKET;
+static uint8_t sendUdp(NetOutput *out, IPAddress dest, uint16_t port, const uint8_t *data, size_t len) {
+  #ifdef WLED_ENABLE_NET_OUTPUT_TASK
+  WiFiUDP &udp = out->fromTask ? netTaskUdp : ddpUdp;
+  #else
+  WiFiUDP &udp = ddpUdp;
+  #endif
+  if (!udp.beginPacket(dest, port)) {
+    DEBUG_PRINTLN(F("WiFiUDP.beginPacket returned an error"));
+    return 1; // problem
+  }
+  udp.write(data, len);
+  if (!udp.endPacket()) {
+    DEBUG_PRINTLN(F("WiFiUDP.endPacket returned an error"));
+    return 1; // problem
+  }
+  return 0;
+}
 
-        uint8_t flags = DDP_FLAGS1_VER1;
-        if (currentPacket == (packetCount - 1U)) {
-          // last packet, set the push flag
-          // TODO: determine if we want to send an empty push packet to each destination after sending the pixel data
-          flags = DDP_FLAGS1_VER1 | DDP_FLAGS1_PUSH;
-          if (channelCount % DDP_CHANNELS_PER_PACKET) {
-            packetSize = channelCount % DDP_CHANNELS_PER_PACKET;
-          }
-        }
+// resets the send progress of out for a new frame
+void realtimeBeginFrame(uint8_t type, NetOutput *out, bool isRGBW) {
+  out->offset  = 0;
+  out->target  = out->universe;
+  out->pending = out->packet != nullptr;
+  switch (type) {
+    case 1: // E1.31, every universe advances once per frame
+      out->sequence++;
+      break;
+    case 2: // Art-Net
+      if (++out->sequence == 0) out->sequence = 1; // 0 disables sequencing
+      break;
+    case 3: // WLED delta stream (see delta_stream.h)
+    {
+      if (!out->last) { out->pending = false; break; }
+      bool key = out->keyframe == 0;
+      out->keyframe = (key ? WLED_DELTA_KEYFRAME : out->keyframe) - 1;
+      // unchanged busses are only resent every keep-alive interval, receiver must not time out in between
+      uint16_t keepAlive = busses.getKeepAlive();
+      uint8_t  timeout   = keepAlive ? constrain((2UL * keepAlive + 999) / 1000, 2, 255) : 2;
+      if (out->pending) deltaBeginFrame(&out->delta, out->packet, timeout, ++out->sequence, key, isRGBW);
+    } break;
+  }
+}
 
-        // write the header
-        /*0*/ddpUdp.write(flags);
-        /*1*/ddpUdp.write(sequenceNumber++ & 0x0F); // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
-        /*2*/ddpUdp.write(isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24);
-        /*3*/ddpUdp.write(DDP_ID_DISPLAY);
-        // data offset in bytes, 32-bit number, MSB first
-        /*4*/ddpUdp.write(0xFF & (channel >> 24));
-        /*5*/ddpUdp.write(0xFF & (channel >> 16));
-        /*6*/ddpUdp.write(0xFF & (channel >>  8));
-        /*7*/ddpUdp.write(0xFF & (channel      ));
-        // data length in bytes, 16-bit number, MSB first
-        /*8*/ddpUdp.write(0xFF & (packetSize >> 8));
-        /*9*/ddpUdp.write(0xFF & (packetSize     ));
-
-        // write the colors, the write write(const uint8_t *buffer, size_t size)
-        // function is just a loop internally too
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+// sends the next packet of the frame started by realtimeBeginFrame(), out->pending is cleared after the last one
+// (or on error, the rest of the frame is dropped then)
+uint8_t realtimeSendPacket(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW, NetOutput *out) {
+  if (!out || !out->pending) return 1;
+  out->pending = false; // until proven otherwise
+  if (!(apActive || interfacesInited) || !length) return 1;  // network not initialised  031522 ajn added check for ap
+  if (!client[0] && !(type > 0 && out->multicast)) return 1; // dummy/unset IP address
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("WiFiUDP.endPacket returned an error"));
-          return 1; // problem
-        }
+  uint8_t *packet = out->packet;
+  const size_t pixelSize    = isRGBW ? 4 : 3;
+  const size_t channelCount = length * pixelSize;
 
-        channel += packetSize;
+  switch (type) {
+    case 0: // DDP
+    {
+      // the amount of data is AFTER the header in the current packet
+      size_t packetSize = channelCount - out->offset;
+      uint8_t flags = DDP_FLAGS1_VER1 | DDP_FLAGS1_PUSH; // last packet, set the push flag
+      if (packetSize > DDP_CHANNELS_PER_PACKET) {
+        packetSize = DDP_CHANNELS_PER_PACKET;
+        flags = DDP_FLAGS1_VER1;
       }
+      uint32_t channel = out->offset; // TODO: allow specifying the start channel
+
+      // header
+      if (out->sequence > 15) out->sequence = 0;
+      packet[0] = flags;
+      packet[1] = out->sequence++; // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
+      packet[2] = isRGBW ? DDP_TYPE_RGBW32 : DDP_TYPE_RGB24;
+      packet[3] = DDP_ID_DISPLAY;
+      // data offset in bytes, 32-bit number, MSB first
+      packet[4] = 0xFF & (channel >> 24);
+      packet[5] = 0xFF & (channel >> 16);
+      packet[6] = 0xFF & (channel >>  8);
+      packet[7] = 0xFF & (channel      );
+      // data length in bytes, 16-bit number, MSB first
+      packet[8] = 0xFF & (packetSize >> 8);
+      packet[9] = 0xFF & (packetSize     );
+
+      // channel data, brightness applied in bulk
+      scaleChannels(packet + DDP_HEADER_LEN, buffer + channel, packetSize, bri);
+      if (sendUdp(out, client, DDP_DEFAULT_PORT, packet, DDP_HEADER_LEN + packetSize)) return 1; // port defined in ESPAsyncE131.h
+      out->offset += packetSize;
+      out->pending = out->offset < channelCount;
     } break;
 
     case 1: //E1.31
     {
+      if (out->offset >= channelCount) { // all universes sent, receivers hold them until the sync packet arrives
+        uint8_t sync[E131_SYNC_LEN];
+        e131RootLayer(sync, E131_VECTOR_ROOT_EXTENDED);
+        memset(sync + E131_FRAME_FLENGTH, 0, E131_SYNC_LEN - E131_FRAME_FLENGTH);
+        putFlagsLength(sync + E131_ROOT_FLENGTH,  E131_SYNC_LEN - E131_ROOT_FLENGTH);
+        putFlagsLength(sync + E131_FRAME_FLENGTH, E131_SYNC_LEN - E131_FRAME_FLENGTH);
+        sync[E131_FRAME_VECTOR+3] = E131_VECTOR_FRAME_SYNC;
+        sync[44] = ++out->syncSequence;
+        putUint16(sync + 45, out->syncUniverse);
+        return sendUdp(out, e131Destination(client, out->syncUniverse, out->multicast), E131_DEFAULT_PORT, sync, E131_SYNC_LEN);
+      }
+      // whole pixels per universe (170 RGB or 128 RGBW), the first universe starts at the channel offset
+      size_t offset   = out->offset ? 0 : out->channel;
+      size_t dataSize = (512 - offset) / pixelSize * pixelSize;
+      if (dataSize > channelCount - out->offset) dataSize = channelCount - out->offset;
+      size_t slots = offset + dataSize;
+
+      putFlagsLength(packet + E131_ROOT_FLENGTH,  E131_HEADER_LEN + slots - E131_ROOT_FLENGTH);
+      putFlagsLength(packet + E131_FRAME_FLENGTH, E131_HEADER_LEN + slots - E131_FRAME_FLENGTH);
+      putFlagsLength(packet + E131_DMP_FLENGTH,   E131_HEADER_LEN + slots - E131_DMP_FLENGTH);
+      packet[E131_FRAME_SEQ] = out->sequence;
+      putUint16(packet + E131_FRAME_UNIVERSE, out->target);
+      putUint16(packet + E131_DMP_COUNT, slots + 1); // including start code
+      memset(packet + E131_HEADER_LEN, 0, offset);    // channels before our first pixel
+      scaleChannels(packet + E131_HEADER_LEN + offset, buffer + out->offset, dataSize, bri);
+
+      if (sendUdp(out, e131Destination(client, out->target, out->multicast), E131_DEFAULT_PORT, packet, E131_HEADER_LEN + slots)) return 1;
+      out->offset += dataSize;
+      out->target++;
+      out->pending = out->offset < channelCount || out->syncUniverse;
     } break;
 
     case 2: //ArtNet
     {
-      // calculate the number of UDP packets we need to send
-      const size_t channelCount = length * (isRGBW?4:3); // 1 channel for every R,G,B,(W?) value
-      const size_t ARTNET_CHANNELS_PER_PACKET = isRGBW?512:510; // 512/4=128 RGBW LEDs, 510/3=170 RGB LEDs
-      const size_t packetCount = ((channelCount-1)/ARTNET_CHANNELS_PER_PACKET)+1;
-
-      uint32_t channel = 0; 
-      size_t bufferOffset = 0;
-
-      sequenceNumber++;
-
-      for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
-
-        if (sequenceNumber > 255) sequenceNumber = 0;
-
-        if (!ddpUdp.beginPacket(client, ARTNET_DEFAULT_PORT)) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.beginPacket returned an error"));
-          return 1; // borked
-        }
-
-        size_t packetSize = ARTNET_CHANNELS_PER_PACKET;
-
-        if (currentPacket == (packetCount - 1U)) {
-          // last packet
-          if (channelCount % ARTNET_CHANNELS_PER_PACKET) {
-            packetSize = channelCount % ARTNET_CHANNELS_PER_PACKET;
-          }
-        }
-
-        byte header_buffer[ART_NET_HEADER_SIZE];
-        memcpy_P(header_buffer, ART_NET_HEADER, ART_NET_HEADER_SIZE);
-        ddpUdp.write(header_buffer, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
-        ddpUdp.write(sequenceNumber & 0xFF); // sequence number. 1..255
-        ddpUdp.write(0x00); // physical - more an FYI, not really used for anything. 0..3
-        ddpUdp.write((currentPacket) & 0xFF); // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
-        ddpUdp.write(0x00); // Universe MSB, unused.
-        ddpUdp.write(0xFF & (packetSize >> 8)); // 16-bit length of channel data, MSB
-        ddpUdp.write(0xFF & (packetSize     )); // 16-bit length of channel data, LSB
-
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+      IPAddress dest = client;
+      if (out->multicast) dest = ~uint32_t(Network.subnetMask()) | uint32_t(Network.gatewayIP()); // directed broadcast
+
+      if (out->offset >= channelCount) { // ArtSync: receivers latch all universes of the frame at once
+        uint8_t sync[ARTNET_SYNC_LEN];
+        memcpy_P(sync, ART_NET_HEADER, ART_NET_HEADER_SIZE);
+        sync[9] = ARTNET_OPCODE_OPSYNC >> 8; // OpCode (little endian)
+        sync[ART_NET_HEADER_SIZE] = sync[ART_NET_HEADER_SIZE+1] = 0; // Aux1, Aux2
+        return sendUdp(out, dest, ARTNET_DEFAULT_PORT, sync, ARTNET_SYNC_LEN);
+      }
+      // whole pixels per universe (170 RGB or 128 RGBW), the first universe starts at the channel offset
+      size_t offset   = out->offset ? 0 : out->channel;
+      size_t dataSize = (512 - offset) / pixelSize * pixelSize;
+      if (dataSize > channelCount - out->offset) dataSize = channelCount - out->offset;
+      size_t slots = offset + dataSize;
+      if (slots & 1) packet[ARTNET_HEADER_LEN + slots++] = 0; // length must be even
+
+      uint16_t portAddress = out->target & 0x7FFF;
+      packet[ART_NET_HEADER_SIZE]   = out->sequence;
+      packet[ART_NET_HEADER_SIZE+2] = portAddress & 0xFF;        // SubNet & Universe
+      packet[ART_NET_HEADER_SIZE+3] = (portAddress >> 8) & 0x7F; // Net
+      packet[ART_NET_HEADER_SIZE+4] = slots >> 8;                // length, MSB first
+      packet[ART_NET_HEADER_SIZE+5] = slots & 0xFF;
+      memset(packet + ARTNET_HEADER_LEN, 0, offset);              // channels before our first pixel
+      scaleChannels(packet + ARTNET_HEADER_LEN + offset, buffer + out->offset, dataSize, bri);
+
+      if (sendUdp(out, dest, ARTNET_DEFAULT_PORT, packet, ARTNET_HEADER_LEN + slots)) return 1; // borked
+      out->offset += dataSize;
+      out->target = (portAddress + 1) & 0x7FFF;
+      out->pending = true; // ArtSync follows
+    } break;
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.endPacket returned an error"));
-          return 1; // borked
-        }
-        channel += packetSize;
+    case 3: // WLED delta stream
+    {
+      // the last packet is built even without data so the receiver can show the frame and track the sequence
+      size_t len = deltaEncodePacket(&out->delta, packet, UDP_IN_MAXSIZE, buffer, out->last, length, bri);
+      if (!len) return 0;
+      if (sendUdp(out, client, udpPort, packet, len)) {
+        out->keyframe = 0; // receiver is out of sync now
+        return 1;
       }
+      out->pending = !out->delta.done;
     } break;
   }
   return 0;
 }
+
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW, NetOutput *out)  {
+  if (!out) return 1;
+  realtimeBeginFrame(type, out, isRGBW);
+  if (!out->pending) return 1; // no packet buffer
+  do {
+    if (realtimeSendPacket(type, client, length, buffer, bri, isRGBW, out)) return 1;
+  } while (out->pending);
+  return 0;
+}
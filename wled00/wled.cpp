@@ -111,6 +111,10 @@ void WLED::loop()
     handlePresets();
     yield();
 
+    #ifdef WLED_ENABLE_FXBENCH
+    if (handleFxBench()) yield(); // effect benchmark owns the strip while running
+    else
+    #endif
     if (!offMode || strip.isOffRefreshRequired())
       strip.service();
     #ifdef ESP8266
@@ -36,6 +36,9 @@
   #undef WLED_ENABLE_ADALIGHT      // disable has priority over enable
 #endif
 //#define WLED_ENABLE_DMX          // uses 3.5kb (use LEDPIN other than 2)
+//#define WLED_ENABLE_FXBENCH      // on-device effect benchmark via /fxbench (development only)
+//#define WLED_ENABLE_PIPELINE     // dual core ESP32 only: send frame on 2nd core while next frame is rendered and composited (needs LED buffer)
+//#define WLED_ENABLE_NET_OUTPUT_TASK // ESP32 only: send network busses from a separate task, allows up to WLED_MAX_NET_BUSSES (24) of them
 #define WLED_ENABLE_JSONLIVE     // peek LED output via /json/live (WS binary peek is always enabled)
 #ifndef WLED_DISABLE_LOXONE
   #define WLED_ENABLE_LOXONE       // uses 1.2kb
@@ -701,6 +704,9 @@ WLED_GLOBAL WS2812FX strip _INIT(WS2812FX());
 WLED_GLOBAL BusConfig* busConfigs[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES] _INIT({nullptr}); //temporary, to remember values from network callback until after
 WLED_GLOBAL bool doInitBusses _INIT(false);
 WLED_GLOBAL int8_t loadLedmap _INIT(-1);
+#ifdef WLED_ENABLE_FXBENCH
+WLED_GLOBAL bool doRunFxBench _INIT(false);       // flag to start the effect benchmark from async handlers
+#endif
 #ifndef ESP8266
 WLED_GLOBAL char  *ledmapNames[WLED_MAX_LEDMAPS-1] _INIT_N(({nullptr}));
 #endif
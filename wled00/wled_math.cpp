@@ -137,3 +137,62 @@ float fmod_t(float num, float denom) {
   #endif
   return res;
 }
+
+/*
+ * Fixed point variants for the hot paths (no FPU on ESP8266 and ESP32-C3).
+ * Angles are 16 bit: 65536 = full circle. Results are Q15 (32767 = 1.0).
+ * Polynomial approximations are used instead of lookup tables to keep static memory at zero.
+ */
+
+// sin(pi/2*t) ~ t*(A - t^2*(B - t^2*C)) on one quadrant, minimax fit with sin(pi/2) = 1
+// Absolute error <= 1.4e-4 (about 5 LSB of Q15)
+int16_t sin16_t(uint16_t theta) {
+  int32_t x = theta & 0x3FFF;
+  if (theta & 0x4000) x = 0x4000 - x;
+  x <<= 1;                               // Q15 position within quadrant, 0..32768
+  int32_t x2 = (x * x) >> 15;
+  int32_t res = 21028 - ((x2 * 2342) >> 15);
+  res = 51454 - ((x2 * res) >> 15);
+  res = (x * res) >> 15;
+  if (res > 32767) res = 32767;
+  return (theta & 0x8000) ? -res : res;
+}
+
+int16_t cos16_t(uint16_t theta) {
+  return sin16_t(theta + 16384);
+}
+
+// atan(t) ~ pi/4*t + t*(1-t)*(P + Q*t) for 0 <= t <= 1, octant folding for the rest
+// Absolute error <= 18 units (0.1 degrees)
+uint16_t atan2_16(int32_t y, int32_t x) {
+  uint32_t ax = std::abs(x);
+  uint32_t ay = std::abs(y);
+  if (ax == 0 && ay == 0) return 0;
+  bool swap = ay > ax;
+  uint32_t t = swap ? ((uint64_t)ax << 15) / ay : ((uint64_t)ay << 15) / ax; // Q15 ratio, 0..32768
+  int32_t res = (8192 * t + ((t * (32768 - t)) >> 15) * (2552 + ((692 * t) >> 15))) >> 15;
+  if (swap) res = 16384 - res;
+  if (x < 0) res = 32768 - res;
+  if (y < 0) res = -res;
+  return res;
+}
+
+// bitwise integer square root, floor(sqrt(x)); branchless digit step, start at the highest set bit pair
+uint16_t sqrt32_t(uint32_t x) {
+  if (x == 0) return 0;
+  uint32_t res = 0;
+  uint32_t bit = 1UL << ((31 - __builtin_clz(x)) & ~1);
+  while (bit) {
+    uint32_t trial = res + bit;
+    uint32_t take = -uint32_t(x >= trial); // all ones if this digit is set
+    x  -= trial & take;
+    res = (res >> 1) + (bit & take);
+    bit >>= 2;
+  }
+  return res;
+}
+
+// arguments must fit into 16 bit (|x|,|y| <= 46340 keeps the sum of squares in 32 bit)
+uint16_t hypot16_t(int32_t x, int32_t y) {
+  return sqrt32_t((uint32_t)(x * x) + (uint32_t)(y * y));
+}
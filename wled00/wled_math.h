@@ -0,0 +1,35 @@
+#ifndef WLED_MATH_H
+#define WLED_MATH_H
+/*
+ * Fast approximations of math functions (wled_math.cpp)
+ */
+
+#include <Arduino.h>
+
+#ifndef WLED_USE_REAL_MATH
+  template <typename T> T atan_t(T x);
+  float cos_t(float phi);
+  float sin_t(float x);
+  float tan_t(float x);
+  float acos_t(float x);
+  float asin_t(float x);
+  float floor_t(float x);
+  float fmod_t(float num, float denom);
+#else
+  #include <math.h>
+  #define sin_t sin
+  #define cos_t cos
+  #define tan_t tan
+  #define asin_t asin
+  #define acos_t acos
+  #define atan_t atan
+  #define fmod_t fmod
+  #define floor_t floor
+#endif
+int16_t  sin16_t(uint16_t theta);
+int16_t  cos16_t(uint16_t theta);
+uint16_t atan2_16(int32_t y, int32_t x);
+uint16_t sqrt32_t(uint32_t x);
+uint16_t hypot16_t(int32_t x, int32_t y);
+
+#endif
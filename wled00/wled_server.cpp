@@ -328,6 +328,22 @@ void initServer()
 #endif
 
 
+  #ifdef WLED_ENABLE_FXBENCH
+  // tears down and rebuilds the bus configuration, so it is locked like OTA updates
+  server.on("/fxbench", HTTP_POST, [](AsyncWebServerRequest *request){
+    if (!correctPIN || otaLock) {
+      request->send(403, "application/json", F("{\"error\":\"locked\"}"));
+      return;
+    }
+    if (isFxBenchRunning()) {
+      request->send(409, "application/json", F("{\"error\":\"running\"}"));
+      return;
+    }
+    doRunFxBench = true; // benchmark is started from loop(), results are written to /fxbench.json
+    request->send(200, "application/json", F("{\"success\":true}"));
+  });
+  #endif
+
   #ifdef WLED_ENABLE_DMX
   server.on("/dmxmap", HTTP_GET, [](AsyncWebServerRequest *request){
     request->send_P(200, "text/html", PAGE_dmxmap     , dmxProcessor);